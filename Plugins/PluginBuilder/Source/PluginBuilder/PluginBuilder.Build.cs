@@ -40,9 +40,14 @@ public class PluginBuilder : ModuleRules
 				"Json",
 				"JsonUtilities",
 				"Sockets",
+				"DirectoryWatcher",
+				"XmlParser",
 			}
 		);
 
+		// Used to sign requests to S3-compatible storages.
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "OpenSSL");
+
 		if (Target.Version.MajorVersion >= 5)
 		{
 			PrivateDependencyModuleNames.AddRange(
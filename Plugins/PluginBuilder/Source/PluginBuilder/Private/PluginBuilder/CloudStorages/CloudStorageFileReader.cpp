@@ -0,0 +1,412 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/CloudStorages/CloudStorageFileReader.h"
+#include "PluginBuilder/Utilities/PluginBuilderEditorSettings.h"
+#include "PluginBuilder/Utilities/PluginBuilderSettings.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformFile.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * The blocks of a file shared by the readers created for it.
+	 * Each block remembers which readers have not read it yet, and is dropped once all of them have.
+	 */
+	class FCloudStorageFileCache : public TSharedFromThis<FCloudStorageFileCache, ESPMode::ThreadSafe>
+	{
+	public:
+		// Constructor.
+		FCloudStorageFileCache(const FString& InFilePath, int64 InFileSize, int32 NumReaders, int64 InMaxCachedBytes);
+
+		// Queues a read of the specified range and completes every queued read that can be completed.
+		void Read(int32 ReaderIndex, int64 Offset, int64 Length, TFunction<void(const FCloudStorageFileReader::FDataPtr& Data)> OnRead);
+
+		// Drops the reader from the blocks it has not read, for a reader that will not read any more.
+		void ReleaseReader(int32 ReaderIndex);
+
+	public:
+		// The path of the file.
+		const FString FilePath;
+
+		// The size of the file in bytes.
+		const int64 FileSize;
+
+	private:
+		// A block of the file.
+		struct FBlock
+		{
+		public:
+			// The data of the block. Empty until the block has been loaded.
+			TArray<uint8> Data;
+
+			// The bits of the readers that have not read this block yet.
+			uint32 PendingReaders = 0;
+
+			// Whether the data has been read from disk.
+			bool bIsLoaded = false;
+		};
+
+		// A read waiting for its blocks to be loaded.
+		struct FReadRequest
+		{
+		public:
+			int32 ReaderIndex;
+			int64 Offset;
+			int64 Length;
+			TFunction<void(const FCloudStorageFileReader::FDataPtr& Data)> OnRead;
+		};
+
+	private:
+		// Completes the reads whose blocks are loaded and starts loading the blocks of the others, as far as memory allows.
+		void ProcessReadRequests();
+
+		// Reads the specified blocks from disk. Runs on a worker thread.
+		void LoadBlocks(int64 FirstBlockIndex, int64 NumBlocks);
+
+		// Returns whether every block that is loaded or being loaded is within the specified range of block indices.
+		bool AreAllCachedBlocksInRange(int64 FirstBlockIndex, int64 LastBlockIndex) const;
+
+		// Returns the size of the specified block in bytes, which is smaller than BlockSize only for the last block.
+		int64 GetBlockLength(int64 BlockIndex) const;
+
+	private:
+		// Guards all the members below.
+		FCriticalSection CriticalSection;
+
+		// The blocks that are loaded or being loaded, keyed by block index.
+		TMap<int64, FBlock> Blocks;
+
+		// The reads waiting for their blocks, in the order they were requested.
+		TArray<FReadRequest> PendingRequests;
+
+		// The bits of the readers that have not been released.
+		uint32 ActiveReaders;
+
+		// The total size of the blocks in Blocks in bytes.
+		int64 CachedBytes;
+
+		// The number of bytes that can be kept in memory before readers that need new blocks have to wait.
+		int64 MaxCachedBytes;
+
+		// Whether reading the file failed. Every read fails from then on.
+		bool bHasReadError;
+	};
+
+	FCloudStorageFileCache::FCloudStorageFileCache(const FString& InFilePath, const int64 InFileSize, const int32 NumReaders, const int64 InMaxCachedBytes)
+		: FilePath(InFilePath)
+		, FileSize(InFileSize)
+		, ActiveReaders((NumReaders >= 32) ? MAX_uint32 : ((1u << NumReaders) - 1u))
+		, CachedBytes(0)
+		, MaxCachedBytes(InMaxCachedBytes)
+		, bHasReadError(false)
+	{
+	}
+
+	void FCloudStorageFileCache::Read(const int32 ReaderIndex, const int64 Offset, const int64 Length, TFunction<void(const FCloudStorageFileReader::FDataPtr& Data)> OnRead)
+	{
+		{
+			FScopeLock Lock(&CriticalSection);
+			PendingRequests.Add({ ReaderIndex, Offset, Length, MoveTemp(OnRead) });
+		}
+		ProcessReadRequests();
+	}
+
+	void FCloudStorageFileCache::ReleaseReader(const int32 ReaderIndex)
+	{
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			const uint32 ReaderBit = (1u << ReaderIndex);
+			ActiveReaders &= ~ReaderBit;
+
+			for (auto It = Blocks.CreateIterator(); It; ++It)
+			{
+				It->Value.PendingReaders &= ~ReaderBit;
+				if (It->Value.PendingReaders == 0)
+				{
+					CachedBytes -= GetBlockLength(It->Key);
+					It.RemoveCurrent();
+				}
+			}
+
+			PendingRequests.RemoveAll([ReaderIndex](const FReadRequest& Request)
+			{
+				return (Request.ReaderIndex == ReaderIndex);
+			});
+		}
+
+		// The memory given back may let the other readers continue.
+		ProcessReadRequests();
+	}
+
+	void FCloudStorageFileCache::ProcessReadRequests()
+	{
+		TArray<TPair<TFunction<void(const FCloudStorageFileReader::FDataPtr&)>, FCloudStorageFileReader::FDataPtr>> CompletedRequests;
+		TArray<TPair<int64, int64>> BlockRangesToLoad;
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			for (int32 RequestIndex = 0; RequestIndex < PendingRequests.Num();)
+			{
+				FReadRequest& Request = PendingRequests[RequestIndex];
+
+				const bool bIsValidRange = ((Request.Offset >= 0) && (Request.Length >= 0) && (Request.Offset + Request.Length <= FileSize));
+				if (bHasReadError || !bIsValidRange)
+				{
+					CompletedRequests.Emplace(MoveTemp(Request.OnRead), nullptr);
+					PendingRequests.RemoveAt(RequestIndex);
+					continue;
+				}
+
+				if (Request.Length == 0)
+				{
+					CompletedRequests.Emplace(MoveTemp(Request.OnRead), MakeShared<TArray<uint8>, ESPMode::ThreadSafe>());
+					PendingRequests.RemoveAt(RequestIndex);
+					continue;
+				}
+
+				const int64 RequestEnd = (Request.Offset + Request.Length);
+				const int64 FirstBlockIndex = (Request.Offset / FCloudStorageFileReader::BlockSize);
+				const int64 LastBlockIndex = ((RequestEnd - 1) / FCloudStorageFileReader::BlockSize);
+
+				bool bIsReady = true;
+				int64 MissingBytes = 0;
+				for (int64 BlockIndex = FirstBlockIndex; BlockIndex <= LastBlockIndex; BlockIndex++)
+				{
+					const FBlock* Block = Blocks.Find(BlockIndex);
+					if (Block == nullptr)
+					{
+						MissingBytes += GetBlockLength(BlockIndex);
+					}
+					if ((Block == nullptr) || !Block->bIsLoaded)
+					{
+						bIsReady = false;
+					}
+				}
+
+				if (!bIsReady)
+				{
+					// A read larger than the limit is let through once every cached block is one it needs itself.
+					// Those blocks cannot be dropped before this read completes, so waiting would stall every reader forever.
+					const bool bCanLoad = (
+						(CachedBytes + MissingBytes <= MaxCachedBytes) ||
+						AreAllCachedBlocksInRange(FirstBlockIndex, LastBlockIndex)
+					);
+					if ((MissingBytes > 0) && bCanLoad)
+					{
+						int64 RangeStartIndex = INDEX_NONE;
+						for (int64 BlockIndex = FirstBlockIndex; BlockIndex <= LastBlockIndex + 1; BlockIndex++)
+						{
+							const bool bIsMissing = ((BlockIndex <= LastBlockIndex) && !Blocks.Contains(BlockIndex));
+							if (bIsMissing && (RangeStartIndex == INDEX_NONE))
+							{
+								RangeStartIndex = BlockIndex;
+							}
+							else if (!bIsMissing && (RangeStartIndex != INDEX_NONE))
+							{
+								BlockRangesToLoad.Emplace(RangeStartIndex, BlockIndex - RangeStartIndex);
+								RangeStartIndex = INDEX_NONE;
+							}
+						}
+
+						for (int64 BlockIndex = FirstBlockIndex; BlockIndex <= LastBlockIndex; BlockIndex++)
+						{
+							if (!Blocks.Contains(BlockIndex))
+							{
+								FBlock& Block = Blocks.Add(BlockIndex);
+								Block.PendingReaders = ActiveReaders;
+							}
+						}
+						CachedBytes += MissingBytes;
+					}
+
+					RequestIndex++;
+					continue;
+				}
+
+				const FCloudStorageFileReader::FDataPtr Data = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+				Data->SetNumUninitialized(static_cast<int32>(Request.Length));
+
+				const uint32 ReaderBit = (1u << Request.ReaderIndex);
+				for (int64 BlockIndex = FirstBlockIndex; BlockIndex <= LastBlockIndex; BlockIndex++)
+				{
+					FBlock& Block = Blocks.FindChecked(BlockIndex);
+					const int64 BlockStart = (BlockIndex * FCloudStorageFileReader::BlockSize);
+					const int64 BlockEnd = (BlockStart + GetBlockLength(BlockIndex));
+					const int64 CopyStart = FMath::Max(BlockStart, Request.Offset);
+					const int64 CopyEnd = FMath::Min(BlockEnd, RequestEnd);
+					FMemory::Memcpy(Data->GetData() + (CopyStart - Request.Offset), Block.Data.GetData() + (CopyStart - BlockStart), CopyEnd - CopyStart);
+
+					// A block only partly covered by this read is kept until the reader is released.
+					if (Request.Offset <= BlockStart && BlockEnd <= RequestEnd)
+					{
+						Block.PendingReaders &= ~ReaderBit;
+						if (Block.PendingReaders == 0)
+						{
+							CachedBytes -= GetBlockLength(BlockIndex);
+							Blocks.Remove(BlockIndex);
+						}
+					}
+				}
+
+				CompletedRequests.Emplace(MoveTemp(Request.OnRead), Data);
+				PendingRequests.RemoveAt(RequestIndex);
+			}
+		}
+
+		for (const TPair<int64, int64>& BlockRange : BlockRangesToLoad)
+		{
+			const TSharedRef<FCloudStorageFileCache, ESPMode::ThreadSafe> This = AsShared();
+			Async(EAsyncExecution::ThreadPool, [This, BlockRange]()
+			{
+				This->LoadBlocks(BlockRange.Key, BlockRange.Value);
+			});
+		}
+
+		for (const auto& CompletedRequest : CompletedRequests)
+		{
+			if (CompletedRequest.Key)
+			{
+				CompletedRequest.Key(CompletedRequest.Value);
+			}
+		}
+	}
+
+	void FCloudStorageFileCache::LoadBlocks(const int64 FirstBlockIndex, const int64 NumBlocks)
+	{
+		const int64 Offset = (FirstBlockIndex * FCloudStorageFileReader::BlockSize);
+		const int64 Length = FMath::Min(NumBlocks * FCloudStorageFileReader::BlockSize, FileSize - Offset);
+
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(static_cast<int32>(Length));
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		const TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*FilePath));
+		const bool bReadSucceeded = (FileHandle.IsValid() && FileHandle->Seek(Offset) && FileHandle->Read(Data.GetData(), Length));
+		if (!bReadSucceeded)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Failed to read %lld bytes at offset %lld of %s."), Length, Offset, *FilePath);
+		}
+
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			if (!bReadSucceeded)
+			{
+				bHasReadError = true;
+			}
+
+			for (int64 BlockIndex = FirstBlockIndex; BlockIndex < FirstBlockIndex + NumBlocks; BlockIndex++)
+			{
+				// The block is gone if every reader that needed it was released while it was loading.
+				FBlock* Block = Blocks.Find(BlockIndex);
+				if (Block == nullptr || !bReadSucceeded)
+				{
+					continue;
+				}
+
+				const int64 DataOffset = ((BlockIndex - FirstBlockIndex) * FCloudStorageFileReader::BlockSize);
+				Block->Data.Append(Data.GetData() + DataOffset, static_cast<int32>(GetBlockLength(BlockIndex)));
+				Block->bIsLoaded = true;
+			}
+		}
+
+		ProcessReadRequests();
+	}
+
+	bool FCloudStorageFileCache::AreAllCachedBlocksInRange(const int64 FirstBlockIndex, const int64 LastBlockIndex) const
+	{
+		for (const TPair<int64, FBlock>& Pair : Blocks)
+		{
+			if ((Pair.Key < FirstBlockIndex) || (Pair.Key > LastBlockIndex))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	int64 FCloudStorageFileCache::GetBlockLength(const int64 BlockIndex) const
+	{
+		return FMath::Min(FCloudStorageFileReader::BlockSize, FileSize - (BlockIndex * FCloudStorageFileReader::BlockSize));
+	}
+
+	TArray<TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>> FCloudStorageFileReader::CreateReaders(const FString& FilePath, int32 NumReaders)
+	{
+		TArray<TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>> Readers;
+
+		const int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+		if (FileSize < 0)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Local file not found: %s"), *FilePath);
+			return Readers;
+		}
+
+		NumReaders = FMath::Clamp(NumReaders, 1, MaxNumReaders);
+		const int64 MaxCachedBytes = (static_cast<int64>(FMath::Max(GetSettings<UPluginBuilderEditorSettings>().UploadReadCacheSize, 16)) * 1024 * 1024);
+		const TSharedRef<FCloudStorageFileCache, ESPMode::ThreadSafe> Cache = MakeShared<FCloudStorageFileCache, ESPMode::ThreadSafe>(FilePath, FileSize, NumReaders, MaxCachedBytes);
+
+		for (int32 ReaderIndex = 0; ReaderIndex < NumReaders; ReaderIndex++)
+		{
+			Readers.Add(MakeShared<FCloudStorageFileReader, ESPMode::ThreadSafe>(Cache, ReaderIndex));
+		}
+
+		return Readers;
+	}
+
+	FCloudStorageFileReader::FCloudStorageFileReader(const TSharedRef<FCloudStorageFileCache, ESPMode::ThreadSafe>& InCache, const int32 InReaderIndex)
+		: Cache(InCache)
+		, ReaderIndex(InReaderIndex)
+	{
+	}
+
+	FCloudStorageFileReader::~FCloudStorageFileReader()
+	{
+		Cache->ReleaseReader(ReaderIndex);
+	}
+
+	const FString& FCloudStorageFileReader::GetFilePath() const
+	{
+		return Cache->FilePath;
+	}
+
+	int64 FCloudStorageFileReader::GetFileSize() const
+	{
+		return Cache->FileSize;
+	}
+
+	void FCloudStorageFileReader::ReadAsync(const int64 Offset, const int64 Length, TFunction<void(const FDataPtr& Data)> OnRead)
+	{
+		Cache->Read(ReaderIndex, Offset, Length, MoveTemp(OnRead));
+	}
+
+	bool FCloudStorageFileReader::Read(const int64 Offset, const int64 Length, TArray<uint8>& OutData)
+	{
+		FEvent* ReadEvent = FPlatformProcess::GetSynchEventFromPool(false);
+
+		FDataPtr Result;
+		ReadAsync(Offset, Length, [&Result, ReadEvent](const FDataPtr& Data)
+		{
+			Result = Data;
+			ReadEvent->Trigger();
+		});
+		ReadEvent->Wait();
+
+		FPlatformProcess::ReturnSynchEventToPool(ReadEvent);
+
+		if (!Result.IsValid())
+		{
+			return false;
+		}
+
+		OutData = MoveTemp(*Result);
+		return true;
+	}
+}
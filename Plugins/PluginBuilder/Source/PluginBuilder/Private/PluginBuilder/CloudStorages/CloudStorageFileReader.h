@@ -0,0 +1,62 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	class FCloudStorageFileCache;
+
+	/**
+	 * Reads a local file on behalf of one upload destination.
+	 * The readers created together for the same file share the data they read, so that each part of the file
+	 * is read from disk only once however many destinations it is uploaded to.
+	 * Data stays in memory until every reader has consumed it, and a reader that gets too far ahead of
+	 * the others waits until they catch up.
+	 */
+	class FCloudStorageFileReader
+	{
+	public:
+		// The data returned by a read, or nullptr if the file could not be read.
+		using FDataPtr = TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe>;
+
+		// The unit in which data is shared between readers.
+		// Reads whose offset and length are multiples of this, except at the end of the file, release their data as soon as possible.
+		static constexpr int64 BlockSize = (64 * 1024);
+
+		// The maximum number of readers that can share a file.
+		static constexpr int32 MaxNumReaders = 32;
+
+	public:
+		// Creates readers that share the data of the specified file, one for each destination.
+		// Returns an empty array if the file does not exist.
+		static TArray<TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>> CreateReaders(const FString& FilePath, int32 NumReaders);
+
+		// Constructor.
+		FCloudStorageFileReader(const TSharedRef<FCloudStorageFileCache, ESPMode::ThreadSafe>& InCache, int32 InReaderIndex);
+
+		// Destructor. Releases the data that only this reader was still going to read.
+		~FCloudStorageFileReader();
+
+		// Returns the path of the file being read.
+		const FString& GetFilePath() const;
+
+		// Returns the size of the file being read in bytes.
+		int64 GetFileSize() const;
+
+		// Reads the specified range of the file and calls OnRead with the data, possibly on a worker thread.
+		// Each range is expected to be read once and in roughly ascending order.
+		void ReadAsync(int64 Offset, int64 Length, TFunction<void(const FDataPtr& Data)> OnRead);
+
+		// Reads the specified range of the file, blocking the calling thread until the data is available.
+		bool Read(int64 Offset, int64 Length, TArray<uint8>& OutData);
+
+	private:
+		// The data shared with the other readers of the same file.
+		TSharedRef<FCloudStorageFileCache, ESPMode::ThreadSafe> Cache;
+
+		// The index of this reader among the readers of the same file.
+		int32 ReaderIndex;
+	};
+}
@@ -3,33 +3,90 @@
 #include "PluginBuilder/CloudStorages/CloudStorageManager.h"
 #include "PluginBuilder/CloudStorages/ICloudStorageProvider.h"
 #include "PluginBuilder/CloudStorages/OneDrive/OneDriveClient.h"
+#include "PluginBuilder/CloudStorages/S3/S3Client.h"
+#include "PluginBuilder/CloudStorages/FileSystem/FileSystemClient.h"
+#include "PluginBuilder/Utilities/FileSystemStorageSettings.h"
+#include "PluginBuilder/Utilities/OneDriveSettings.h"
+#include "PluginBuilder/Utilities/S3Settings.h"
 #include "PluginBuilder/Utilities/PluginBuilderEditorSettings.h"
 #include "PluginBuilder/Utilities/PluginBuilderSettings.h"
 
 namespace PluginBuilder
 {
-	TSharedPtr<ICloudStorageProvider> FCloudStorageManager::CurrentProvider;
+	TSharedPtr<ICloudStorageProvider> FCloudStorageManager::CustomProvider;
+	TMap<ECloudStorageProvider, TSharedPtr<ICloudStorageProvider>> FCloudStorageManager::ProviderInstances;
 
 	TSharedPtr<ICloudStorageProvider> FCloudStorageManager::GetCurrentProvider()
 	{
-		const auto& EditorSettings = GetSettings<UPluginBuilderEditorSettings>();
+		// A registered custom provider is used regardless of the editor preferences.
+		if (CustomProvider.IsValid())
+		{
+			return CustomProvider;
+		}
 
-		switch (EditorSettings.CloudStorageProvider)
+		return GetProvider(GetSettings<UPluginBuilderEditorSettings>().CloudStorageProvider);
+	}
+
+	TArray<TSharedPtr<ICloudStorageProvider>> FCloudStorageManager::GetDestinationProviders()
+	{
+		TArray<TSharedPtr<ICloudStorageProvider>> DestinationProviders;
+		DestinationProviders.Add(GetCurrentProvider());
+
+		for (const ECloudStorageProvider ProviderType : GetSettings<UPluginBuilderEditorSettings>().AdditionalCloudStorageProviders)
 		{
+			DestinationProviders.AddUnique(GetProvider(ProviderType));
+		}
+
+		return DestinationProviders;
+	}
+
+	void FCloudStorageManager::RegisterProvider(TSharedPtr<ICloudStorageProvider> InProvider)
+	{
+		CustomProvider = MoveTemp(InProvider);
+	}
+
+	TSharedPtr<ICloudStorageProvider> FCloudStorageManager::GetProvider(const ECloudStorageProvider ProviderType)
+	{
+		// Instances are kept so that state such as prepared upload sessions survives between calls.
+		if (const TSharedPtr<ICloudStorageProvider>* ExistingProvider = ProviderInstances.Find(ProviderType))
+		{
+			return *ExistingProvider;
+		}
+
+		TSharedPtr<ICloudStorageProvider> Provider;
+		switch (ProviderType)
+		{
+		case ECloudStorageProvider::S3:
+			Provider = MakeShared<FS3Client>();
+			break;
+		case ECloudStorageProvider::FileSystem:
+			Provider = MakeShared<FFileSystemClient>();
+			break;
 		case ECloudStorageProvider::OneDrive:
 		default:
-			if (!CurrentProvider.IsValid())
-			{
-				CurrentProvider = MakeShared<FOneDriveClient>();
-			}
+			Provider = MakeShared<FOneDriveClient>();
 			break;
 		}
+		ProviderInstances.Add(ProviderType, Provider);
 
-		return CurrentProvider;
+		return Provider;
 	}
 
-	void FCloudStorageManager::RegisterProvider(TSharedPtr<ICloudStorageProvider> InProvider)
+	void FCloudStorageManager::OpenCurrentProviderSettings()
 	{
-		CurrentProvider = MoveTemp(InProvider);
+		const auto& EditorSettings = GetSettings<UPluginBuilderEditorSettings>();
+		switch (EditorSettings.CloudStorageProvider)
+		{
+		case ECloudStorageProvider::S3:
+			OpenSettings<US3Settings>();
+			break;
+		case ECloudStorageProvider::FileSystem:
+			OpenSettings<UFileSystemStorageSettings>();
+			break;
+		case ECloudStorageProvider::OneDrive:
+		default:
+			OpenSettings<UOneDriveSettings>();
+			break;
+		}
 	}
 }
@@ -4,13 +4,16 @@
 
 #include "CoreMinimal.h"
 
+enum class ECloudStorageProvider : uint8;
+
 namespace PluginBuilder
 {
 	class ICloudStorageProvider;
 
 	/**
-	 * Manages the active cloud storage provider.
-	 * Use GetCurrentProvider() to obtain the provider selected in editor preferences.
+	 * Manages the active cloud storage providers.
+	 * Use GetCurrentProvider() to obtain the provider selected in editor preferences,
+	 * and GetDestinationProviders() to obtain every provider that packaged plugins are uploaded to.
 	 * Additional providers can be registered to support future cloud storage services.
 	 */
 	class PLUGINBUILDER_API FCloudStorageManager
@@ -19,11 +22,24 @@ namespace PluginBuilder
 		// Returns the currently active cloud storage provider, or nullptr if none is configured.
 		static TSharedPtr<ICloudStorageProvider> GetCurrentProvider();
 
+		// Returns the current provider followed by the additional providers selected in editor preferences, without duplicates.
+		static TArray<TSharedPtr<ICloudStorageProvider>> GetDestinationProviders();
+
 		// Registers a custom provider, replacing the current one.
 		static void RegisterProvider(TSharedPtr<ICloudStorageProvider> InProvider);
 
+		// Opens the settings of the provider selected in editor preferences.
+		static void OpenCurrentProviderSettings();
+
 	private:
-		// The currently active cloud storage provider instance.
-		static TSharedPtr<ICloudStorageProvider> CurrentProvider;
+		// Returns the instance of the specified provider type, creating it on first use.
+		static TSharedPtr<ICloudStorageProvider> GetProvider(ECloudStorageProvider ProviderType);
+
+	private:
+		// The registered custom provider, which is used instead of the one selected in editor preferences.
+		static TSharedPtr<ICloudStorageProvider> CustomProvider;
+
+		// The provider instances created from editor preferences, keyed by type.
+		static TMap<ECloudStorageProvider, TSharedPtr<ICloudStorageProvider>> ProviderInstances;
 	};
 }
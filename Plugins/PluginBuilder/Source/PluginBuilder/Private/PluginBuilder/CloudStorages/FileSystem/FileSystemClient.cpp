@@ -0,0 +1,406 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/CloudStorages/FileSystem/FileSystemClient.h"
+#include "PluginBuilder/Types/OneDriveConflictBehavior.h"
+#include "PluginBuilder/Utilities/FileReplacer.h"
+#include "PluginBuilder/Utilities/FileSystemStorageSettings.h"
+#include "PluginBuilder/Utilities/PluginBuilderPackagingSettings.h"
+#include "PluginBuilder/Utilities/PluginBuilderSettings.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformFile.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+namespace PluginBuilder
+{
+	FString FFileSystemClient::GetProviderName() const
+	{
+		return TEXT("File System");
+	}
+
+	bool FFileSystemClient::IsAuthenticated() const
+	{
+		return GetSettings<UFileSystemStorageSettings>().IsConfigured();
+	}
+
+	void FFileSystemClient::RefreshTokenIfNeeded(TFunction<void(bool bSuccess)> OnComplete)
+	{
+		// There is nothing to sign in to.
+		OnComplete(IsAuthenticated());
+	}
+
+	FString FFileSystemClient::ComputeContentHash(const FString& LocalFilePath) const
+	{
+		const FMD5Hash Hash = FMD5Hash::HashFile(*LocalFilePath);
+		return (Hash.IsValid() ? LexToString(Hash) : FString());
+	}
+
+	void FFileSystemClient::FindItem(
+		const FString& RemoteFilePath,
+		TFunction<void(bool bFound, const FString& ItemId, const FString& ContentHash)> OnComplete
+	)
+	{
+		const FString DestinationFilePath = ToDestinationPath(RemoteFilePath);
+
+		// Network shares can be slow to respond, so even the existence check is done off the game thread.
+		Async(EAsyncExecution::ThreadPool, [DestinationFilePath, OnComplete]()
+		{
+			IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+			const bool bFound = PlatformFile.FileExists(*DestinationFilePath);
+
+			FString ContentHash;
+			if (bFound)
+			{
+				// The checksum file is only trusted if it is not older than the file it describes.
+				const FString ChecksumFilePath = GetChecksumFilePath(DestinationFilePath);
+				FString ChecksumFileContent;
+				if (PlatformFile.GetTimeStamp(*ChecksumFilePath) >= PlatformFile.GetTimeStamp(*DestinationFilePath) &&
+					FFileHelper::LoadFileToString(ChecksumFileContent, *ChecksumFilePath))
+				{
+					ChecksumFileContent.TrimStartAndEnd().Split(TEXT(" "), &ContentHash, nullptr);
+				}
+				if (ContentHash.IsEmpty())
+				{
+					const FMD5Hash Hash = FMD5Hash::HashFile(*DestinationFilePath);
+					ContentHash = (Hash.IsValid() ? LexToString(Hash) : FString());
+				}
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [bFound, DestinationFilePath, ContentHash, OnComplete]()
+			{
+				OnComplete(bFound, (bFound ? DestinationFilePath : FString()), ContentHash);
+			});
+		});
+	}
+
+	void FFileSystemClient::UploadFile(
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+		const FString& RemoteFilePath,
+		TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+		TFunction<void(float Progress)> OnProgress
+	)
+	{
+		const int64 FileSize = FileReader->GetFileSize();
+
+		const auto& Settings = GetSettings<UFileSystemStorageSettings>();
+		const int64 BufferSize = (static_cast<int64>(FMath::Clamp(Settings.CopyBufferSize, 1, 256)) * 1024 * 1024);
+		const int32 NumBuffers = FMath::Clamp(Settings.NumCopyBuffers, 2, 16);
+		const bool bWriteChecksumFile = Settings.bWriteChecksumFiles;
+		const EOneDriveConflictBehavior ConflictBehavior = GetSettings<UPluginBuilderPackagingSettings>().ConflictBehavior;
+		const FString DestinationFilePath = ToDestinationPath(RemoteFilePath);
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("File System: Copying %s (%lld bytes) to %s..."), *FPaths::GetCleanFilename(FileReader->GetFilePath()), FileSize, *DestinationFilePath);
+
+		// A dedicated thread is used rather than the thread pool because the copy blocks on I/O for a long time.
+		Async(EAsyncExecution::Thread, [FileReader, DestinationFilePath, ConflictBehavior, BufferSize, NumBuffers, bWriteChecksumFile, FileSize, OnComplete, OnProgress]()
+		{
+			const FString CopiedFilePath = CopyFileToDestination(
+				FileReader,
+				DestinationFilePath,
+				ConflictBehavior,
+				BufferSize,
+				NumBuffers,
+				bWriteChecksumFile,
+				[FileSize, OnProgress](const int64 CopiedBytes)
+				{
+					if (OnProgress && (FileSize > 0))
+					{
+						const float Progress = (static_cast<float>(CopiedBytes) / static_cast<float>(FileSize));
+						AsyncTask(ENamedThreads::GameThread, [OnProgress, Progress]()
+						{
+							OnProgress(Progress);
+						});
+					}
+				}
+			);
+
+			AsyncTask(ENamedThreads::GameThread, [CopiedFilePath, OnComplete]()
+			{
+				if (CopiedFilePath.IsEmpty())
+				{
+					OnComplete(false, FString());
+					return;
+				}
+
+				UE_LOG(LogPluginBuilder, Log, TEXT("File System: Copy complete. Path: %s"), *CopiedFilePath);
+				OnComplete(true, CopiedFilePath);
+			});
+		});
+	}
+
+	void FFileSystemClient::GetShareUrl(
+		const FString& RemoteItemId,
+		TFunction<void(bool bSuccess, const FString& ShareUrl)> OnComplete
+	)
+	{
+		FString Path = FPaths::ConvertRelativePathToFull(RemoteItemId);
+		FPaths::NormalizeFilename(Path);
+		Path.ReplaceInline(TEXT(" "), TEXT("%20"));
+
+		// UNC paths (//server/share/...) keep the server as the URL host.
+		if (Path.StartsWith(TEXT("//")))
+		{
+			OnComplete(true, FString::Printf(TEXT("file:%s"), *Path));
+			return;
+		}
+
+		if (!Path.StartsWith(TEXT("/")))
+		{
+			Path = FString::Printf(TEXT("/%s"), *Path);
+		}
+		OnComplete(true, FString::Printf(TEXT("file://%s"), *Path));
+	}
+
+	FString FFileSystemClient::CopyFileToDestination(
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+		const FString& DestinationFilePath,
+		const EOneDriveConflictBehavior ConflictBehavior,
+		const int64 BufferSize,
+		const int32 NumBuffers,
+		const bool bWriteChecksumFile,
+		const TFunction<void(int64 CopiedBytes)>& OnBufferWritten
+	)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		const FString DestinationDirectoryPath = FPaths::GetPath(DestinationFilePath);
+		if (!PlatformFile.CreateDirectoryTree(*DestinationDirectoryPath))
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("File System: Failed to create directory: %s"), *DestinationDirectoryPath);
+			return FString();
+		}
+
+		if ((ConflictBehavior == EOneDriveConflictBehavior::Fail) && PlatformFile.FileExists(*DestinationFilePath))
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("File System: %s already exists."), *DestinationFilePath);
+			return FString();
+		}
+
+		// Writing to a temporary file in the same directory means that readers never see a partially written file,
+		// and that the final rename does not have to move the data across volumes.
+		const FString TempFilePath = FString::Printf(TEXT("%s.%s.tmp"), *DestinationFilePath, *FGuid::NewGuid().ToString());
+
+		FString ContentHash;
+		if (!CopyFileContents(FileReader, TempFilePath, BufferSize, NumBuffers, OnBufferWritten, ContentHash))
+		{
+			PlatformFile.DeleteFile(*TempFilePath);
+			return FString();
+		}
+
+		FString FinalFilePath = DestinationFilePath;
+		bool bIsReplacing = false;
+		if (PlatformFile.FileExists(*FinalFilePath))
+		{
+			if (ConflictBehavior == EOneDriveConflictBehavior::Rename)
+			{
+				FinalFilePath = MakeUniqueFilePath(DestinationFilePath);
+			}
+			else if (ConflictBehavior == EOneDriveConflictBehavior::Fail)
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("File System: %s was created while copying."), *DestinationFilePath);
+				PlatformFile.DeleteFile(*TempFilePath);
+				return FString();
+			}
+			else
+			{
+				bIsReplacing = true;
+			}
+		}
+
+		// The existing file is replaced in a single rename, so that it stays in place if the rename fails.
+		if (!FFileReplacer::ReplaceFile(FinalFilePath, TempFilePath))
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("File System: Failed to move %s to %s."), *TempFilePath, *FinalFilePath);
+			PlatformFile.DeleteFile(*TempFilePath);
+			return FString();
+		}
+
+		// The checksum file of the replaced file no longer describes the destination, so it is overwritten or removed.
+		bool bHasWrittenChecksumFile = false;
+		if (bWriteChecksumFile)
+		{
+			// The same format as md5sum, so that the file can also be verified by hand.
+			const FString ChecksumFileContent = FString::Printf(TEXT("%s  %s\n"), *ContentHash, *FPaths::GetCleanFilename(FinalFilePath));
+			bHasWrittenChecksumFile = FFileHelper::SaveStringToFile(ChecksumFileContent, *GetChecksumFilePath(FinalFilePath));
+			if (!bHasWrittenChecksumFile)
+			{
+				UE_LOG(LogPluginBuilder, Warning, TEXT("File System: Failed to write checksum file for %s."), *FinalFilePath);
+			}
+		}
+		if (bIsReplacing && !bHasWrittenChecksumFile)
+		{
+			PlatformFile.DeleteFile(*GetChecksumFilePath(FinalFilePath));
+		}
+
+		return FinalFilePath;
+	}
+
+	bool FFileSystemClient::CopyFileContents(
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+		const FString& DestinationFilePath,
+		const int64 BufferSize,
+		const int32 NumBuffers,
+		const TFunction<void(int64 CopiedBytes)>& OnBufferWritten,
+		FString& OutContentHash
+	)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		TUniquePtr<IFileHandle> WriteHandle(PlatformFile.OpenWrite(*DestinationFilePath));
+		if (!WriteHandle.IsValid())
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("File System: Failed to create %s."), *DestinationFilePath);
+			return false;
+		}
+
+		// Buffers travel from the reader to the writer through FilledBuffers and back through FreeBuffers.
+		// An index of INDEX_NONE marks the end of the data.
+		TArray<TArray<uint8>> Buffers;
+		TArray<int64> BufferDataSizes;
+		Buffers.SetNum(NumBuffers);
+		BufferDataSizes.SetNumZeroed(NumBuffers);
+
+		TQueue<int32, EQueueMode::Spsc> FilledBuffers;
+		TQueue<int32, EQueueMode::Spsc> FreeBuffers;
+		for (int32 BufferIndex = 0; BufferIndex < NumBuffers; BufferIndex++)
+		{
+			FreeBuffers.Enqueue(BufferIndex);
+		}
+
+		FEvent* FilledEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		FEvent* FreeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		FThreadSafeBool bShouldStop(false);
+
+		TFuture<bool> ReadResult = Async(EAsyncExecution::Thread, [&]() -> bool
+		{
+			FMD5 Md5;
+			bool bReadSucceeded = true;
+			int64 ReadOffset = 0;
+			int64 RemainingSize = FileReader->GetFileSize();
+			while (RemainingSize > 0 && !bShouldStop)
+			{
+				int32 BufferIndex;
+				while (!FreeBuffers.Dequeue(BufferIndex))
+				{
+					FreeEvent->Wait();
+				}
+				if (bShouldStop)
+				{
+					break;
+				}
+
+				const int64 ReadSize = FMath::Min(RemainingSize, BufferSize);
+				TArray<uint8>& Buffer = Buffers[BufferIndex];
+				if (!FileReader->Read(ReadOffset, ReadSize, Buffer))
+				{
+					bReadSucceeded = false;
+					break;
+				}
+
+				Md5.Update(Buffer.GetData(), static_cast<uint64>(ReadSize));
+				BufferDataSizes[BufferIndex] = ReadSize;
+				ReadOffset += ReadSize;
+				RemainingSize -= ReadSize;
+
+				FilledBuffers.Enqueue(BufferIndex);
+				FilledEvent->Trigger();
+			}
+
+			FMD5Hash Hash;
+			Hash.Set(Md5);
+			OutContentHash = LexToString(Hash);
+
+			FilledBuffers.Enqueue(INDEX_NONE);
+			FilledEvent->Trigger();
+
+			return bReadSucceeded;
+		});
+
+		bool bWriteSucceeded = true;
+		int64 CopiedBytes = 0;
+		while (true)
+		{
+			int32 BufferIndex;
+			while (!FilledBuffers.Dequeue(BufferIndex))
+			{
+				FilledEvent->Wait();
+			}
+			if (BufferIndex == INDEX_NONE)
+			{
+				break;
+			}
+
+			if (bWriteSucceeded)
+			{
+				bWriteSucceeded = WriteHandle->Write(Buffers[BufferIndex].GetData(), BufferDataSizes[BufferIndex]);
+				if (bWriteSucceeded)
+				{
+					CopiedBytes += BufferDataSizes[BufferIndex];
+					OnBufferWritten(CopiedBytes);
+				}
+				else
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("File System: Failed to write %s."), *DestinationFilePath);
+					bShouldStop = true;
+				}
+			}
+
+			FreeBuffers.Enqueue(BufferIndex);
+			FreeEvent->Trigger();
+		}
+
+		const bool bReadSucceeded = ReadResult.Get();
+		if (!bReadSucceeded)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("File System: Failed to read %s."), *FileReader->GetFilePath());
+		}
+
+		FPlatformProcess::ReturnSynchEventToPool(FilledEvent);
+		FPlatformProcess::ReturnSynchEventToPool(FreeEvent);
+
+		const bool bFlushSucceeded = (bWriteSucceeded && WriteHandle->Flush(true));
+		WriteHandle.Reset();
+
+		return (bReadSucceeded && bWriteSucceeded && bFlushSucceeded);
+	}
+
+	FString FFileSystemClient::MakeUniqueFilePath(const FString& FilePath)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		const FString DirectoryPath = FPaths::GetPath(FilePath);
+		const FString BaseFilename = FPaths::GetBaseFilename(FilePath);
+		const FString Extension = FPaths::GetExtension(FilePath, true);
+
+		FString UniqueFilePath;
+		int32 Suffix = 1;
+		do
+		{
+			UniqueFilePath = (DirectoryPath / FString::Printf(TEXT("%s (%d)%s"), *BaseFilename, Suffix, *Extension));
+			Suffix++;
+		}
+		while (PlatformFile.FileExists(*UniqueFilePath));
+
+		return UniqueFilePath;
+	}
+
+	FString FFileSystemClient::GetChecksumFilePath(const FString& FilePath)
+	{
+		return (FilePath + TEXT(".md5"));
+	}
+
+	FString FFileSystemClient::ToDestinationPath(const FString& RemoteFilePath)
+	{
+		const FString& RootDirectoryPath = GetSettings<UFileSystemStorageSettings>().RootDirectory.Path;
+		return FPaths::ConvertRelativePathToFull(RootDirectoryPath / RemoteFilePath);
+	}
+}
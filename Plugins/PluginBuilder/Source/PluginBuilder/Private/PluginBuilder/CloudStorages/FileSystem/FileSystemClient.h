@@ -0,0 +1,76 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/CloudStorages/ICloudStorageProvider.h"
+#include "PluginBuilder/CloudStorages/CloudStorageFileReader.h"
+
+enum class EOneDriveConflictBehavior : uint8;
+
+namespace PluginBuilder
+{
+	/**
+	 * A storage provider that copies files into a local directory or a network share.
+	 * Files are copied on worker threads through a pipeline of large buffers, so that reading and writing overlap,
+	 * into a temporary file that is renamed into place only once it is complete.
+	 * Remote item IDs are the absolute paths of the copied files, and share URLs are file:// URLs.
+	 */
+	class FFileSystemClient : public ICloudStorageProvider
+	{
+	public:
+		// ICloudStorageProvider interface.
+		virtual FString GetProviderName() const override;
+		virtual bool IsAuthenticated() const override;
+		virtual void RefreshTokenIfNeeded(TFunction<void(bool bSuccess)> OnComplete) override;
+		virtual FString ComputeContentHash(const FString& LocalFilePath) const override;
+		virtual void FindItem(
+			const FString& RemoteFilePath,
+			TFunction<void(bool bFound, const FString& ItemId, const FString& ContentHash)> OnComplete
+		) override;
+		virtual void UploadFile(
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+			const FString& RemoteFilePath,
+			TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+			TFunction<void(float Progress)> OnProgress
+		) override;
+		virtual void GetShareUrl(
+			const FString& RemoteItemId,
+			TFunction<void(bool bSuccess, const FString& ShareUrl)> OnComplete
+		) override;
+		// End of ICloudStorageProvider interface.
+
+	private:
+		// Copies a file into the destination directory. Runs on a worker thread.
+		// Returns the path of the copied file, or an empty string on failure.
+		static FString CopyFileToDestination(
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+			const FString& DestinationFilePath,
+			EOneDriveConflictBehavior ConflictBehavior,
+			int64 BufferSize,
+			int32 NumBuffers,
+			bool bWriteChecksumFile,
+			const TFunction<void(int64 CopiedBytes)>& OnBufferWritten
+		);
+
+		// Copies the contents of a file with a reader thread and the calling thread as the writer.
+		// Returns whether all bytes were copied, and the MD5 of the copied bytes.
+		static bool CopyFileContents(
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+			const FString& DestinationFilePath,
+			int64 BufferSize,
+			int32 NumBuffers,
+			const TFunction<void(int64 CopiedBytes)>& OnBufferWritten,
+			FString& OutContentHash
+		);
+
+		// Returns a path next to the specified one that does not exist yet, such as "Name (1).zip".
+		static FString MakeUniqueFilePath(const FString& FilePath);
+
+		// Returns the path of the checksum file of the specified file.
+		static FString GetChecksumFilePath(const FString& FilePath);
+
+		// Returns the absolute destination path for the specified remote path.
+		static FString ToDestinationPath(const FString& RemoteFilePath);
+	};
+}
@@ -6,6 +6,8 @@
 
 namespace PluginBuilder
 {
+	class FCloudStorageFileReader;
+
 	/**
 	 * An interface for cloud storage providers that support file upload and share URL retrieval.
 	 * Implement this interface to add support for additional cloud storage services.
@@ -30,21 +32,37 @@ namespace PluginBuilder
 		// Calls OnComplete(true) if the token is valid or was refreshed successfully.
 		virtual void RefreshTokenIfNeeded(TFunction<void(bool bSuccess)> OnComplete) = 0;
 
-		// Uploads a local file to the specified remote path.
+		// Uploads the file read by FileReader to the specified remote path.
+		// The file data must be read through FileReader, which shares it with the other destinations of the same file,
+		// and the reader must be released once the provider no longer needs it.
 		// OnComplete is called with (bSuccess, RemoteItemId).
 		// OnProgress is called periodically with a value from 0.0 to 1.0.
 		virtual void UploadFile(
-			const FString& LocalFilePath,
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
 			const FString& RemoteFilePath,
 			TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
 			TFunction<void(float Progress)> OnProgress
 		) = 0;
 
+		// Opens an upload session for the specified remote path ahead of time, including any remote folders it needs,
+		// so that a later UploadFile call for the same path can start sending bytes immediately.
+		// Providers without a session concept can leave this empty.
+		virtual void PrepareUpload(const FString& RemoteFilePath) {}
+
+		// Releases a session opened by PrepareUpload that is no longer going to be used.
+		virtual void DiscardPreparedUpload(const FString& RemoteFilePath) {}
+
+		// Computes the content hash of a local file in the same format that FindItem reports for remote items.
+		// Returns an empty string if this provider cannot compare file contents.
+		// This may be called from a worker thread, so it must not touch any state of the provider.
+		virtual FString ComputeContentHash(const FString& LocalFilePath) const { return FString(); }
+
 		// Looks up an existing item by its remote path without uploading.
-		// Calls OnComplete(true, ItemId) if the file exists, or OnComplete(false, FString()) if it does not.
+		// Calls OnComplete(true, ItemId, ContentHash) if the file exists, or OnComplete(false, FString(), FString()) if it does not.
+		// ContentHash is empty if the remote storage did not report a hash for the item.
 		virtual void FindItem(
 			const FString& RemoteFilePath,
-			TFunction<void(bool bFound, const FString& ItemId)> OnComplete
+			TFunction<void(bool bFound, const FString& ItemId, const FString& ContentHash)> OnComplete
 		) = 0;
 
 		// Creates a shareable URL for an already-uploaded item.
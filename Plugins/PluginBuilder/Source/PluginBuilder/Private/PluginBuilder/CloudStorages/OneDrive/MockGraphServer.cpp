@@ -0,0 +1,792 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/CloudStorages/OneDrive/MockGraphServer.h"
+#include "PluginBuilder/CloudStorages/OneDrive/OneDriveClient.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "PlatformHttp.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Async/Async.h"
+#include "HAL/RunnableThread.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+namespace PluginBuilder
+{
+	namespace MockGraphServer
+	{
+		// The path prefixes of the endpoints.
+		static const FString TokenPath = TEXT("/token");
+		static const FString ItemByPathPrefix = TEXT("/v1.0/me/drive/root:/");
+		static const FString ItemByIdPrefix = TEXT("/v1.0/me/drive/items/");
+		static const FString UploadPrefix = TEXT("/upload/");
+		static const FString CreateUploadSessionSuffix = TEXT(":/createUploadSession");
+		static const FString CreateLinkSuffix = TEXT("/createLink");
+
+		// Every chunk except the last one has to be a multiple of this size, as with the real service.
+		static constexpr int64 ChunkGranularity = (320 * 1024);
+
+		// The largest request header that is accepted.
+		static constexpr int32 MaxHeaderSize = (64 * 1024);
+
+		// The largest number of bytes read from a socket at once.
+		static constexpr int32 MaxReceiveSize = (64 * 1024);
+
+		// How long each socket wait lasts before checking whether the server is shutting down.
+		static const FTimespan PollInterval = FTimespan::FromMilliseconds(100);
+
+		// Returns the index at which the header of a request ends, or INDEX_NONE if it has not been received yet.
+		static int32 FindHeaderEnd(const TArray<uint8>& Buffer)
+		{
+			for (int32 Index = 0; Index + 3 < Buffer.Num(); Index++)
+			{
+				if (Buffer[Index] == '\r' && Buffer[Index + 1] == '\n' && Buffer[Index + 2] == '\r' && Buffer[Index + 3] == '\n')
+				{
+					return Index;
+				}
+			}
+			return INDEX_NONE;
+		}
+
+		// Returns the reason phrase of a status code.
+		static const TCHAR* GetReasonPhrase(const int32 Code)
+		{
+			switch (Code)
+			{
+			case 200: return TEXT("OK");
+			case 201: return TEXT("Created");
+			case 202: return TEXT("Accepted");
+			case 204: return TEXT("No Content");
+			case 400: return TEXT("Bad Request");
+			case 401: return TEXT("Unauthorized");
+			case 404: return TEXT("Not Found");
+			case 409: return TEXT("Conflict");
+			case 416: return TEXT("Requested Range Not Satisfiable");
+			case 503: return TEXT("Service Unavailable");
+			default: return TEXT("Unknown");
+			}
+		}
+
+		// Returns a JSON object serialized into a string.
+		static FString ToJsonString(const TSharedRef<FJsonObject>& JsonObject)
+		{
+			FString JsonString;
+			const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+			FJsonSerializer::Serialize(JsonObject, Writer);
+			return JsonString;
+		}
+
+		// Returns the expiry time of upload sessions in ISO 8601 format, like the real service.
+		static FString GetSessionExpirationDateTime()
+		{
+			return (FDateTime::UtcNow() + FTimespan::FromDays(1.)).ToIso8601();
+		}
+	}
+
+	int32 FMockGraphServerStats::GetNumRequests() const
+	{
+		int32 NumRequests = 0;
+		for (const auto& Pair : NumRequestsByEndpoint)
+		{
+			NumRequests += Pair.Value;
+		}
+		return NumRequests;
+	}
+
+	double FMockGraphServerStats::GetDurationPercentile(const float Percentile) const
+	{
+		if (RequestDurations.Num() == 0)
+		{
+			return 0.;
+		}
+
+		TArray<double> SortedDurations = RequestDurations;
+		SortedDurations.Sort();
+
+		const int32 Rank = FMath::CeilToInt(FMath::Clamp(Percentile, 0.f, 100.f) / 100.f * SortedDurations.Num());
+		return SortedDurations[FMath::Clamp(Rank - 1, 0, SortedDurations.Num() - 1)];
+	}
+
+	FMockGraphServer::FMockGraphServer(const FMockGraphServerSettings& InSettings)
+		: Settings(InSettings)
+		, ListenSocket(nullptr)
+		, Thread(nullptr)
+		, PortNo(0)
+		, bShouldStop(false)
+		, NumIssuedIds(0)
+		, LinkAvailableTime(0.)
+		, RandomStream(FPlatformTime::Cycles())
+	{
+	}
+
+	FMockGraphServer::~FMockGraphServer()
+	{
+		Shutdown();
+	}
+
+	bool FMockGraphServer::Start(const int32 InPortNo)
+	{
+		check(ListenSocket == nullptr);
+
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		if (SocketSubsystem == nullptr)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Mock Graph server: Failed to get socket subsystem."));
+			return false;
+		}
+
+		ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("MockGraphServerListener"), false);
+		if (ListenSocket == nullptr)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Mock Graph server: Failed to create listener socket."));
+			return false;
+		}
+
+		const TSharedRef<FInternetAddr> InternetAddress = SocketSubsystem->CreateInternetAddr();
+		InternetAddress->SetIp(0x7F000001); // 127.0.0.1
+		InternetAddress->SetPort(InPortNo);
+
+		ListenSocket->SetReuseAddr(true);
+		if (!ListenSocket->Bind(*InternetAddress) || !ListenSocket->Listen(16))
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Mock Graph server: Failed to bind/listen on port %d."), InPortNo);
+			SocketSubsystem->DestroySocket(ListenSocket);
+			ListenSocket = nullptr;
+			return false;
+		}
+
+		PortNo = ListenSocket->GetPortNo();
+		bShouldStop = false;
+		Thread = FRunnableThread::Create(this, TEXT("MockGraphServerThread"), 0, TPri_Normal);
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("Mock Graph server: Listening on %s."), *GetBaseUrl());
+		return true;
+	}
+
+	void FMockGraphServer::Shutdown()
+	{
+		if (ListenSocket == nullptr)
+		{
+			return;
+		}
+
+		bShouldStop = true;
+		if (Thread != nullptr)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+			Thread = nullptr;
+		}
+
+		// The accept loop has ended, so no more connections are added.
+		for (const TFuture<void>& ConnectionFuture : ConnectionFutures)
+		{
+			ConnectionFuture.Wait();
+		}
+		ConnectionFutures.Reset();
+
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+		ListenSocket = nullptr;
+	}
+
+	int32 FMockGraphServer::GetPortNo() const
+	{
+		return PortNo;
+	}
+
+	FOneDriveEndpoints FMockGraphServer::GetEndpoints() const
+	{
+		FOneDriveEndpoints Endpoints;
+		Endpoints.GraphUrl = GetBaseUrl() + TEXT("/v1.0");
+		Endpoints.TokenUrl = GetBaseUrl() + MockGraphServer::TokenPath;
+		Endpoints.RefreshToken = RefreshToken;
+		return Endpoints;
+	}
+
+	FMockGraphServerStats FMockGraphServer::GetStats() const
+	{
+		FScopeLock Lock(&CriticalSection);
+		return Stats;
+	}
+
+	uint32 FMockGraphServer::Run()
+	{
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		while (!bShouldStop)
+		{
+			bool bHasPendingConnection = false;
+			if (!ListenSocket->WaitForPendingConnection(bHasPendingConnection, MockGraphServer::PollInterval) || !bHasPendingConnection)
+			{
+				continue;
+			}
+
+			const TSharedRef<FInternetAddr> ClientAddr = SocketSubsystem->CreateInternetAddr();
+			FSocket* ClientSocket = ListenSocket->Accept(*ClientAddr, TEXT("MockGraphServerConnection"));
+			if (ClientSocket == nullptr)
+			{
+				continue;
+			}
+
+			// Each connection gets its own thread so that a slow upload does not hold up the other connections.
+			ConnectionFutures.Add(
+				Async(EAsyncExecution::Thread, [this, ClientSocket]()
+				{
+					HandleConnection(ClientSocket);
+				})
+			);
+		}
+
+		return 0;
+	}
+
+	void FMockGraphServer::Stop()
+	{
+		bShouldStop = true;
+	}
+
+	void FMockGraphServer::HandleConnection(FSocket* Socket)
+	{
+		TArray<uint8> Buffer;
+		FRequest Request;
+		while (!bShouldStop && ReceiveRequest(*Socket, Buffer, Request))
+		{
+			FString EndpointName;
+			const FResponse Response = HandleRequest(Request, EndpointName);
+
+			if (Settings.Latency > 0.)
+			{
+				FPlatformProcess::Sleep(static_cast<float>(Settings.Latency));
+			}
+
+			const bool bSent = SendResponse(*Socket, Response);
+
+			{
+				FScopeLock Lock(&CriticalSection);
+				Stats.NumRequestsByEndpoint.FindOrAdd(EndpointName)++;
+				Stats.NumBytesReceived += Request.Body.Num();
+				Stats.RequestDurations.Add(FPlatformTime::Seconds() - Request.StartTime);
+			}
+
+			const FString* Connection = Request.Headers.Find(TEXT("Connection"));
+			if (!bSent || (Connection != nullptr && Connection->Equals(TEXT("close"), ESearchCase::IgnoreCase)))
+			{
+				break;
+			}
+		}
+
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+	}
+
+	bool FMockGraphServer::ReceiveRequest(FSocket& Socket, TArray<uint8>& Buffer, FRequest& OutRequest)
+	{
+		int32 HeaderEnd = MockGraphServer::FindHeaderEnd(Buffer);
+		while (HeaderEnd == INDEX_NONE)
+		{
+			if (Buffer.Num() > MockGraphServer::MaxHeaderSize || !ReceiveMore(Socket, Buffer))
+			{
+				return false;
+			}
+			HeaderEnd = MockGraphServer::FindHeaderEnd(Buffer);
+		}
+
+		OutRequest = FRequest();
+		OutRequest.StartTime = FPlatformTime::Seconds();
+
+		const FUTF8ToTCHAR HeaderConverter(reinterpret_cast<const ANSICHAR*>(Buffer.GetData()), HeaderEnd);
+		const FString HeaderText(HeaderConverter.Length(), HeaderConverter.Get());
+		Buffer.RemoveAt(0, HeaderEnd + 4);
+
+		TArray<FString> Lines;
+		HeaderText.ParseIntoArray(Lines, TEXT("\r\n"));
+		if (Lines.Num() == 0)
+		{
+			return false;
+		}
+
+		// Request line: "PUT /upload/1 HTTP/1.1"
+		TArray<FString> RequestLine;
+		Lines[0].ParseIntoArrayWS(RequestLine);
+		if (RequestLine.Num() < 2)
+		{
+			return false;
+		}
+		OutRequest.Verb = RequestLine[0];
+		OutRequest.Path = RequestLine[1];
+
+		int32 QueryStart = INDEX_NONE;
+		if (OutRequest.Path.FindChar(TEXT('?'), QueryStart))
+		{
+			OutRequest.Path.LeftInline(QueryStart);
+		}
+
+		for (int32 LineIndex = 1; LineIndex < Lines.Num(); LineIndex++)
+		{
+			FString Name;
+			FString Value;
+			if (Lines[LineIndex].Split(TEXT(":"), &Name, &Value))
+			{
+				OutRequest.Headers.Add(Name.TrimStartAndEnd(), Value.TrimStartAndEnd());
+			}
+		}
+
+		const FString* ContentLengthString = OutRequest.Headers.Find(TEXT("Content-Length"));
+		const int64 ContentLength = (ContentLengthString != nullptr ? FCString::Atoi64(**ContentLengthString) : 0);
+		if (ContentLength < 0 || ContentLength > MAX_int32)
+		{
+			return false;
+		}
+
+		const FString* Expect = OutRequest.Headers.Find(TEXT("Expect"));
+		if (Expect != nullptr && Expect->Equals(TEXT("100-continue"), ESearchCase::IgnoreCase))
+		{
+			static const ANSICHAR ContinueResponse[] = "HTTP/1.1 100 Continue\r\n\r\n";
+			if (!SendAll(Socket, reinterpret_cast<const uint8*>(ContinueResponse), UE_ARRAY_COUNT(ContinueResponse) - 1))
+			{
+				return false;
+			}
+		}
+
+		while (Buffer.Num() < ContentLength)
+		{
+			if (!ReceiveMore(Socket, Buffer))
+			{
+				return false;
+			}
+		}
+
+		OutRequest.Body.Append(Buffer.GetData(), static_cast<int32>(ContentLength));
+		Buffer.RemoveAt(0, static_cast<int32>(ContentLength));
+
+		return true;
+	}
+
+	bool FMockGraphServer::ReceiveMore(FSocket& Socket, TArray<uint8>& Buffer)
+	{
+		// Small reads under a bandwidth limit keep the pacing smooth, and the unread data makes the client wait through TCP flow control.
+		int32 ReceiveSize = MockGraphServer::MaxReceiveSize;
+		if (Settings.Bandwidth > 0)
+		{
+			ReceiveSize = static_cast<int32>(FMath::Clamp<int64>(Settings.Bandwidth / 20, 1024, MockGraphServer::MaxReceiveSize));
+		}
+
+		while (!bShouldStop)
+		{
+			if (!Socket.Wait(ESocketWaitConditions::WaitForRead, MockGraphServer::PollInterval))
+			{
+				continue;
+			}
+
+			const int32 OldNum = Buffer.Num();
+			Buffer.AddUninitialized(ReceiveSize);
+
+			int32 BytesRead = 0;
+			const bool bReceived = Socket.Recv(Buffer.GetData() + OldNum, ReceiveSize, BytesRead);
+			Buffer.SetNum(OldNum + (bReceived ? BytesRead : 0));
+
+			// A readable socket with no data has been closed by the client.
+			if (!bReceived || BytesRead <= 0)
+			{
+				return false;
+			}
+
+			if (Settings.Bandwidth > 0)
+			{
+				double ReceiveEndTime;
+				{
+					FScopeLock Lock(&CriticalSection);
+					LinkAvailableTime = FMath::Max(LinkAvailableTime, FPlatformTime::Seconds()) + static_cast<double>(BytesRead) / Settings.Bandwidth;
+					ReceiveEndTime = LinkAvailableTime;
+				}
+
+				const double WaitTime = ReceiveEndTime - FPlatformTime::Seconds();
+				if (WaitTime > 0.)
+				{
+					FPlatformProcess::Sleep(static_cast<float>(WaitTime));
+				}
+			}
+
+			return true;
+		}
+
+		return false;
+	}
+
+	bool FMockGraphServer::SendAll(FSocket& Socket, const uint8* Data, const int32 Size)
+	{
+		int32 TotalSent = 0;
+		while (TotalSent < Size)
+		{
+			int32 BytesSent = 0;
+			if (!Socket.Send(Data + TotalSent, Size - TotalSent, BytesSent))
+			{
+				return false;
+			}
+			TotalSent += BytesSent;
+		}
+		return true;
+	}
+
+	bool FMockGraphServer::SendResponse(FSocket& Socket, const FResponse& Response)
+	{
+		const FTCHARToUTF8 BodyUtf8(*Response.Body);
+		const FString Header = FString::Printf(
+			TEXT("HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %d\r\nConnection: keep-alive\r\n%s\r\n"),
+			Response.Code,
+			MockGraphServer::GetReasonPhrase(Response.Code),
+			BodyUtf8.Length(),
+			(Response.Code == 503 ? TEXT("Retry-After: 1\r\n") : TEXT(""))
+		);
+		const FTCHARToUTF8 HeaderUtf8(*Header);
+
+		return SendAll(Socket, reinterpret_cast<const uint8*>(HeaderUtf8.Get()), HeaderUtf8.Length()) &&
+			SendAll(Socket, reinterpret_cast<const uint8*>(BodyUtf8.Get()), BodyUtf8.Length());
+	}
+
+	FMockGraphServer::FResponse FMockGraphServer::HandleRequest(const FRequest& Request, FString& OutEndpointName)
+	{
+		const FString& Path = Request.Path;
+
+		if (Path == MockGraphServer::TokenPath && Request.Verb == TEXT("POST"))
+		{
+			OutEndpointName = TEXT("token");
+			return HandleToken();
+		}
+
+		// Upload URLs are pre-authenticated, as with the real service.
+		if (Path.StartsWith(MockGraphServer::UploadPrefix))
+		{
+			const FString SessionId = Path.Mid(MockGraphServer::UploadPrefix.Len());
+			if (Request.Verb == TEXT("PUT"))
+			{
+				OutEndpointName = TEXT("uploadChunk");
+				if (ShouldInjectError())
+				{
+					return MakeErrorResponse(503, TEXT("serviceNotAvailable"));
+				}
+				return HandleUploadChunk(SessionId, Request);
+			}
+			if (Request.Verb == TEXT("DELETE"))
+			{
+				OutEndpointName = TEXT("deleteUploadSession");
+				return HandleDeleteUploadSession(SessionId);
+			}
+		}
+
+		if (Path.StartsWith(MockGraphServer::ItemByPathPrefix))
+		{
+			FString ItemPath = FPlatformHttp::UrlDecode(Path.Mid(MockGraphServer::ItemByPathPrefix.Len()));
+			const bool bIsCreateUploadSession = ItemPath.RemoveFromEnd(MockGraphServer::CreateUploadSessionSuffix);
+			OutEndpointName = (bIsCreateUploadSession ? TEXT("createUploadSession") : TEXT("getItem"));
+
+			if (!IsAuthorized(Request))
+			{
+				return MakeErrorResponse(401, TEXT("InvalidAuthenticationToken"));
+			}
+			if (ShouldInjectError())
+			{
+				return MakeErrorResponse(503, TEXT("serviceNotAvailable"));
+			}
+
+			if (bIsCreateUploadSession && Request.Verb == TEXT("POST"))
+			{
+				return HandleCreateUploadSession(ItemPath, Request);
+			}
+			if (!bIsCreateUploadSession && Request.Verb == TEXT("GET"))
+			{
+				return HandleGetItem(ItemPath);
+			}
+		}
+
+		if (Path.StartsWith(MockGraphServer::ItemByIdPrefix) && Path.EndsWith(MockGraphServer::CreateLinkSuffix) && Request.Verb == TEXT("POST"))
+		{
+			OutEndpointName = TEXT("createLink");
+
+			if (!IsAuthorized(Request))
+			{
+				return MakeErrorResponse(401, TEXT("InvalidAuthenticationToken"));
+			}
+			if (ShouldInjectError())
+			{
+				return MakeErrorResponse(503, TEXT("serviceNotAvailable"));
+			}
+
+			const FString ItemId = Path.Mid(
+				MockGraphServer::ItemByIdPrefix.Len(),
+				Path.Len() - MockGraphServer::ItemByIdPrefix.Len() - MockGraphServer::CreateLinkSuffix.Len()
+			);
+			return HandleCreateLink(ItemId);
+		}
+
+		UE_LOG(LogPluginBuilder, Warning, TEXT("Mock Graph server: Unsupported request: %s %s"), *Request.Verb, *Request.Path);
+		OutEndpointName = TEXT("unsupported");
+		return MakeErrorResponse(400, TEXT("invalidRequest"));
+	}
+
+	FMockGraphServer::FResponse FMockGraphServer::HandleToken()
+	{
+		// Every refresh succeeds; the refresh token sent by the client is not checked.
+		FString AccessToken;
+		{
+			FScopeLock Lock(&CriticalSection);
+			AccessToken = FString::Printf(TEXT("mock-access-token-%d"), ++NumIssuedIds);
+			AccessTokens.Add(AccessToken);
+		}
+
+		const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetStringField(TEXT("token_type"), TEXT("Bearer"));
+		JsonObject->SetStringField(TEXT("access_token"), AccessToken);
+		JsonObject->SetStringField(TEXT("refresh_token"), RefreshToken);
+		JsonObject->SetNumberField(TEXT("expires_in"), Settings.TokenLifetime);
+
+		FResponse Response;
+		Response.Body = MockGraphServer::ToJsonString(JsonObject);
+		return Response;
+	}
+
+	FMockGraphServer::FResponse FMockGraphServer::HandleGetItem(const FString& ItemPath)
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		const FItem* Item = Items.Find(ItemPath);
+		if (Item == nullptr)
+		{
+			return MakeErrorResponse(404, TEXT("itemNotFound"));
+		}
+
+		FResponse Response;
+		Response.Body = ItemToJson(ItemPath, *Item);
+		return Response;
+	}
+
+	FMockGraphServer::FResponse FMockGraphServer::HandleCreateUploadSession(const FString& ItemPath, const FRequest& Request)
+	{
+		// Only "fail" is enforced; "rename" and "replace" both overwrite the existing item.
+		const FUTF8ToTCHAR BodyConverter(reinterpret_cast<const ANSICHAR*>(Request.Body.GetData()), Request.Body.Num());
+		const FString BodyText(BodyConverter.Length(), BodyConverter.Get());
+		const bool bFailOnConflict = BodyText.Contains(TEXT("\"@microsoft.graph.conflictBehavior\":\"fail\""));
+
+		FString SessionId;
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			if (bFailOnConflict && Items.Contains(ItemPath))
+			{
+				return MakeErrorResponse(409, TEXT("nameAlreadyExists"));
+			}
+
+			SessionId = FString::Printf(TEXT("session-%d"), ++NumIssuedIds);
+			FUploadSession& Session = UploadSessions.Add(SessionId);
+			Session.ItemPath = ItemPath;
+		}
+
+		const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetStringField(TEXT("uploadUrl"), GetBaseUrl() + MockGraphServer::UploadPrefix + SessionId);
+		JsonObject->SetStringField(TEXT("expirationDateTime"), MockGraphServer::GetSessionExpirationDateTime());
+
+		FResponse Response;
+		Response.Body = MockGraphServer::ToJsonString(JsonObject);
+		return Response;
+	}
+
+	FMockGraphServer::FResponse FMockGraphServer::HandleUploadChunk(const FString& SessionId, const FRequest& Request)
+	{
+		// Content-Range: "bytes <first>-<last>/<total>"
+		int64 FirstByte = -1;
+		int64 LastByte = -1;
+		int64 TotalSize = -1;
+		const FString* ContentRange = Request.Headers.Find(TEXT("Content-Range"));
+		FString RangeAndTotal;
+		FString Range;
+		FString FirstString;
+		FString LastString;
+		FString TotalString;
+		if (ContentRange != nullptr &&
+			ContentRange->Split(TEXT(" "), nullptr, &RangeAndTotal) &&
+			RangeAndTotal.Split(TEXT("/"), &Range, &TotalString) &&
+			Range.Split(TEXT("-"), &FirstString, &LastString))
+		{
+			FirstByte = FCString::Atoi64(*FirstString);
+			LastByte = FCString::Atoi64(*LastString);
+			TotalSize = FCString::Atoi64(*TotalString);
+		}
+
+		const int64 ChunkLength = LastByte - FirstByte + 1;
+		if (FirstByte < 0 || ChunkLength <= 0 || LastByte >= TotalSize || ChunkLength != Request.Body.Num())
+		{
+			return MakeErrorResponse(400, TEXT("invalidRange"));
+		}
+
+		const bool bIsLastChunk = (LastByte == TotalSize - 1);
+		if (!bIsLastChunk && (ChunkLength % MockGraphServer::ChunkGranularity) != 0)
+		{
+			return MakeErrorResponse(400, TEXT("invalidRange"));
+		}
+
+		FScopeLock Lock(&CriticalSection);
+
+		FUploadSession* Session = UploadSessions.Find(SessionId);
+		if (Session == nullptr)
+		{
+			return MakeErrorResponse(404, TEXT("itemNotFound"));
+		}
+		if (FirstByte != Session->NextExpectedOffset || (Session->FileSize >= 0 && Session->FileSize != TotalSize))
+		{
+			return MakeErrorResponse(416, TEXT("invalidRange"));
+		}
+
+		Session->FileSize = TotalSize;
+		Session->NextExpectedOffset = LastByte + 1;
+		Session->Hash.Update(Request.Body.GetData(), ChunkLength);
+
+		FResponse Response;
+		if (!bIsLastChunk)
+		{
+			const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+			JsonObject->SetStringField(TEXT("expirationDateTime"), MockGraphServer::GetSessionExpirationDateTime());
+			TArray<TSharedPtr<FJsonValue>> NextExpectedRanges;
+			NextExpectedRanges.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%lld-"), Session->NextExpectedOffset)));
+			JsonObject->SetArrayField(TEXT("nextExpectedRanges"), NextExpectedRanges);
+
+			Response.Code = 202;
+			Response.Body = MockGraphServer::ToJsonString(JsonObject);
+			return Response;
+		}
+
+		const FString ItemPath = Session->ItemPath;
+		FItem NewItem;
+		NewItem.Id = FString::Printf(TEXT("MOCKITEM%d"), ++NumIssuedIds);
+		NewItem.Size = TotalSize;
+		NewItem.QuickXorHash = Session->Hash.Finalize();
+		UploadSessions.Remove(SessionId);
+
+		if (const FItem* OldItem = Items.Find(ItemPath))
+		{
+			ItemPathsById.Remove(OldItem->Id);
+		}
+		Items.Add(ItemPath, NewItem);
+		ItemPathsById.Add(NewItem.Id, ItemPath);
+
+		Response.Code = 201;
+		Response.Body = ItemToJson(ItemPath, NewItem);
+		return Response;
+	}
+
+	FMockGraphServer::FResponse FMockGraphServer::HandleDeleteUploadSession(const FString& SessionId)
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		if (UploadSessions.Remove(SessionId) == 0)
+		{
+			return MakeErrorResponse(404, TEXT("itemNotFound"));
+		}
+
+		FResponse Response;
+		Response.Code = 204;
+		return Response;
+	}
+
+	FMockGraphServer::FResponse FMockGraphServer::HandleCreateLink(const FString& ItemId)
+	{
+		{
+			FScopeLock Lock(&CriticalSection);
+			if (!ItemPathsById.Contains(ItemId))
+			{
+				return MakeErrorResponse(404, TEXT("itemNotFound"));
+			}
+		}
+
+		const TSharedRef<FJsonObject> LinkObject = MakeShared<FJsonObject>();
+		LinkObject->SetStringField(TEXT("type"), TEXT("edit"));
+		LinkObject->SetStringField(TEXT("scope"), TEXT("anonymous"));
+		LinkObject->SetStringField(TEXT("webUrl"), FString::Printf(TEXT("%s/share/%s"), *GetBaseUrl(), *ItemId));
+
+		const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetStringField(TEXT("id"), FString::Printf(TEXT("link-%s"), *ItemId));
+		JsonObject->SetObjectField(TEXT("link"), LinkObject);
+
+		FResponse Response;
+		Response.Code = 201;
+		Response.Body = MockGraphServer::ToJsonString(JsonObject);
+		return Response;
+	}
+
+	bool FMockGraphServer::IsAuthorized(const FRequest& Request) const
+	{
+		const FString* Authorization = Request.Headers.Find(TEXT("Authorization"));
+		if (Authorization == nullptr)
+		{
+			return false;
+		}
+
+		FString AccessToken = *Authorization;
+		if (!AccessToken.RemoveFromStart(TEXT("Bearer ")))
+		{
+			return false;
+		}
+
+		FScopeLock Lock(&CriticalSection);
+		return AccessTokens.Contains(AccessToken);
+	}
+
+	bool FMockGraphServer::ShouldInjectError()
+	{
+		if (Settings.ErrorRate <= 0.f)
+		{
+			return false;
+		}
+
+		FScopeLock Lock(&CriticalSection);
+		if (RandomStream.GetFraction() >= Settings.ErrorRate)
+		{
+			return false;
+		}
+
+		Stats.NumInjectedErrors++;
+		return true;
+	}
+
+	FString FMockGraphServer::ItemToJson(const FString& ItemPath, const FItem& Item)
+	{
+		const TSharedRef<FJsonObject> HashesObject = MakeShared<FJsonObject>();
+		HashesObject->SetStringField(TEXT("quickXorHash"), Item.QuickXorHash);
+
+		const TSharedRef<FJsonObject> FileObject = MakeShared<FJsonObject>();
+		FileObject->SetStringField(TEXT("mimeType"), TEXT("application/octet-stream"));
+		FileObject->SetObjectField(TEXT("hashes"), HashesObject);
+
+		const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetStringField(TEXT("id"), Item.Id);
+		JsonObject->SetStringField(TEXT("name"), FPaths::GetCleanFilename(ItemPath));
+		JsonObject->SetNumberField(TEXT("size"), static_cast<double>(Item.Size));
+		JsonObject->SetObjectField(TEXT("file"), FileObject);
+		return MockGraphServer::ToJsonString(JsonObject);
+	}
+
+	FMockGraphServer::FResponse FMockGraphServer::MakeErrorResponse(const int32 Code, const FString& ErrorCode)
+	{
+		const TSharedRef<FJsonObject> ErrorObject = MakeShared<FJsonObject>();
+		ErrorObject->SetStringField(TEXT("code"), ErrorCode);
+		ErrorObject->SetStringField(TEXT("message"), FString::Printf(TEXT("Mock Graph server: %s"), *ErrorCode));
+
+		const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetObjectField(TEXT("error"), ErrorObject);
+
+		FResponse Response;
+		Response.Code = Code;
+		Response.Body = MockGraphServer::ToJsonString(JsonObject);
+		return Response;
+	}
+
+	FString FMockGraphServer::GetBaseUrl() const
+	{
+		return FString::Printf(TEXT("http://127.0.0.1:%d"), PortNo);
+	}
+
+	const FString FMockGraphServer::RefreshToken = TEXT("mock-refresh-token");
+}
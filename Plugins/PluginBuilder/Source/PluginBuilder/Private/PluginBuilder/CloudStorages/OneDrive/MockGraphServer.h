@@ -0,0 +1,249 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Async/Future.h"
+#include "Math/RandomStream.h"
+#include "PluginBuilder/CloudStorages/OneDrive/QuickXorHash.h"
+
+class FSocket;
+class FRunnableThread;
+
+namespace PluginBuilder
+{
+	struct FOneDriveEndpoints;
+
+	/**
+	 * The network conditions that FMockGraphServer simulates.
+	 */
+	struct FMockGraphServerSettings
+	{
+	public:
+		// The delay in seconds added before each response is sent.
+		double Latency = 0.;
+
+		// The rate in bytes per second at which request data is received, shared by all connections. 0 means unlimited.
+		int64 Bandwidth = 0;
+
+		// The probability in [0, 1] that a Graph API request fails with 503 Service Unavailable.
+		float ErrorRate = 0.f;
+
+		// The lifetime in seconds of the access tokens that the token endpoint issues.
+		int32 TokenLifetime = 3600;
+	};
+
+	/**
+	 * The request statistics collected by FMockGraphServer.
+	 */
+	struct FMockGraphServerStats
+	{
+	public:
+		// The number of requests received, keyed by endpoint name such as "uploadChunk".
+		TMap<FString, int32> NumRequestsByEndpoint;
+
+		// The number of requests that were failed on purpose by the error rate.
+		int32 NumInjectedErrors = 0;
+
+		// The number of request body bytes received.
+		int64 NumBytesReceived = 0;
+
+		// The time in seconds that each request took, from the end of its header to the end of its response.
+		TArray<double> RequestDurations;
+
+	public:
+		// Returns the total number of requests received.
+		int32 GetNumRequests() const;
+
+		// Returns the request duration in seconds below which the specified percentage of requests finished.
+		double GetDurationPercentile(float Percentile) const;
+	};
+
+	/**
+	 * A local stand-in for the parts of the Microsoft Graph API and the Microsoft identity platform that FOneDriveClient uses.
+	 * Implements the token, item lookup, createUploadSession, ranged PUT, upload session DELETE and createLink endpoints
+	 * over plain HTTP on 127.0.0.1, with injectable latency, bandwidth and error rate.
+	 * Uploaded files are only hashed, not stored, so that large uploads can be simulated without using memory.
+	 */
+	class FMockGraphServer : public FRunnable
+	{
+	public:
+		// Constructor.
+		explicit FMockGraphServer(const FMockGraphServerSettings& InSettings);
+
+		// Destructor.
+		virtual ~FMockGraphServer() override;
+
+		// Starts listening on the specified port, or on any free port if 0. Returns whether the server started.
+		bool Start(int32 InPortNo = 0);
+
+		// Stops listening and waits for all connections to close.
+		void Shutdown();
+
+		// Returns the port the server listens on.
+		int32 GetPortNo() const;
+
+		// Returns the endpoints that make a FOneDriveClient talk to this server.
+		FOneDriveEndpoints GetEndpoints() const;
+
+		// Returns a copy of the statistics collected so far.
+		FMockGraphServerStats GetStats() const;
+
+		// FRunnable interface.
+		virtual uint32 Run() override;
+		virtual void Stop() override;
+		// End of FRunnable interface.
+
+	private:
+		// A received HTTP request.
+		struct FRequest
+		{
+		public:
+			// The method, such as "PUT".
+			FString Verb;
+
+			// The request target without the query string.
+			FString Path;
+
+			// The header fields, keyed by name.
+			TMap<FString, FString> Headers;
+
+			// The body.
+			TArray<uint8> Body;
+
+			// The time at which the header was received, in seconds.
+			double StartTime = 0.;
+		};
+
+		// An HTTP response to send.
+		struct FResponse
+		{
+		public:
+			// The status code.
+			int32 Code = 200;
+
+			// The JSON body, or empty for no body.
+			FString Body;
+		};
+
+		// A file stored on the mock drive.
+		struct FItem
+		{
+		public:
+			// The item ID.
+			FString Id;
+
+			// The size in bytes.
+			int64 Size = 0;
+
+			// The base64 encoded QuickXorHash of the contents.
+			FString QuickXorHash;
+		};
+
+		// An upload session created by createUploadSession.
+		struct FUploadSession
+		{
+		public:
+			// The path of the item being uploaded.
+			FString ItemPath;
+
+			// The size of the file declared by the first chunk, or -1 until then.
+			int64 FileSize = -1;
+
+			// The offset of the next byte the session expects.
+			int64 NextExpectedOffset = 0;
+
+			// The hash of the bytes received so far.
+			FQuickXorHash Hash;
+		};
+
+	private:
+		// Serves the requests of a connection until it is closed. Runs on its own thread.
+		void HandleConnection(FSocket* Socket);
+
+		// Receives the next request of a connection. Returns false if the connection was closed.
+		bool ReceiveRequest(FSocket& Socket, TArray<uint8>& Buffer, FRequest& OutRequest);
+
+		// Receives more data into the buffer, paced by the bandwidth setting. Returns false if the connection was closed.
+		bool ReceiveMore(FSocket& Socket, TArray<uint8>& Buffer);
+
+		// Sends all of the specified bytes. Returns false if the connection was closed.
+		static bool SendAll(FSocket& Socket, const uint8* Data, int32 Size);
+
+		// Sends a response. Returns false if the connection was closed.
+		static bool SendResponse(FSocket& Socket, const FResponse& Response);
+
+		// Dispatches a request to its endpoint and returns the endpoint name used for the statistics.
+		FResponse HandleRequest(const FRequest& Request, FString& OutEndpointName);
+
+		// The endpoints.
+		FResponse HandleToken();
+		FResponse HandleGetItem(const FString& ItemPath);
+		FResponse HandleCreateUploadSession(const FString& ItemPath, const FRequest& Request);
+		FResponse HandleUploadChunk(const FString& SessionId, const FRequest& Request);
+		FResponse HandleDeleteUploadSession(const FString& SessionId);
+		FResponse HandleCreateLink(const FString& ItemId);
+
+		// Returns whether the request carries an access token issued by this server.
+		bool IsAuthorized(const FRequest& Request) const;
+
+		// Returns whether the request should fail on purpose, according to the error rate.
+		bool ShouldInjectError();
+
+		// Returns the JSON representation of an item.
+		static FString ItemToJson(const FString& ItemPath, const FItem& Item);
+
+		// Returns a Graph API style error response.
+		static FResponse MakeErrorResponse(int32 Code, const FString& ErrorCode);
+
+		// Returns the base URL of the server, such as "http://127.0.0.1:12345".
+		FString GetBaseUrl() const;
+
+	private:
+		// The simulated network conditions.
+		FMockGraphServerSettings Settings;
+
+		// The socket that accepts connections and the thread that runs the accept loop.
+		FSocket* ListenSocket;
+		FRunnableThread* Thread;
+
+		// The port the server listens on.
+		int32 PortNo;
+
+		// Set when the server is shutting down.
+		FThreadSafeBool bShouldStop;
+
+		// The threads serving connections.
+		TArray<TFuture<void>> ConnectionFutures;
+
+		// Guards all of the state below, which is shared by the connection threads.
+		mutable FCriticalSection CriticalSection;
+
+		// The stored files keyed by item path, and their paths keyed by item ID.
+		TMap<FString, FItem> Items;
+		TMap<FString, FString> ItemPathsById;
+
+		// The open upload sessions keyed by session ID.
+		TMap<FString, FUploadSession> UploadSessions;
+
+		// The access tokens that have been issued.
+		TSet<FString> AccessTokens;
+
+		// The number of IDs issued so far, used to make item and session IDs.
+		int32 NumIssuedIds;
+
+		// The time at which the simulated link is free to receive more data, in seconds.
+		double LinkAvailableTime;
+
+		// The random stream used for error injection.
+		FRandomStream RandomStream;
+
+		// The statistics collected so far.
+		FMockGraphServerStats Stats;
+
+		// The refresh token that the server accepts.
+		static const FString RefreshToken;
+	};
+}
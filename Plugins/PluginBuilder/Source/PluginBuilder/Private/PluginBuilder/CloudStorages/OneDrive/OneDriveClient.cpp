@@ -1,24 +1,37 @@
 // Copyright 2022-2026 Naotsun. All Rights Reserved.
 
 #include "PluginBuilder/CloudStorages/OneDrive/OneDriveClient.h"
+#include "PluginBuilder/CloudStorages/OneDrive/QuickXorHash.h"
+#include "PluginBuilder/CloudStorages/UploadBandwidthThrottle.h"
 #include "PluginBuilder/Utilities/OneDriveSettings.h"
 #include "PluginBuilder/Utilities/PluginBuilderPackagingSettings.h"
 #include "PluginBuilder/Utilities/PluginBuilderSettings.h"
+#include "PluginBuilder/Utilities/PackageTrace.h"
 #include "PluginBuilder/PluginBuilderGlobals.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 #include "PlatformHttp.h"
 #include "Dom/JsonObject.h"
+#include "Async/Async.h"
 #include "Serialization/JsonSerializer.h"
 #include "Misc/DateTime.h"
-#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "HAL/PlatformFileManager.h"
-#include "HAL/PlatformFile.h"
+#include "Containers/Ticker.h"
 
 namespace PluginBuilder
 {
+	FOneDriveClient::FOneDriveClient()
+		: InMemoryTokenExpiryTime(0)
+	{
+	}
+
+	FOneDriveClient::FOneDriveClient(const FOneDriveEndpoints& InEndpoints)
+		: Endpoints(InEndpoints)
+		, InMemoryTokenExpiryTime(0)
+	{
+	}
+
 	FString FOneDriveClient::GetProviderName() const
 	{
 		return TEXT("OneDrive");
@@ -32,6 +45,11 @@ namespace PluginBuilder
 
 	bool FOneDriveClient::IsAuthenticated() const
 	{
+		if (UsesInMemoryTokens())
+		{
+			return true;
+		}
+
 		const auto& Settings = GetSettings<UOneDriveSettings>();
 		return Settings.IsAuthenticated();
 	}
@@ -39,7 +57,7 @@ namespace PluginBuilder
 	void FOneDriveClient::RefreshTokenIfNeeded(TFunction<void(bool bSuccess)> OnComplete)
 	{
 		const auto& Settings = GetSettings<UOneDriveSettings>();
-		if (!Settings.IsAuthenticated())
+		if (!IsAuthenticated())
 		{
 			UE_LOG(LogPluginBuilder, Error, TEXT("OneDrive: Not authenticated. Please sign in from editor preferences."));
 			OnComplete(false);
@@ -47,7 +65,8 @@ namespace PluginBuilder
 		}
 
 		const int64 NowUnix = FDateTime::UtcNow().ToUnixTimestamp();
-		if (NowUnix < Settings.GetTokenExpiryTime())
+		const int64 TokenExpiryTime = (UsesInMemoryTokens() ? InMemoryTokenExpiryTime : Settings.GetTokenExpiryTime());
+		if (NowUnix < TokenExpiryTime)
 		{
 			// Token is still valid.
 			OnComplete(true);
@@ -58,7 +77,7 @@ namespace PluginBuilder
 		UE_LOG(LogPluginBuilder, Log, TEXT("OneDrive: Access token expired. Refreshing..."));
 
 		const FString& ClientId = Settings.ClientId;
-		const FString RefreshToken = Settings.GetRefreshToken();
+		const FString RefreshToken = (UsesInMemoryTokens() ? Endpoints.RefreshToken : Settings.GetRefreshToken());
 
 		const FString Body = FString::Printf(
 			TEXT("client_id=%s&refresh_token=%s&grant_type=refresh_token&scope=Files.ReadWrite%%20offline_access%%20User.Read"),
@@ -67,12 +86,12 @@ namespace PluginBuilder
 		);
 
 		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(TEXT("https://login.microsoftonline.com/consumers/oauth2/v2.0/token"));
+		Request->SetURL(Endpoints.TokenUrl);
 		Request->SetVerb(TEXT("POST"));
 		Request->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
 		Request->SetContentAsString(Body);
 		Request->OnProcessRequestComplete().BindLambda(
-			[OnComplete, &Settings](FHttpRequestPtr /* Request */, FHttpResponsePtr Response, bool bConnected)
+			[this, OnComplete, &Settings](FHttpRequestPtr /* Request */, FHttpResponsePtr Response, bool bConnected)
 			{
 				if (!bConnected || !Response.IsValid() || Response->GetResponseCode() != 200)
 				{
@@ -106,10 +125,22 @@ namespace PluginBuilder
 				}
 
 				const int64 NewExpiry = FDateTime::UtcNow().ToUnixTimestamp() + static_cast<int64>(ExpiresIn) - 60;
-				const FString CurrentDisplayName = Settings.UserDisplayName;
-				const FString RefreshToStore = NewRefreshToken.IsEmpty() ? Settings.GetRefreshToken() : NewRefreshToken;
-				const_cast<UOneDriveSettings&>(Settings).StoreTokens(NewAccessToken, RefreshToStore, NewExpiry, CurrentDisplayName);
-				const_cast<UOneDriveSettings&>(Settings).SaveConfig();
+				if (UsesInMemoryTokens())
+				{
+					InMemoryAccessToken = NewAccessToken;
+					InMemoryTokenExpiryTime = NewExpiry;
+					if (!NewRefreshToken.IsEmpty())
+					{
+						Endpoints.RefreshToken = NewRefreshToken;
+					}
+				}
+				else
+				{
+					const FString CurrentDisplayName = Settings.UserDisplayName;
+					const FString RefreshToStore = NewRefreshToken.IsEmpty() ? Settings.GetRefreshToken() : NewRefreshToken;
+					const_cast<UOneDriveSettings&>(Settings).StoreTokens(NewAccessToken, RefreshToStore, NewExpiry, CurrentDisplayName);
+					const_cast<UOneDriveSettings&>(Settings).SaveConfig();
+				}
 
 				UE_LOG(LogPluginBuilder, Log, TEXT("OneDrive: Access token refreshed successfully."));
 				OnComplete(true);
@@ -118,9 +149,14 @@ namespace PluginBuilder
 		Request->ProcessRequest();
 	}
 
+	FString FOneDriveClient::ComputeContentHash(const FString& LocalFilePath) const
+	{
+		return FQuickXorHash::HashFile(LocalFilePath);
+	}
+
 	void FOneDriveClient::FindItem(
 		const FString& RemoteFilePath,
-		TFunction<void(bool bFound, const FString& ItemId)> OnComplete
+		TFunction<void(bool bFound, const FString& ItemId, const FString& ContentHash)> OnComplete
 	)
 	{
 		RefreshTokenIfNeeded(
@@ -128,14 +164,15 @@ namespace PluginBuilder
 			{
 				if (!bTokenOk)
 				{
-					OnComplete(false, FString());
+					OnComplete(false, FString(), FString());
 					return;
 				}
 
-				const FString AccessToken = GetSettings<UOneDriveSettings>().GetAccessToken();
+				const FString AccessToken = GetAccessToken();
 				const FString EncodedPath = FPlatformHttp::UrlEncode(RemoteFilePath).Replace(TEXT("%2F"), TEXT("/"));
 				const FString ApiUrl = FString::Printf(
-					TEXT("https://graph.microsoft.com/v1.0/me/drive/root:/%s"),
+					TEXT("%s/me/drive/root:/%s"),
+					*Endpoints.GraphUrl,
 					*EncodedPath
 				);
 
@@ -148,32 +185,42 @@ namespace PluginBuilder
 					{
 						if (!bConnected || !Response.IsValid())
 						{
-							OnComplete(false, FString());
+							OnComplete(false, FString(), FString());
 							return;
 						}
 
 						const int32 Code = Response->GetResponseCode();
 						if (Code == 404)
 						{
-							OnComplete(false, FString());
+							OnComplete(false, FString(), FString());
 							return;
 						}
 
 						if (Code != 200)
 						{
 							UE_LOG(LogPluginBuilder, Warning, TEXT("OneDrive: FindItem returned unexpected code %d."), Code);
-							OnComplete(false, FString());
+							OnComplete(false, FString(), FString());
 							return;
 						}
 
 						TSharedPtr<FJsonObject> Json;
 						const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
 						FString ItemId;
+						FString ContentHash;
 						if (FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid())
 						{
 							Json->TryGetStringField(TEXT("id"), ItemId);
+
+							// OneDrive reports the content hash as file.hashes.quickXorHash for every file.
+							const TSharedPtr<FJsonObject>* FileObject = nullptr;
+							const TSharedPtr<FJsonObject>* HashesObject = nullptr;
+							if (Json->TryGetObjectField(TEXT("file"), FileObject) &&
+								(*FileObject)->TryGetObjectField(TEXT("hashes"), HashesObject))
+							{
+								(*HashesObject)->TryGetStringField(TEXT("quickXorHash"), ContentHash);
+							}
 						}
-						OnComplete(!ItemId.IsEmpty(), ItemId);
+						OnComplete(!ItemId.IsEmpty(), ItemId, ContentHash);
 					}
 				);
 				Request->ProcessRequest();
@@ -182,13 +229,61 @@ namespace PluginBuilder
 	}
 
 	void FOneDriveClient::UploadFile(
-		const FString& LocalFilePath,
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+		const FString& RemoteFilePath,
+		TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+		TFunction<void(float Progress)> OnProgress
+	)
+	{
+		TSharedPtr<FPreparedUploadSession> PreparedSession;
+		if (const TSharedRef<FPreparedUploadSession>* FoundSession = PreparedUploadSessions.Find(RemoteFilePath))
+		{
+			PreparedSession = *FoundSession;
+			PreparedUploadSessions.Remove(RemoteFilePath);
+		}
+
+		if (!PreparedSession.IsValid())
+		{
+			UploadFileWithNewSession(FileReader, RemoteFilePath, OnComplete, OnProgress);
+			return;
+		}
+
+		TFunction<void(bool, const FString&)> OnSessionReady =
+			[this, FileReader, RemoteFilePath, OnComplete, OnProgress](bool bSessionOk, const FString& UploadUrl)
+			{
+				if (!bSessionOk)
+				{
+					// The speculative session could not be used; fall back to the regular path.
+					UploadFileWithNewSession(FileReader, RemoteFilePath, OnComplete, OnProgress);
+					return;
+				}
+				UploadChunks(UploadUrl, FileReader, OnComplete, OnProgress);
+			};
+
+		if (PreparedSession->bIsPending)
+		{
+			PreparedSession->Waiters.Add(MoveTemp(OnSessionReady));
+			return;
+		}
+
+		// Leave some margin so that the session does not expire in the middle of the upload.
+		const int64 NowUnix = FDateTime::UtcNow().ToUnixTimestamp();
+		const bool bIsUsable = (!PreparedSession->UploadUrl.IsEmpty() && (NowUnix + 60 < PreparedSession->ExpiryTime));
+		if (!bIsUsable && !PreparedSession->UploadUrl.IsEmpty())
+		{
+			DeleteUploadSession(PreparedSession->UploadUrl);
+		}
+		OnSessionReady(bIsUsable, PreparedSession->UploadUrl);
+	}
+
+	void FOneDriveClient::UploadFileWithNewSession(
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
 		const FString& RemoteFilePath,
 		TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
 		TFunction<void(float Progress)> OnProgress
 	)
 	{
-		RefreshTokenIfNeeded([this, LocalFilePath, RemoteFilePath, OnComplete, OnProgress](bool bTokenOk)
+		RefreshTokenIfNeeded([this, FileReader, RemoteFilePath, OnComplete, OnProgress](bool bTokenOk)
 		{
 			if (!bTokenOk)
 			{
@@ -196,19 +291,89 @@ namespace PluginBuilder
 				return;
 			}
 
-			const FString AccessToken = GetSettings<UOneDriveSettings>().GetAccessToken();
-			CreateUploadSession(RemoteFilePath, AccessToken, [this, LocalFilePath, OnComplete, OnProgress](bool bSessionOk, const FString& UploadUrl)
+			const FString AccessToken = GetAccessToken();
+			CreateUploadSession(RemoteFilePath, AccessToken, [this, FileReader, OnComplete, OnProgress](bool bSessionOk, const FString& UploadUrl, int64 /* ExpiryTime */)
 			{
 				if (!bSessionOk)
 				{
 					OnComplete(false, FString());
 					return;
 				}
-				UploadChunks(UploadUrl, LocalFilePath, OnComplete, OnProgress);
+				UploadChunks(UploadUrl, FileReader, OnComplete, OnProgress);
 			});
 		});
 	}
 
+	void FOneDriveClient::PrepareUpload(const FString& RemoteFilePath)
+	{
+		if (PreparedUploadSessions.Contains(RemoteFilePath))
+		{
+			return;
+		}
+
+		// Ignore has to look up the existing item before deciding whether to upload, so there is nothing to prepare.
+		if (GetSettings<UPluginBuilderPackagingSettings>().ConflictBehavior == EOneDriveConflictBehavior::Ignore)
+		{
+			return;
+		}
+
+		const TSharedRef<FPreparedUploadSession> Session = MakeShared<FPreparedUploadSession>();
+		PreparedUploadSessions.Add(RemoteFilePath, Session);
+
+		UE_LOG(LogPluginBuilder, Verbose, TEXT("OneDrive: Opening upload session ahead of time for %s."), *RemoteFilePath);
+
+		auto CompleteSession = [Session](bool bSessionOk, const FString& UploadUrl, int64 ExpiryTime)
+		{
+			Session->bIsPending = false;
+			Session->UploadUrl = (bSessionOk ? UploadUrl : FString());
+			Session->ExpiryTime = ExpiryTime;
+
+			if (Session->bIsDiscarded)
+			{
+				if (!Session->UploadUrl.IsEmpty())
+				{
+					DeleteUploadSession(Session->UploadUrl);
+				}
+				return;
+			}
+
+			TArray<TFunction<void(bool, const FString&)>> Waiters = MoveTemp(Session->Waiters);
+			for (const auto& Waiter : Waiters)
+			{
+				Waiter(!Session->UploadUrl.IsEmpty(), Session->UploadUrl);
+			}
+		};
+
+		// The Graph API creates any missing parent folders of the item path when the session is created,
+		// so no separate folder creation requests are needed.
+		RefreshTokenIfNeeded([this, RemoteFilePath, CompleteSession](bool bTokenOk)
+		{
+			if (!bTokenOk)
+			{
+				CompleteSession(false, FString(), 0);
+				return;
+			}
+
+			const FString AccessToken = GetAccessToken();
+			CreateUploadSession(RemoteFilePath, AccessToken, CompleteSession);
+		});
+	}
+
+	void FOneDriveClient::DiscardPreparedUpload(const FString& RemoteFilePath)
+	{
+		TSharedRef<FPreparedUploadSession> Session = MakeShared<FPreparedUploadSession>();
+		if (!PreparedUploadSessions.RemoveAndCopyValue(RemoteFilePath, Session))
+		{
+			return;
+		}
+
+		Session->bIsDiscarded = true;
+		if (!Session->bIsPending && !Session->UploadUrl.IsEmpty())
+		{
+			DeleteUploadSession(Session->UploadUrl);
+		}
+	}
+
 	void FOneDriveClient::GetShareUrl(
 		const FString& RemoteItemId,
 		TFunction<void(bool bSuccess, const FString& ShareUrl)> OnComplete
@@ -222,9 +387,10 @@ namespace PluginBuilder
 				return;
 			}
 
-			const FString AccessToken = GetSettings<UOneDriveSettings>().GetAccessToken();
+			const FString AccessToken = GetAccessToken();
 			const FString Url = FString::Printf(
-				TEXT("https://graph.microsoft.com/v1.0/me/drive/items/%s/createLink"),
+				TEXT("%s/me/drive/items/%s/createLink"),
+				*Endpoints.GraphUrl,
 				*RemoteItemId
 			);
 
@@ -275,16 +441,27 @@ namespace PluginBuilder
 		});
 	}
 
+	bool FOneDriveClient::UsesInMemoryTokens() const
+	{
+		return !Endpoints.RefreshToken.IsEmpty();
+	}
+
+	FString FOneDriveClient::GetAccessToken() const
+	{
+		return (UsesInMemoryTokens() ? InMemoryAccessToken : GetSettings<UOneDriveSettings>().GetAccessToken());
+	}
+
 	void FOneDriveClient::CreateUploadSession(
 		const FString& RemoteFilePath,
 		const FString& AccessToken,
-		TFunction<void(bool bSuccess, const FString& UploadUrl)> OnComplete
+		TFunction<void(bool bSuccess, const FString& UploadUrl, int64 ExpiryTime)> OnComplete
 	)
 	{
 		// Graph API path: me/drive/root:/{remote path}:/createUploadSession
 		const FString EncodedPath = FPlatformHttp::UrlEncode(RemoteFilePath).Replace(TEXT("%2F"), TEXT("/"));
 		const FString ApiUrl = FString::Printf(
-			TEXT("https://graph.microsoft.com/v1.0/me/drive/root:/%s:/createUploadSession"),
+			TEXT("%s/me/drive/root:/%s:/createUploadSession"),
+			*Endpoints.GraphUrl,
 			*EncodedPath
 		);
 
@@ -307,7 +484,7 @@ namespace PluginBuilder
 				{
 					UE_LOG(LogPluginBuilder, Error, TEXT("OneDrive: createUploadSession failed. Code: %d"),
 						Response.IsValid() ? Response->GetResponseCode() : -1);
-					OnComplete(false, FString());
+					OnComplete(false, FString(), 0);
 					return;
 				}
 
@@ -315,57 +492,115 @@ namespace PluginBuilder
 				const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
 				if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
 				{
-					OnComplete(false, FString());
+					OnComplete(false, FString(), 0);
 					return;
 				}
 
 				FString UploadUrl;
 				Json->TryGetStringField(TEXT("uploadUrl"), UploadUrl);
-				OnComplete(!UploadUrl.IsEmpty(), UploadUrl);
+
+				// Upload sessions are valid for several days; fall back to a conservative lifetime if the expiry is missing.
+				int64 ExpiryTime = FDateTime::UtcNow().ToUnixTimestamp() + 3600;
+				FString ExpirationDateTimeString;
+				FDateTime ExpirationDateTime;
+				if (Json->TryGetStringField(TEXT("expirationDateTime"), ExpirationDateTimeString) &&
+					FDateTime::ParseIso8601(*ExpirationDateTimeString, ExpirationDateTime))
+				{
+					ExpiryTime = ExpirationDateTime.ToUnixTimestamp();
+				}
+
+				OnComplete(!UploadUrl.IsEmpty(), UploadUrl, ExpiryTime);
 			}
 		);
 		Request->ProcessRequest();
 	}
 
+	void FOneDriveClient::DeleteUploadSession(const FString& UploadUrl)
+	{
+		// The upload URL is pre-authenticated, so no Authorization header is needed.
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+		Request->SetURL(UploadUrl);
+		Request->SetVerb(TEXT("DELETE"));
+		Request->ProcessRequest();
+	}
+
 	void FOneDriveClient::UploadChunks(
 		const FString& UploadUrl,
-		const FString& LocalFilePath,
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
 		TFunction<void(bool bSuccess, const FString& ItemId)> OnComplete,
 		TFunction<void(float Progress)> OnProgress
 	)
 	{
-		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-		if (!PlatformFile.FileExists(*LocalFilePath))
-		{
-			UE_LOG(LogPluginBuilder, Error, TEXT("OneDrive: Local file not found: %s"), *LocalFilePath);
-			OnComplete(false, FString());
-			return;
-		}
+		UE_LOG(LogPluginBuilder, Log, TEXT("OneDrive: Uploading %s (%lld bytes)..."), *FPaths::GetCleanFilename(FileReader->GetFilePath()), FileReader->GetFileSize());
 
-		TArray<uint8> FileData;
-		if (!FFileHelper::LoadFileToArray(FileData, *LocalFilePath))
-		{
-			UE_LOG(LogPluginBuilder, Error, TEXT("OneDrive: Failed to read file: %s"), *LocalFilePath);
-			OnComplete(false, FString());
-			return;
-		}
+		UploadNextChunk(UploadUrl, FileReader, 0, OnComplete, OnProgress);
+	}
 
-		UE_LOG(LogPluginBuilder, Log, TEXT("OneDrive: Uploading %s (%lld bytes)..."), *FPaths::GetCleanFilename(LocalFilePath), static_cast<int64>(FileData.Num()));
+	void FOneDriveClient::UploadNextChunk(
+		const FString& UploadUrl,
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+		int64 ByteOffset,
+		TFunction<void(bool bSuccess, const FString& ItemId)> OnComplete,
+		TFunction<void(float Progress)> OnProgress
+	)
+	{
+		// Smaller chunks under a bandwidth limit keep the pacing smooth instead of sending bursts.
+		// Chunk sizes are multiples of 320 KiB, so they also line up with the blocks shared between destinations.
+		const int64 TotalBytes = FileReader->GetFileSize();
+		const int64 PacedChunkSize = FUploadBandwidthThrottle::GetPacedChunkSize(ChunkSize, ChunkGranularity);
+		const int64 ChunkLength = FMath::Min(PacedChunkSize, TotalBytes - ByteOffset);
+
+		const TSharedRef<FOneDriveClient> This = AsShared();
+		FileReader->ReadAsync(
+			ByteOffset,
+			ChunkLength,
+			[This, UploadUrl, FileReader, ByteOffset, OnComplete, OnProgress](const FCloudStorageFileReader::FDataPtr& ChunkData)
+			{
+				AsyncTask(ENamedThreads::GameThread, [This, UploadUrl, FileReader, ChunkData, ByteOffset, OnComplete, OnProgress]()
+				{
+					if (!ChunkData.IsValid())
+					{
+						UE_LOG(LogPluginBuilder, Error, TEXT("OneDrive: Failed to read file: %s"), *FileReader->GetFilePath());
+						OnComplete(false, FString());
+						return;
+					}
 
-		UploadNextChunk(UploadUrl, FileData, 0, OnComplete, OnProgress);
+					const double WaitTime = FUploadBandwidthThrottle::Get().Reserve(ChunkData->Num());
+					if (WaitTime <= 0.)
+					{
+						This->SendChunk(UploadUrl, FileReader, ChunkData, ByteOffset, OnComplete, OnProgress);
+						return;
+					}
+
+					const FTickerDelegate SendChunkDelegate = FTickerDelegate::CreateLambda(
+						[This, UploadUrl, FileReader, ChunkData, ByteOffset, OnComplete, OnProgress](float /* DeltaTime */) -> bool
+						{
+							This->SendChunk(UploadUrl, FileReader, ChunkData, ByteOffset, OnComplete, OnProgress);
+							return false;
+						}
+					);
+#if UE_5_00_OR_LATER
+					FTSTicker::GetCoreTicker().AddTicker(SendChunkDelegate, static_cast<float>(WaitTime));
+#else
+					FTicker::GetCoreTicker().AddTicker(SendChunkDelegate, static_cast<float>(WaitTime));
+#endif
+				});
+			}
+		);
 	}
 
-	void FOneDriveClient::UploadNextChunk(
+	void FOneDriveClient::SendChunk(
 		const FString& UploadUrl,
-		const TArray<uint8>& FileData,
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+		const FCloudStorageFileReader::FDataPtr& ChunkData,
 		int64 ByteOffset,
 		TFunction<void(bool bSuccess, const FString& ItemId)> OnComplete,
 		TFunction<void(float Progress)> OnProgress
 	)
 	{
-		const int64 TotalBytes = static_cast<int64>(FileData.Num());
-		const int64 EndByte = FMath::Min(ByteOffset + ChunkSize - 1, TotalBytes - 1);
-		const int64 ChunkLength = EndByte - ByteOffset + 1;
+		const int64 TotalBytes = FileReader->GetFileSize();
+		const int64 ChunkLength = static_cast<int64>(ChunkData->Num());
+		const int64 EndByte = ByteOffset + ChunkLength - 1;
 
 		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
 		Request->SetURL(UploadUrl);
@@ -376,13 +611,28 @@ namespace PluginBuilder
 			FString::Printf(TEXT("bytes %lld-%lld/%lld"), ByteOffset, EndByte, TotalBytes)
 		);
 
-		const TArray<uint8> ChunkData(FileData.GetData() + ByteOffset, static_cast<int32>(ChunkLength));
-		Request->SetContent(ChunkData);
+		Request->SetContent(*ChunkData);
+
+		FPackageTrace& Trace = FPackageTrace::Get();
+		const int32 TraceEventId = Trace.BeginEvent(
+			Trace.GetTrackId(TEXT("OneDrive HTTP")),
+			FString::Printf(TEXT("%s %lld-%lld"), *FPaths::GetCleanFilename(FileReader->GetFilePath()), ByteOffset, EndByte),
+			TEXT("Http"),
+			true
+		);
 
 		Request->OnProcessRequestComplete().BindLambda(
-			[this, UploadUrl, FileData, ByteOffset, ChunkLength, TotalBytes, OnComplete, OnProgress]
+			[this, UploadUrl, FileReader, ByteOffset, ChunkLength, TotalBytes, OnComplete, OnProgress, TraceEventId]
 			(FHttpRequestPtr /* Request */, FHttpResponsePtr Response, bool bConnected)
 			{
+				FPackageTrace::Get().EndEvent(
+					TraceEventId,
+					{
+						{ TEXT("bytes"), static_cast<double>(ChunkLength) },
+						{ TEXT("statusCode"), static_cast<double>(Response.IsValid() ? Response->GetResponseCode() : -1) }
+					}
+				);
+
 				if (!bConnected || !Response.IsValid())
 				{
 					UE_LOG(LogPluginBuilder, Error, TEXT("OneDrive: Chunk upload failed (connection error)."));
@@ -402,7 +652,7 @@ namespace PluginBuilder
 				// 202 Accepted = more chunks remain. 200/201 = upload complete.
 				if (Code == 202)
 				{
-					UploadNextChunk(UploadUrl, FileData, NextOffset, OnComplete, OnProgress);
+					UploadNextChunk(UploadUrl, FileReader, NextOffset, OnComplete, OnProgress);
 					return;
 				}
 
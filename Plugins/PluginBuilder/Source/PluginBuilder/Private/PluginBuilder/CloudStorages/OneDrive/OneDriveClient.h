@@ -4,27 +4,52 @@
 
 #include "CoreMinimal.h"
 #include "PluginBuilder/CloudStorages/ICloudStorageProvider.h"
+#include "PluginBuilder/CloudStorages/CloudStorageFileReader.h"
 
 namespace PluginBuilder
 {
+	/**
+	 * The servers that a OneDrive client talks to.
+	 * The defaults are the Microsoft services; other values are used to run against a local stand-in such as FMockGraphServer.
+	 */
+	struct FOneDriveEndpoints
+	{
+	public:
+		// The base URL of the Microsoft Graph API, without a trailing slash.
+		FString GraphUrl = TEXT("https://graph.microsoft.com/v1.0");
+
+		// The URL of the OAuth2 token endpoint.
+		FString TokenUrl = TEXT("https://login.microsoftonline.com/consumers/oauth2/v2.0/token");
+
+		// A refresh token to use instead of the tokens stored in the OneDrive settings.
+		// When set, the tokens obtained with it are kept in memory only and the settings are never modified.
+		FString RefreshToken;
+	};
+
 	/**
 	 * ICloudStorageProvider implementation for Microsoft OneDrive.
 	 * Uses the Microsoft Graph API (v1.0) and the resumable upload session protocol.
+	 * The callbacks that read and pace the chunks hold a shared reference, so the client outlives a chunk that is waiting to be sent.
 	 */
-	class FOneDriveClient : public ICloudStorageProvider
+	class FOneDriveClient : public ICloudStorageProvider, public TSharedFromThis<FOneDriveClient>
 	{
 	public:
+		// Constructor.
+		FOneDriveClient();
+		explicit FOneDriveClient(const FOneDriveEndpoints& InEndpoints);
+
 		// ICloudStorageProvider interface.
 		virtual FString GetProviderName() const override;
 		virtual FString GetRemoteBaseFolderPath() const override;
 		virtual bool IsAuthenticated() const override;
 		virtual void RefreshTokenIfNeeded(TFunction<void(bool bSuccess)> OnComplete) override;
+		virtual FString ComputeContentHash(const FString& LocalFilePath) const override;
 		virtual void FindItem(
 			const FString& RemoteFilePath,
-			TFunction<void(bool bFound, const FString& ItemId)> OnComplete
+			TFunction<void(bool bFound, const FString& ItemId, const FString& ContentHash)> OnComplete
 		) override;
 		virtual void UploadFile(
-			const FString& LocalFilePath,
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
 			const FString& RemoteFilePath,
 			TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
 			TFunction<void(float Progress)> OnProgress
@@ -33,36 +58,99 @@ namespace PluginBuilder
 			const FString& RemoteItemId,
 			TFunction<void(bool bSuccess, const FString& ShareUrl)> OnComplete
 		) override;
+		virtual void PrepareUpload(const FString& RemoteFilePath) override;
+		virtual void DiscardPreparedUpload(const FString& RemoteFilePath) override;
 		// End of ICloudStorageProvider interface.
 
 	private:
-		// Creates an upload session and returns its upload URL.
+		// An upload session opened ahead of the upload by PrepareUpload.
+		struct FPreparedUploadSession
+		{
+		public:
+			// The upload URL of the session. Empty until the session has been created.
+			FString UploadUrl;
+
+			// The session expiry as a Unix timestamp.
+			int64 ExpiryTime = 0;
+
+			// Whether the createUploadSession request is still in flight.
+			bool bIsPending = true;
+
+			// Whether the session was discarded while its request was still in flight.
+			bool bIsDiscarded = false;
+
+			// Uploads waiting for the in-flight request to complete.
+			TArray<TFunction<void(bool bSuccess, const FString& UploadUrl)>> Waiters;
+		};
+
+	private:
+		// Returns whether the tokens are kept in memory rather than in the OneDrive settings.
+		bool UsesInMemoryTokens() const;
+
+		// Returns the current access token.
+		FString GetAccessToken() const;
+
+		// Creates an upload session and returns its upload URL and expiry time.
 		void CreateUploadSession(
 			const FString& RemoteFilePath,
 			const FString& AccessToken,
-			TFunction<void(bool bSuccess, const FString& UploadUrl)> OnComplete
+			TFunction<void(bool bSuccess, const FString& UploadUrl, int64 ExpiryTime)> OnComplete
 		);
 
+		// Refreshes the token, creates a new upload session and uploads the file through it.
+		void UploadFileWithNewSession(
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+			const FString& RemoteFilePath,
+			TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+			TFunction<void(float Progress)> OnProgress
+		);
+
+		// Cancels an upload session that will not be used so that OneDrive can release it.
+		static void DeleteUploadSession(const FString& UploadUrl);
+
 		// Uploads file data in chunks using the given upload session URL.
 		// Returns the item ID of the completed upload.
 		void UploadChunks(
 			const FString& UploadUrl,
-			const FString& LocalFilePath,
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
 			TFunction<void(bool bSuccess, const FString& ItemId)> OnComplete,
 			TFunction<void(float Progress)> OnProgress
 		);
 
-		// Sends one chunk and recurses for the next.
+		// Reads the next chunk and sends it, waiting first if the bandwidth limit requires it.
 		void UploadNextChunk(
 			const FString& UploadUrl,
-			const TArray<uint8>& FileData,
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+			int64 ByteOffset,
+			TFunction<void(bool bSuccess, const FString& ItemId)> OnComplete,
+			TFunction<void(float Progress)> OnProgress
+		);
+
+		// Sends one chunk and continues with the next.
+		void SendChunk(
+			const FString& UploadUrl,
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+			const FCloudStorageFileReader::FDataPtr& ChunkData,
 			int64 ByteOffset,
 			TFunction<void(bool bSuccess, const FString& ItemId)> OnComplete,
 			TFunction<void(float Progress)> OnProgress
 		);
 
 	private:
+		// The servers that this client talks to.
+		FOneDriveEndpoints Endpoints;
+
+		// The access token and its expiry as a Unix timestamp, used instead of the settings when UsesInMemoryTokens returns true.
+		FString InMemoryAccessToken;
+		int64 InMemoryTokenExpiryTime;
+
+		// Upload sessions opened ahead of time, keyed by remote file path.
+		TMap<FString, TSharedRef<FPreparedUploadSession>> PreparedUploadSessions;
+
 		// Maximum chunk size for resumable uploads (10 MB, must be a multiple of 320 KiB).
 		static constexpr int64 ChunkSize = (10 * 1024 * 1024);
+
+		// The unit that every chunk size except the last one must be a multiple of.
+		static constexpr int64 ChunkGranularity = (320 * 1024);
 	};
 }
@@ -0,0 +1,394 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/CloudStorages/OneDrive/OneDriveUploadBenchmark.h"
+#include "PluginBuilder/CloudStorages/OneDrive/OneDriveClient.h"
+#include "PluginBuilder/CloudStorages/ICloudStorageProvider.h"
+#include "PluginBuilder/CloudStorages/UploadBandwidthThrottle.h"
+#include "PluginBuilder/Tasks/UploadToCloudTask.h"
+#include "PluginBuilder/Utilities/PluginPackager.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformFile.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Async/Async.h"
+
+namespace PluginBuilder
+{
+	DECLARE_STATS_GROUP(TEXT("OneDriveUploadBenchmark"), STATGROUP_OneDriveUploadBenchmark, STATCAT_Advanced);
+
+	namespace OneDriveUploadBenchmark
+	{
+		// The name of the console command that starts the benchmark.
+		static const TCHAR* CommandName = TEXT("PluginBuilder.BenchmarkOneDriveUpload");
+
+		// The size of the blocks that test files are written in.
+		static constexpr int64 WriteBlockSize = (1024 * 1024);
+
+		// Returns a byte count in megabytes.
+		static double ToMegabytes(const int64 NumBytes)
+		{
+			return static_cast<double>(NumBytes) / (1024. * 1024.);
+		}
+	}
+
+	void FOneDriveUploadBenchmark::Register()
+	{
+		ConsoleCommand = IConsoleManager::Get().RegisterConsoleCommand(
+			OneDriveUploadBenchmark::CommandName,
+			TEXT("Benchmarks uploading to OneDrive against a local mock server. ")
+			TEXT("Usage: PluginBuilder.BenchmarkOneDriveUpload [SizeMB=64] [Files=4] [Latency=<seconds>] [Bandwidth=<MB/s>] [ErrorRate=<0-1>] [ShareUrls=<0|1>]. ")
+			TEXT("Runs a default set of network conditions unless Latency, Bandwidth or ErrorRate is specified."),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&FOneDriveUploadBenchmark::HandleOnConsoleCommand),
+			ECVF_Default
+		);
+	}
+
+	void FOneDriveUploadBenchmark::Unregister()
+	{
+		Instance.Reset();
+
+		if (ConsoleCommand != nullptr)
+		{
+			IConsoleManager::Get().UnregisterConsoleObject(ConsoleCommand);
+			ConsoleCommand = nullptr;
+		}
+	}
+
+	bool FOneDriveUploadBenchmark::IsRunning()
+	{
+		return Instance.IsValid();
+	}
+
+	void FOneDriveUploadBenchmark::Tick(float DeltaTime)
+	{
+		// Test files are still being written.
+		if (!Task.IsValid())
+		{
+			if (!TestFilesFuture.IsReady())
+			{
+				return;
+			}
+
+			if (!TestFilesFuture.Get())
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("OneDrive upload benchmark: Failed to create test files in %s."), *GetBenchmarkDirectory());
+				Finish();
+				return;
+			}
+
+			StartNextConfiguration();
+			return;
+		}
+
+		PeakUsedPhysical = FMath::Max<uint64>(PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+
+		if (Task->GetState() == IPluginBuilderTask::EState::PreInitialize)
+		{
+			Task->Initialize();
+		}
+		if (Task->GetState() == IPluginBuilderTask::EState::Processing)
+		{
+			Task->Tick(DeltaTime);
+		}
+		if (Task->GetState() == IPluginBuilderTask::EState::PreTerminate)
+		{
+			Task->Terminate();
+		}
+		if (Task->GetState() == IPluginBuilderTask::EState::Terminated)
+		{
+			FinishCurrentConfiguration();
+
+			if (Configurations.IsValidIndex(CurrentConfigurationIndex + 1))
+			{
+				StartNextConfiguration();
+			}
+			else
+			{
+				Finish();
+			}
+		}
+	}
+
+	bool FOneDriveUploadBenchmark::IsTickable() const
+	{
+		return true;
+	}
+
+	TStatId FOneDriveUploadBenchmark::GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FOneDriveUploadBenchmark, STATGROUP_OneDriveUploadBenchmark);
+	}
+
+	bool FOneDriveUploadBenchmark::IsTickableWhenPaused() const
+	{
+		return true;
+	}
+
+	bool FOneDriveUploadBenchmark::IsTickableInEditor() const
+	{
+		return true;
+	}
+
+	void FOneDriveUploadBenchmark::HandleOnConsoleCommand(const TArray<FString>& Args)
+	{
+		if (IsRunning())
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("OneDrive upload benchmark: A benchmark is already running."));
+			return;
+		}
+		if (FPluginPackager::IsPackagePluginTaskRunning())
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("OneDrive upload benchmark: Cannot run while plugin packaging is in progress."));
+			return;
+		}
+
+		const FString Params = FString::Join(Args, TEXT(" "));
+
+		int32 SizeInMegabytes = 64;
+		int32 NumFiles = 4;
+		int32 ShareUrlsValue = 0;
+		FParse::Value(*Params, TEXT("SizeMB="), SizeInMegabytes);
+		FParse::Value(*Params, TEXT("Files="), NumFiles);
+		FParse::Value(*Params, TEXT("ShareUrls="), ShareUrlsValue);
+
+		FMockGraphServerSettings ServerSettings;
+		float BandwidthInMegabytes = 0.f;
+		const bool bHasLatency = FParse::Value(*Params, TEXT("Latency="), ServerSettings.Latency);
+		const bool bHasBandwidth = FParse::Value(*Params, TEXT("Bandwidth="), BandwidthInMegabytes);
+		const bool bHasErrorRate = FParse::Value(*Params, TEXT("ErrorRate="), ServerSettings.ErrorRate);
+		ServerSettings.Bandwidth = static_cast<int64>(BandwidthInMegabytes * 1024.f * 1024.f);
+
+		Instance = MakeUnique<FOneDriveUploadBenchmark>();
+		Instance->FileSize = FMath::Max<int64>(SizeInMegabytes, 1) * 1024 * 1024;
+		Instance->bGetShareUrls = (ShareUrlsValue != 0);
+
+		if (bHasLatency || bHasBandwidth || bHasErrorRate)
+		{
+			FConfiguration& Configuration = Instance->Configurations.AddDefaulted_GetRef();
+			Configuration.Name = TEXT("Custom");
+			Configuration.ServerSettings = ServerSettings;
+		}
+		else
+		{
+			auto AddConfiguration = [](const TCHAR* Name, const double Latency, const int64 Bandwidth, const float ErrorRate)
+			{
+				FConfiguration& Configuration = Instance->Configurations.AddDefaulted_GetRef();
+				Configuration.Name = Name;
+				Configuration.ServerSettings.Latency = Latency;
+				Configuration.ServerSettings.Bandwidth = Bandwidth;
+				Configuration.ServerSettings.ErrorRate = ErrorRate;
+			};
+			AddConfiguration(TEXT("Loopback"), 0., 0, 0.f);
+			AddConfiguration(TEXT("50 ms latency"), 0.05, 0, 0.f);
+			AddConfiguration(TEXT("200 ms latency"), 0.2, 0, 0.f);
+			AddConfiguration(TEXT("50 ms latency, 10 MB/s"), 0.05, 10 * 1024 * 1024, 0.f);
+			AddConfiguration(TEXT("50 ms latency, 2% errors"), 0.05, 0, 0.02f);
+		}
+
+		const FString BenchmarkDirectory = GetBenchmarkDirectory();
+		for (int32 FileIndex = 0; FileIndex < FMath::Max(NumFiles, 1); FileIndex++)
+		{
+			Instance->TestFilePaths.Add(BenchmarkDirectory / FString::Printf(TEXT("Benchmark_%d.bin"), FileIndex));
+		}
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("OneDrive upload benchmark: Creating %d test files of %d MB..."), Instance->TestFilePaths.Num(), SizeInMegabytes);
+		if (FUploadBandwidthThrottle::GetCurrentBandwidthLimit() > 0)
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("OneDrive upload benchmark: The upload bandwidth limit in editor preferences applies to the benchmark too."));
+		}
+
+		const TArray<FString> FilePaths = Instance->TestFilePaths;
+		const int64 TestFileSize = Instance->FileSize;
+		Instance->TestFilesFuture = Async(EAsyncExecution::ThreadPool, [FilePaths, TestFileSize]() -> bool
+		{
+			return CreateTestFiles(FilePaths, TestFileSize);
+		});
+	}
+
+	void FOneDriveUploadBenchmark::StartNextConfiguration()
+	{
+		CurrentConfigurationIndex++;
+		check(Configurations.IsValidIndex(CurrentConfigurationIndex));
+		const FConfiguration& Configuration = Configurations[CurrentConfigurationIndex];
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("OneDrive upload benchmark: [%d/%d] %s"), CurrentConfigurationIndex + 1, Configurations.Num(), *Configuration.Name);
+
+		// Each configuration gets a fresh server, so that no file is skipped as already uploaded.
+		Server = MakeUnique<FMockGraphServer>(Configuration.ServerSettings);
+		if (!Server->Start())
+		{
+			Server.Reset();
+			Finish();
+			return;
+		}
+
+		Task = MakeShared<FUploadToCloudTask>(TestFilePaths, GetBenchmarkDirectory(), TEXT("Benchmark"), bGetShareUrls);
+		TArray<TSharedPtr<ICloudStorageProvider>> Providers;
+		Providers.Add(MakeShared<FOneDriveClient>(Server->GetEndpoints()));
+		Task->SetDestinationProviders(Providers);
+
+		StartTime = FPlatformTime::Seconds();
+		BaselineUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+		PeakUsedPhysical = BaselineUsedPhysical;
+	}
+
+	void FOneDriveUploadBenchmark::FinishCurrentConfiguration()
+	{
+		FResult& Result = Results.AddDefaulted_GetRef();
+		Result.Configuration = Configurations[CurrentConfigurationIndex];
+		Result.bSucceeded = !Task->HasAnyError();
+		Result.Seconds = FPlatformTime::Seconds() - StartTime;
+		Result.PeakMemoryIncrease = static_cast<int64>(PeakUsedPhysical) - static_cast<int64>(BaselineUsedPhysical);
+		Result.ServerStats = Server->GetStats();
+
+		Task.Reset();
+		Server.Reset();
+	}
+
+	void FOneDriveUploadBenchmark::Finish()
+	{
+		const int64 TotalBytes = FileSize * TestFilePaths.Num();
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
+		UE_LOG(LogPluginBuilder, Log, TEXT("OneDrive upload benchmark: %d files, %.1f MB in total"), TestFilePaths.Num(), OneDriveUploadBenchmark::ToMegabytes(TotalBytes));
+		for (const FResult& Result : Results)
+		{
+			const FMockGraphServerStats& Stats = Result.ServerStats;
+			UE_LOG(
+				LogPluginBuilder, Log,
+				TEXT("  %-28s %s  %7.2f MB/s  %5d requests  %3d injected errors  peak +%.1f MB  p50 %.0f ms  p95 %.0f ms  p99 %.0f ms"),
+				*Result.Configuration.Name,
+				(Result.bSucceeded ? TEXT("OK    ") : TEXT("FAILED")),
+				(Result.Seconds > 0. ? OneDriveUploadBenchmark::ToMegabytes(TotalBytes) / Result.Seconds : 0.),
+				Stats.GetNumRequests(),
+				Stats.NumInjectedErrors,
+				OneDriveUploadBenchmark::ToMegabytes(Result.PeakMemoryIncrease),
+				Stats.GetDurationPercentile(50.f) * 1000.,
+				Stats.GetDurationPercentile(95.f) * 1000.,
+				Stats.GetDurationPercentile(99.f) * 1000.
+			);
+		}
+		UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
+
+		if (Results.Num() > 0)
+		{
+			WriteResultsToFile();
+		}
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		for (const FString& TestFilePath : TestFilePaths)
+		{
+			PlatformFile.DeleteFile(*TestFilePath);
+		}
+
+		Instance.Reset();
+	}
+
+	void FOneDriveUploadBenchmark::WriteResultsToFile() const
+	{
+		TArray<TSharedPtr<FJsonValue>> ResultValues;
+		for (const FResult& Result : Results)
+		{
+			const FMockGraphServerStats& Stats = Result.ServerStats;
+			const int64 TotalBytes = FileSize * TestFilePaths.Num();
+
+			const TSharedRef<FJsonObject> RequestsObject = MakeShared<FJsonObject>();
+			for (const auto& Pair : Stats.NumRequestsByEndpoint)
+			{
+				RequestsObject->SetNumberField(Pair.Key, Pair.Value);
+			}
+
+			const TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+			ResultObject->SetStringField(TEXT("name"), Result.Configuration.Name);
+			ResultObject->SetNumberField(TEXT("latencySeconds"), Result.Configuration.ServerSettings.Latency);
+			ResultObject->SetNumberField(TEXT("bandwidthBytesPerSecond"), static_cast<double>(Result.Configuration.ServerSettings.Bandwidth));
+			ResultObject->SetNumberField(TEXT("errorRate"), Result.Configuration.ServerSettings.ErrorRate);
+			ResultObject->SetBoolField(TEXT("succeeded"), Result.bSucceeded);
+			ResultObject->SetNumberField(TEXT("seconds"), Result.Seconds);
+			ResultObject->SetNumberField(TEXT("megabytesPerSecond"), (Result.Seconds > 0. ? OneDriveUploadBenchmark::ToMegabytes(TotalBytes) / Result.Seconds : 0.));
+			ResultObject->SetNumberField(TEXT("numRequests"), Stats.GetNumRequests());
+			ResultObject->SetObjectField(TEXT("requestsByEndpoint"), RequestsObject);
+			ResultObject->SetNumberField(TEXT("numInjectedErrors"), Stats.NumInjectedErrors);
+			ResultObject->SetNumberField(TEXT("bytesReceived"), static_cast<double>(Stats.NumBytesReceived));
+			ResultObject->SetNumberField(TEXT("peakMemoryIncreaseBytes"), static_cast<double>(Result.PeakMemoryIncrease));
+			ResultObject->SetNumberField(TEXT("p50Seconds"), Stats.GetDurationPercentile(50.f));
+			ResultObject->SetNumberField(TEXT("p95Seconds"), Stats.GetDurationPercentile(95.f));
+			ResultObject->SetNumberField(TEXT("p99Seconds"), Stats.GetDurationPercentile(99.f));
+			ResultObject->SetNumberField(TEXT("maxSeconds"), Stats.GetDurationPercentile(100.f));
+			ResultValues.Add(MakeShared<FJsonValueObject>(ResultObject));
+		}
+
+		const TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetNumberField(TEXT("fileSizeBytes"), static_cast<double>(FileSize));
+		RootObject->SetNumberField(TEXT("numFiles"), TestFilePaths.Num());
+		RootObject->SetBoolField(TEXT("getShareUrls"), bGetShareUrls);
+		RootObject->SetArrayField(TEXT("results"), ResultValues);
+
+		FString JsonString;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+		FJsonSerializer::Serialize(RootObject, Writer);
+
+		const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+		const FString FilePath = (GetBenchmarkDirectory() / FString::Printf(TEXT("OneDriveUpload_%s.json"), *Timestamp));
+		if (FFileHelper::SaveStringToFile(JsonString, *FilePath))
+		{
+			UE_LOG(LogPluginBuilder, Log, TEXT("OneDrive upload benchmark: Results saved to: %s"), *FilePath);
+		}
+		else
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("OneDrive upload benchmark: Failed to write results to: %s"), *FilePath);
+		}
+	}
+
+	bool FOneDriveUploadBenchmark::CreateTestFiles(const TArray<FString>& FilePaths, const int64 TestFileSize)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.CreateDirectoryTree(*GetBenchmarkDirectory());
+
+		// Random data, so that nothing along the way can compress it.
+		FRandomStream RandomStream(FPlatformTime::Cycles());
+		TArray<uint8> Block;
+		Block.SetNumUninitialized(OneDriveUploadBenchmark::WriteBlockSize);
+
+		for (const FString& FilePath : FilePaths)
+		{
+			const TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenWrite(*FilePath));
+			if (!FileHandle.IsValid())
+			{
+				return false;
+			}
+
+			for (int64 Offset = 0; Offset < TestFileSize; Offset += Block.Num())
+			{
+				uint32* Words = reinterpret_cast<uint32*>(Block.GetData());
+				for (int32 WordIndex = 0; WordIndex < Block.Num() / 4; WordIndex++)
+				{
+					Words[WordIndex] = RandomStream.GetUnsignedInt();
+				}
+
+				const int64 WriteSize = FMath::Min<int64>(Block.Num(), TestFileSize - Offset);
+				if (!FileHandle->Write(Block.GetData(), WriteSize))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	FString FOneDriveUploadBenchmark::GetBenchmarkDirectory()
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PluginBuilder") / TEXT("Benchmarks"));
+	}
+
+	TUniquePtr<FOneDriveUploadBenchmark> FOneDriveUploadBenchmark::Instance;
+	IConsoleObject* FOneDriveUploadBenchmark::ConsoleCommand = nullptr;
+}
@@ -0,0 +1,131 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "Async/Future.h"
+#include "PluginBuilder/CloudStorages/OneDrive/MockGraphServer.h"
+
+class IConsoleObject;
+
+namespace PluginBuilder
+{
+	class FUploadToCloudTask;
+
+	/**
+	 * A benchmark of the OneDrive upload path that drives FUploadToCloudTask against a FMockGraphServer.
+	 * Runs one upload per network configuration and reports the throughput, request count, peak memory and request latency
+	 * percentiles of each to the Output Log and to a JSON file under Saved/PluginBuilder/Benchmarks/.
+	 * Started from the PluginBuilder.BenchmarkOneDriveUpload console command.
+	 */
+	class FOneDriveUploadBenchmark : public FTickableGameObject
+	{
+	public:
+		// Registers the console command that starts the benchmark.
+		static void Register();
+
+		// Unregisters the console command and stops a running benchmark.
+		static void Unregister();
+
+		// Returns whether the benchmark is running.
+		static bool IsRunning();
+
+		// FTickableObjectBase interface.
+		virtual void Tick(float DeltaTime) override;
+		virtual bool IsTickable() const override;
+		virtual TStatId GetStatId() const override;
+		virtual bool IsTickableWhenPaused() const override;
+		virtual bool IsTickableInEditor() const override;
+		// End of FTickableObjectBase interface.
+
+	private:
+		// A set of network conditions to benchmark.
+		struct FConfiguration
+		{
+		public:
+			// A short description shown in the results.
+			FString Name;
+
+			// The conditions the mock server simulates.
+			FMockGraphServerSettings ServerSettings;
+		};
+
+		// The measurements of one configuration.
+		struct FResult
+		{
+		public:
+			// The configuration that was measured.
+			FConfiguration Configuration;
+
+			// Whether every file was uploaded.
+			bool bSucceeded = false;
+
+			// The time the upload task took in seconds.
+			double Seconds = 0.;
+
+			// The highest increase of the used physical memory of the process over the start of the upload, in bytes.
+			int64 PeakMemoryIncrease = 0;
+
+			// The statistics collected by the mock server.
+			FMockGraphServerStats ServerStats;
+		};
+
+	private:
+		// Called when the console command is executed.
+		static void HandleOnConsoleCommand(const TArray<FString>& Args);
+
+		// Starts the mock server and the upload task for the next configuration.
+		void StartNextConfiguration();
+
+		// Records the result of the current configuration and stops the mock server.
+		void FinishCurrentConfiguration();
+
+		// Logs the results, writes them to a JSON file and deletes the test files.
+		void Finish();
+
+		// Writes the results to Saved/PluginBuilder/Benchmarks/OneDriveUpload_<timestamp>.json.
+		void WriteResultsToFile() const;
+
+		// Creates files of random data to upload. Runs on a worker thread.
+		static bool CreateTestFiles(const TArray<FString>& FilePaths, int64 TestFileSize);
+
+		// Returns the directory that test files and results are written to.
+		static FString GetBenchmarkDirectory();
+
+	private:
+		// The running benchmark.
+		static TUniquePtr<FOneDriveUploadBenchmark> Instance;
+
+		// The registered console command.
+		static IConsoleObject* ConsoleCommand;
+
+		// The configurations to measure, and the index of the one being measured.
+		TArray<FConfiguration> Configurations;
+		int32 CurrentConfigurationIndex = INDEX_NONE;
+
+		// The size of each test file in bytes, and the paths of the test files.
+		int64 FileSize = 0;
+		TArray<FString> TestFilePaths;
+
+		// Whether share URLs are requested, which adds createLink requests.
+		bool bGetShareUrls = false;
+
+		// Completes once the test files have been written.
+		TFuture<bool> TestFilesFuture;
+
+		// The mock server and the upload task of the current configuration.
+		TUniquePtr<FMockGraphServer> Server;
+		TSharedPtr<FUploadToCloudTask> Task;
+
+		// The time at which the current configuration started, in seconds.
+		double StartTime = 0.;
+
+		// The used physical memory of the process when the current configuration started, and the highest value since.
+		uint64 BaselineUsedPhysical = 0;
+		uint64 PeakUsedPhysical = 0;
+
+		// The results of the configurations measured so far.
+		TArray<FResult> Results;
+	};
+}
@@ -0,0 +1,111 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/CloudStorages/OneDrive/QuickXorHash.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformFile.h"
+#include "Misc/Base64.h"
+#include "Templates/UniquePtr.h"
+
+namespace PluginBuilder
+{
+	namespace QuickXorHash
+	{
+		// The size of the buffer used to read files.
+		static constexpr int64 ReadBufferSize = 4 * 1024 * 1024;
+	}
+	
+	FQuickXorHash::FQuickXorHash()
+		: LengthSoFar(0)
+		, ShiftSoFar(0)
+	{
+		FMemory::Memzero(Cells);
+	}
+
+	void FQuickXorHash::Update(const uint8* Data, const int64 Size)
+	{
+		constexpr int32 NumCells = UE_ARRAY_COUNT(Cells);
+		constexpr int32 BitsInLastCell = WidthInBits - (NumCells - 1) * 64;
+
+		int32 CellIndex = ShiftSoFar / 64;
+		int32 CellOffset = ShiftSoFar % 64;
+
+		// Bytes that are WidthInBits apart land on the same bit position, so they can be folded together first.
+		const int64 Iterations = FMath::Min<int64>(Size, WidthInBits);
+		for (int64 Index = 0; Index < Iterations; Index++)
+		{
+			const bool bIsLastCell = (CellIndex == NumCells - 1);
+			const int32 BitsInCell = (bIsLastCell ? BitsInLastCell : 64);
+
+			uint8 XoredByte = 0;
+			for (int64 DataIndex = Index; DataIndex < Size; DataIndex += WidthInBits)
+			{
+				XoredByte ^= Data[DataIndex];
+			}
+
+			Cells[CellIndex] ^= (static_cast<uint64>(XoredByte) << CellOffset);
+			if (CellOffset > BitsInCell - 8)
+			{
+				// The byte straddles two cells, so the overflowing bits wrap into the next one.
+				const int32 NextCellIndex = (bIsLastCell ? 0 : CellIndex + 1);
+				Cells[NextCellIndex] ^= (static_cast<uint64>(XoredByte) >> (BitsInCell - CellOffset));
+			}
+
+			CellOffset += Shift;
+			while (CellOffset >= BitsInCell)
+			{
+				CellIndex = (bIsLastCell ? 0 : CellIndex + 1);
+				CellOffset -= BitsInCell;
+			}
+		}
+
+		ShiftSoFar = static_cast<int32>((ShiftSoFar + Shift * (Size % WidthInBits)) % WidthInBits);
+		LengthSoFar += Size;
+	}
+
+	FString FQuickXorHash::Finalize() const
+	{
+		constexpr int32 HashSize = WidthInBits / 8;
+		uint8 Hash[HashSize];
+		for (int32 ByteIndex = 0; ByteIndex < HashSize; ByteIndex++)
+		{
+			Hash[ByteIndex] = static_cast<uint8>(Cells[ByteIndex / 8] >> ((ByteIndex % 8) * 8));
+		}
+
+		// The total length is mixed into the last 8 bytes, in little endian.
+		for (int32 ByteIndex = 0; ByteIndex < 8; ByteIndex++)
+		{
+			Hash[HashSize - 8 + ByteIndex] ^= static_cast<uint8>(static_cast<uint64>(LengthSoFar) >> (ByteIndex * 8));
+		}
+
+		return FBase64::Encode(Hash, HashSize);
+	}
+
+	FString FQuickXorHash::HashFile(const FString& FilePath)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		const TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*FilePath));
+		if (!FileHandle.IsValid())
+		{
+			return FString();
+		}
+
+		FQuickXorHash QuickXorHash;
+		TArray<uint8> Buffer;
+		Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(QuickXorHash::ReadBufferSize, FMath::Max<int64>(FileHandle->Size(), 1))));
+
+		int64 RemainingSize = FileHandle->Size();
+		while (RemainingSize > 0)
+		{
+			const int64 ReadSize = FMath::Min<int64>(RemainingSize, Buffer.Num());
+			if (!FileHandle->Read(Buffer.GetData(), ReadSize))
+			{
+				return FString();
+			}
+
+			QuickXorHash.Update(Buffer.GetData(), ReadSize);
+			RemainingSize -= ReadSize;
+		}
+
+		return QuickXorHash.Finalize();
+	}
+}
@@ -0,0 +1,44 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * An implementation of QuickXorHash, the content hash that OneDrive reports for every file.
+	 * Data can be fed in any number of pieces, so large files can be hashed without loading them into memory.
+	 */
+	class FQuickXorHash
+	{
+	public:
+		// Constructor.
+		FQuickXorHash();
+
+		// Adds the specified bytes to the hash.
+		void Update(const uint8* Data, int64 Size);
+
+		// Returns the base64 encoded hash of all data added so far, in the same format as the Graph API.
+		FString Finalize() const;
+
+		// Hashes the entire contents of a local file. Returns an empty string if the file could not be read.
+		static FString HashFile(const FString& FilePath);
+
+	private:
+		// The width of the hash in bits.
+		static constexpr int32 WidthInBits = 160;
+
+		// The number of bits the insertion point moves for each byte.
+		static constexpr int32 Shift = 11;
+
+		// The hash state, where only the lower 32 bits of the last cell are used.
+		uint64 Cells[3];
+
+		// The total number of bytes added so far.
+		int64 LengthSoFar;
+
+		// The bit position at which the next byte is inserted.
+		int32 ShiftSoFar;
+	};
+}
@@ -0,0 +1,538 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/CloudStorages/S3/S3Client.h"
+#include "PluginBuilder/CloudStorages/S3/S3RequestSigner.h"
+#include "PluginBuilder/CloudStorages/UploadBandwidthThrottle.h"
+#include "PluginBuilder/Types/OneDriveConflictBehavior.h"
+#include "PluginBuilder/Utilities/PluginBuilderPackagingSettings.h"
+#include "PluginBuilder/Utilities/PluginBuilderSettings.h"
+#include "PluginBuilder/Utilities/S3Settings.h"
+#include "PluginBuilder/Utilities/PackageTrace.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformFile.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "XmlFile.h"
+
+namespace PluginBuilder
+{
+	FString FS3Client::GetProviderName() const
+	{
+		return TEXT("S3");
+	}
+
+	FString FS3Client::GetRemoteBaseFolderPath() const
+	{
+		FString KeyPrefix = GetSettings<US3Settings>().KeyPrefix;
+		KeyPrefix.TrimStartAndEndInline();
+		while (KeyPrefix.RemoveFromStart(TEXT("/"))) {}
+		while (KeyPrefix.RemoveFromEnd(TEXT("/"))) {}
+		return KeyPrefix;
+	}
+
+	bool FS3Client::IsAuthenticated() const
+	{
+		return GetSettings<US3Settings>().IsConfigured();
+	}
+
+	void FS3Client::RefreshTokenIfNeeded(TFunction<void(bool bSuccess)> OnComplete)
+	{
+		// Requests are signed with static keys, so there is no token to refresh.
+		OnComplete(IsAuthenticated());
+	}
+
+	FString FS3Client::ComputeContentHash(const FString& LocalFilePath) const
+	{
+		// This mirrors the ETag that S3 assigns to objects uploaded by UploadFile: the MD5 of the file for a single PUT,
+		// or the MD5 of the concatenated part MD5s followed by the number of parts for a multipart upload.
+		// Buckets that encrypt objects with SSE-KMS use other ETags, in which case uploads are simply never skipped.
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		const TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*LocalFilePath));
+		if (!FileHandle.IsValid())
+		{
+			return FString();
+		}
+
+		const int64 FileSize = FileHandle->Size();
+		const int64 PartSize = GetSettings<US3Settings>().GetPartSizeInBytes();
+		const bool bIsMultipart = (FileSize > PartSize);
+
+		static constexpr int64 ReadBufferSize = (4 * 1024 * 1024);
+		TArray<uint8> Buffer;
+		Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(ReadBufferSize, FMath::Max<int64>(FileSize, 1))));
+
+		FMD5 CombinedMd5;
+		int32 NumParts = 0;
+		int64 Offset = 0;
+		do
+		{
+			const int64 PartEnd = (bIsMultipart ? FMath::Min(Offset + PartSize, FileSize) : FileSize);
+
+			FMD5 PartMd5;
+			while (Offset < PartEnd)
+			{
+				const int64 ReadSize = FMath::Min<int64>(PartEnd - Offset, Buffer.Num());
+				if (!FileHandle->Read(Buffer.GetData(), ReadSize))
+				{
+					return FString();
+				}
+
+				PartMd5.Update(Buffer.GetData(), static_cast<uint64>(ReadSize));
+				Offset += ReadSize;
+			}
+
+			uint8 Digest[16];
+			PartMd5.Final(Digest);
+			if (!bIsMultipart)
+			{
+				return BytesToHex(Digest, UE_ARRAY_COUNT(Digest)).ToLower();
+			}
+
+			CombinedMd5.Update(Digest, UE_ARRAY_COUNT(Digest));
+			NumParts++;
+		}
+		while (Offset < FileSize);
+
+		uint8 Digest[16];
+		CombinedMd5.Final(Digest);
+		return FString::Printf(TEXT("%s-%d"), *BytesToHex(Digest, UE_ARRAY_COUNT(Digest)).ToLower(), NumParts);
+	}
+
+	void FS3Client::FindItem(
+		const FString& RemoteFilePath,
+		TFunction<void(bool bFound, const FString& ItemId, const FString& ContentHash)> OnComplete
+	)
+	{
+		const FString ObjectKey = ToObjectKey(RemoteFilePath);
+
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+		CreateSigner().SignRequest(Request.Get(), TEXT("HEAD"), ObjectKey, {}, FS3RequestSigner::Sha256Hex(FString()));
+		Request->OnProcessRequestComplete().BindLambda(
+			[ObjectKey, OnComplete](FHttpRequestPtr /* Request */, FHttpResponsePtr Response, bool bConnected)
+			{
+				if (!bConnected || !Response.IsValid())
+				{
+					OnComplete(false, FString(), FString());
+					return;
+				}
+
+				const int32 Code = Response->GetResponseCode();
+				if (Code == 404)
+				{
+					OnComplete(false, FString(), FString());
+					return;
+				}
+
+				if (Code != 200)
+				{
+					UE_LOG(LogPluginBuilder, Warning, TEXT("S3: HeadObject returned unexpected code %d."), Code);
+					OnComplete(false, FString(), FString());
+					return;
+				}
+
+				FString ETag = Response->GetHeader(TEXT("ETag"));
+				ETag.TrimQuotesInline();
+				OnComplete(true, ObjectKey, ETag.ToLower());
+			}
+		);
+		Request->ProcessRequest();
+	}
+
+	void FS3Client::UploadFile(
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+		const FString& RemoteFilePath,
+		TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+		TFunction<void(float Progress)> OnProgress
+	)
+	{
+		const FString ObjectKey = ToObjectKey(RemoteFilePath);
+		const TSharedRef<FS3Client> This = AsShared();
+		auto StartUpload = [This, FileReader, ObjectKey, OnComplete, OnProgress]()
+		{
+			UE_LOG(LogPluginBuilder, Log, TEXT("S3: Uploading %s (%lld bytes)..."), *FPaths::GetCleanFilename(FileReader->GetFilePath()), FileReader->GetFileSize());
+
+			if (FileReader->GetFileSize() > GetSettings<US3Settings>().GetPartSizeInBytes())
+			{
+				This->StartMultipartUpload(FileReader, ObjectKey, OnComplete, OnProgress);
+			}
+			else
+			{
+				This->PutObject(FileReader, ObjectKey, OnComplete, OnProgress);
+			}
+		};
+
+		// S3 always overwrites objects, so Fail needs an explicit check and Rename is not available.
+		const EOneDriveConflictBehavior ConflictBehavior = GetSettings<UPluginBuilderPackagingSettings>().ConflictBehavior;
+		if (ConflictBehavior == EOneDriveConflictBehavior::Fail)
+		{
+			FindItem(
+				RemoteFilePath,
+				[ObjectKey, OnComplete, StartUpload](bool bFound, const FString& /* ItemId */, const FString& /* ContentHash */)
+				{
+					if (bFound)
+					{
+						UE_LOG(LogPluginBuilder, Error, TEXT("S3: %s already exists."), *ObjectKey);
+						OnComplete(false, FString());
+						return;
+					}
+					StartUpload();
+				}
+			);
+			return;
+		}
+
+		if (ConflictBehavior == EOneDriveConflictBehavior::Rename)
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("S3: Rename is not supported by S3. %s will be overwritten if it exists."), *ObjectKey);
+		}
+
+		StartUpload();
+	}
+
+	void FS3Client::GetShareUrl(
+		const FString& RemoteItemId,
+		TFunction<void(bool bSuccess, const FString& ShareUrl)> OnComplete
+	)
+	{
+		const int32 ExpiresInSeconds = (GetSettings<US3Settings>().ShareUrlExpiration * 3600);
+		OnComplete(true, CreateSigner().PresignGetObjectUrl(RemoteItemId, ExpiresInSeconds));
+	}
+
+	void FS3Client::PutObject(
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+		const FString& ObjectKey,
+		TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+		TFunction<void(float Progress)> OnProgress
+	)
+	{
+		FileReader->ReadAsync(0, FileReader->GetFileSize(), [FileReader, ObjectKey, OnComplete, OnProgress](const FCloudStorageFileReader::FDataPtr& FileData)
+		{
+			AsyncTask(ENamedThreads::GameThread, [FileReader, ObjectKey, FileData, OnComplete, OnProgress]()
+			{
+				if (!FileData.IsValid())
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("S3: Failed to read file: %s"), *FileReader->GetFilePath());
+					OnComplete(false, FString());
+					return;
+				}
+
+				RunWhenBandwidthAllows(FileData->Num(), [ObjectKey, FileData, OnComplete, OnProgress]()
+				{
+					const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+					CreateSigner().SignRequest(Request.Get(), TEXT("PUT"), ObjectKey, {}, FS3RequestSigner::UnsignedPayload);
+					Request->SetContent(*FileData);
+
+					FPackageTrace& Trace = FPackageTrace::Get();
+					const int32 TraceEventId = Trace.BeginEvent(Trace.GetTrackId(TEXT("S3 HTTP")), FPaths::GetCleanFilename(ObjectKey), TEXT("Http"), true);
+					const int64 NumBytes = FileData->Num();
+
+					Request->OnProcessRequestComplete().BindLambda(
+						[ObjectKey, OnComplete, OnProgress, TraceEventId, NumBytes](FHttpRequestPtr /* Request */, FHttpResponsePtr Response, bool bConnected)
+						{
+							FPackageTrace::Get().EndEvent(
+								TraceEventId,
+								{
+									{ TEXT("bytes"), static_cast<double>(NumBytes) },
+									{ TEXT("statusCode"), static_cast<double>(Response.IsValid() ? Response->GetResponseCode() : -1) }
+								}
+							);
+
+							if (!bConnected || !Response.IsValid() || Response->GetResponseCode() != 200)
+							{
+								UE_LOG(LogPluginBuilder, Error, TEXT("S3: PutObject failed. Code: %d"), Response.IsValid() ? Response->GetResponseCode() : -1);
+								OnComplete(false, FString());
+								return;
+							}
+
+							if (OnProgress)
+							{
+								OnProgress(1.f);
+							}
+							UE_LOG(LogPluginBuilder, Log, TEXT("S3: Upload complete. Key: %s"), *ObjectKey);
+							OnComplete(true, ObjectKey);
+						}
+					);
+					Request->ProcessRequest();
+				});
+			});
+		});
+	}
+
+	void FS3Client::StartMultipartUpload(
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+		const FString& ObjectKey,
+		TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+		TFunction<void(float Progress)> OnProgress
+	)
+	{
+		const TSharedRef<FMultipartUpload> Upload = MakeShared<FMultipartUpload>();
+		Upload->FileReader = FileReader;
+		Upload->ObjectKey = ObjectKey;
+		Upload->FileSize = FileReader->GetFileSize();
+		Upload->PartSize = GetSettings<US3Settings>().GetPartSizeInBytes();
+		Upload->NumParts = static_cast<int32>((Upload->FileSize + Upload->PartSize - 1) / Upload->PartSize);
+		Upload->PartETags.SetNum(Upload->NumParts);
+		Upload->OnComplete = OnComplete;
+		Upload->OnProgress = OnProgress;
+
+		static constexpr int32 MaxNumParts = 10000;
+		if (Upload->NumParts > MaxNumParts)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("S3: %s needs %d parts, which exceeds the limit of %d. Please increase the part size."), *FPaths::GetCleanFilename(FileReader->GetFilePath()), Upload->NumParts, MaxNumParts);
+			OnComplete(false, FString());
+			return;
+		}
+
+		TMap<FString, FString> QueryParameters;
+		QueryParameters.Add(TEXT("uploads"), FString());
+
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+		CreateSigner().SignRequest(Request.Get(), TEXT("POST"), ObjectKey, QueryParameters, FS3RequestSigner::Sha256Hex(FString()));
+		const TSharedRef<FS3Client> This = AsShared();
+		Request->OnProcessRequestComplete().BindLambda(
+			[This, Upload](FHttpRequestPtr /* Request */, FHttpResponsePtr Response, bool bConnected)
+			{
+				if (!bConnected || !Response.IsValid() || Response->GetResponseCode() != 200)
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("S3: CreateMultipartUpload failed. Code: %d"), Response.IsValid() ? Response->GetResponseCode() : -1);
+					Upload->OnComplete(false, FString());
+					return;
+				}
+
+				const FXmlFile XmlFile(Response->GetContentAsString(), EConstructMethod::ConstructFromBuffer);
+				const FXmlNode* RootNode = XmlFile.GetRootNode();
+				const FXmlNode* UploadIdNode = (RootNode != nullptr ? RootNode->FindChildNode(TEXT("UploadId")) : nullptr);
+				if (UploadIdNode == nullptr || UploadIdNode->GetContent().IsEmpty())
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("S3: CreateMultipartUpload returned no upload ID."));
+					Upload->OnComplete(false, FString());
+					return;
+				}
+
+				Upload->UploadId = UploadIdNode->GetContent();
+				UE_LOG(LogPluginBuilder, Verbose, TEXT("S3: Started multipart upload of %d parts. (Upload ID = %s)"), Upload->NumParts, *Upload->UploadId);
+
+				This->SendPendingParts(Upload);
+			}
+		);
+		Request->ProcessRequest();
+	}
+
+	void FS3Client::SendPendingParts(const TSharedRef<FMultipartUpload>& Upload)
+	{
+		const int32 MaxConcurrentParts = FMath::Max(GetSettings<US3Settings>().MaxConcurrentParts, 1);
+		while (!Upload->bHasFailed && (Upload->NumPartsInFlight < MaxConcurrentParts) && (Upload->NextPartIndex < Upload->NumParts))
+		{
+			Upload->NumPartsInFlight++;
+			SendPart(Upload, Upload->NextPartIndex++);
+		}
+	}
+
+	void FS3Client::SendPart(const TSharedRef<FMultipartUpload>& Upload, const int32 PartIndex)
+	{
+		const int64 Offset = (static_cast<int64>(PartIndex) * Upload->PartSize);
+		const int64 PartLength = FMath::Min(Upload->PartSize, Upload->FileSize - Offset);
+
+		// The reader loads parts in flight on worker threads, so that they do not block each other or the game thread.
+		const TSharedRef<FS3Client> This = AsShared();
+		Upload->FileReader->ReadAsync(Offset, PartLength, [This, Upload, PartIndex, PartLength](const FCloudStorageFileReader::FDataPtr& PartData)
+		{
+			AsyncTask(ENamedThreads::GameThread, [This, Upload, PartIndex, PartLength, PartData]()
+			{
+				if (!PartData.IsValid())
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("S3: Failed to read part %d of %s."), PartIndex + 1, *Upload->FileReader->GetFilePath());
+					This->HandleOnPartFinished(Upload, PartIndex, PartLength, FString());
+					return;
+				}
+
+				RunWhenBandwidthAllows(PartLength, [This, Upload, PartIndex, PartLength, PartData]()
+				{
+					if (Upload->bHasFailed)
+					{
+						This->HandleOnPartFinished(Upload, PartIndex, PartLength, FString());
+						return;
+					}
+
+					TMap<FString, FString> QueryParameters;
+					QueryParameters.Add(TEXT("partNumber"), FString::FromInt(PartIndex + 1));
+					QueryParameters.Add(TEXT("uploadId"), Upload->UploadId);
+
+					const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+					CreateSigner().SignRequest(Request.Get(), TEXT("PUT"), Upload->ObjectKey, QueryParameters, FS3RequestSigner::UnsignedPayload);
+					Request->SetContent(*PartData);
+
+					FPackageTrace& Trace = FPackageTrace::Get();
+					const int32 TraceEventId = Trace.BeginEvent(
+						Trace.GetTrackId(TEXT("S3 HTTP")),
+						FString::Printf(TEXT("%s part %d"), *FPaths::GetCleanFilename(Upload->ObjectKey), PartIndex + 1),
+						TEXT("Http"),
+						true
+					);
+
+					Request->OnProcessRequestComplete().BindLambda(
+						[This, Upload, PartIndex, PartLength, TraceEventId](FHttpRequestPtr /* Request */, FHttpResponsePtr Response, bool bConnected)
+						{
+							FPackageTrace::Get().EndEvent(
+								TraceEventId,
+								{
+									{ TEXT("bytes"), static_cast<double>(PartLength) },
+									{ TEXT("statusCode"), static_cast<double>(Response.IsValid() ? Response->GetResponseCode() : -1) }
+								}
+							);
+
+							FString ETag;
+							if (bConnected && Response.IsValid() && Response->GetResponseCode() == 200)
+							{
+								ETag = Response->GetHeader(TEXT("ETag"));
+							}
+							else
+							{
+								UE_LOG(LogPluginBuilder, Error, TEXT("S3: UploadPart %d failed. Code: %d"), PartIndex + 1, Response.IsValid() ? Response->GetResponseCode() : -1);
+							}
+							This->HandleOnPartFinished(Upload, PartIndex, PartLength, ETag);
+						}
+					);
+					Request->ProcessRequest();
+				});
+			});
+		});
+	}
+
+	void FS3Client::HandleOnPartFinished(const TSharedRef<FMultipartUpload>& Upload, const int32 PartIndex, const int64 PartLength, const FString& ETag)
+	{
+		Upload->NumPartsInFlight--;
+
+		if (ETag.IsEmpty())
+		{
+			Upload->bHasFailed = true;
+		}
+		else
+		{
+			Upload->PartETags[PartIndex] = ETag;
+			Upload->UploadedBytes += PartLength;
+
+			if (Upload->OnProgress)
+			{
+				Upload->OnProgress(static_cast<float>(Upload->UploadedBytes) / static_cast<float>(Upload->FileSize));
+			}
+		}
+
+		if (Upload->bHasFailed)
+		{
+			// Wait for the parts in flight so that the abort is not followed by parts that recreate the upload.
+			if (Upload->NumPartsInFlight == 0)
+			{
+				AbortMultipartUpload(Upload);
+				Upload->OnComplete(false, FString());
+			}
+			return;
+		}
+
+		if (Upload->UploadedBytes >= Upload->FileSize)
+		{
+			CompleteMultipartUpload(Upload);
+			return;
+		}
+
+		SendPendingParts(Upload);
+	}
+
+	void FS3Client::CompleteMultipartUpload(const TSharedRef<FMultipartUpload>& Upload)
+	{
+		FString Body = TEXT("<CompleteMultipartUpload>");
+		for (int32 PartIndex = 0; PartIndex < Upload->NumParts; PartIndex++)
+		{
+			Body += FString::Printf(
+				TEXT("<Part><PartNumber>%d</PartNumber><ETag>%s</ETag></Part>"),
+				PartIndex + 1,
+				*Upload->PartETags[PartIndex]
+			);
+		}
+		Body += TEXT("</CompleteMultipartUpload>");
+
+		TMap<FString, FString> QueryParameters;
+		QueryParameters.Add(TEXT("uploadId"), Upload->UploadId);
+
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+		CreateSigner().SignRequest(Request.Get(), TEXT("POST"), Upload->ObjectKey, QueryParameters, FS3RequestSigner::Sha256Hex(Body));
+		Request->SetHeader(TEXT("Content-Type"), TEXT("application/xml"));
+		Request->SetContentAsString(Body);
+		const TSharedRef<FS3Client> This = AsShared();
+		Request->OnProcessRequestComplete().BindLambda(
+			[This, Upload](FHttpRequestPtr /* Request */, FHttpResponsePtr Response, bool bConnected)
+			{
+				// CompleteMultipartUpload can report an error in the body of a 200 response.
+				const bool bSucceeded = (
+					bConnected &&
+					Response.IsValid() &&
+					Response->GetResponseCode() == 200 &&
+					!Response->GetContentAsString().Contains(TEXT("<Error>"))
+				);
+				if (!bSucceeded)
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("S3: CompleteMultipartUpload failed. Code: %d"), Response.IsValid() ? Response->GetResponseCode() : -1);
+					This->AbortMultipartUpload(Upload);
+					Upload->OnComplete(false, FString());
+					return;
+				}
+
+				UE_LOG(LogPluginBuilder, Log, TEXT("S3: Upload complete. Key: %s"), *Upload->ObjectKey);
+				Upload->OnComplete(true, Upload->ObjectKey);
+			}
+		);
+		Request->ProcessRequest();
+	}
+
+	void FS3Client::AbortMultipartUpload(const TSharedRef<FMultipartUpload>& Upload)
+	{
+		TMap<FString, FString> QueryParameters;
+		QueryParameters.Add(TEXT("uploadId"), Upload->UploadId);
+
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+		CreateSigner().SignRequest(Request.Get(), TEXT("DELETE"), Upload->ObjectKey, QueryParameters, FS3RequestSigner::Sha256Hex(FString()));
+		Request->ProcessRequest();
+	}
+
+	void FS3Client::RunWhenBandwidthAllows(const int64 NumBytes, TFunction<void()> Function)
+	{
+		const double WaitTime = FUploadBandwidthThrottle::Get().Reserve(NumBytes);
+		if (WaitTime <= 0.)
+		{
+			Function();
+			return;
+		}
+
+		const FTickerDelegate FunctionDelegate = FTickerDelegate::CreateLambda(
+			[Function](float /* DeltaTime */) -> bool
+			{
+				Function();
+				return false;
+			}
+		);
+#if UE_5_00_OR_LATER
+		FTSTicker::GetCoreTicker().AddTicker(FunctionDelegate, static_cast<float>(WaitTime));
+#else
+		FTicker::GetCoreTicker().AddTicker(FunctionDelegate, static_cast<float>(WaitTime));
+#endif
+	}
+
+	FString FS3Client::ToObjectKey(const FString& RemoteFilePath)
+	{
+		FString ObjectKey = RemoteFilePath;
+		ObjectKey.ReplaceInline(TEXT("\\"), TEXT("/"));
+		while (ObjectKey.RemoveFromStart(TEXT("/"))) {}
+		return ObjectKey;
+	}
+
+	FS3RequestSigner FS3Client::CreateSigner()
+	{
+		return FS3RequestSigner(GetSettings<US3Settings>());
+	}
+}
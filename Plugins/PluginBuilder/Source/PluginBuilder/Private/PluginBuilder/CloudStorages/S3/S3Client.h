@@ -0,0 +1,121 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/CloudStorages/ICloudStorageProvider.h"
+#include "PluginBuilder/CloudStorages/CloudStorageFileReader.h"
+
+namespace PluginBuilder
+{
+	class FS3RequestSigner;
+
+	/**
+	 * A cloud storage provider for Amazon S3 and S3-compatible storages such as MinIO.
+	 * Large files are uploaded with multipart upload, sending several parts at the same time.
+	 * Remote item IDs are object keys, and share URLs are presigned download URLs.
+	 * Callbacks that run after a thread pool, ticker or HTTP hop hold a shared reference, so the client outlives its requests.
+	 */
+	class FS3Client : public ICloudStorageProvider, public TSharedFromThis<FS3Client>
+	{
+	public:
+		// ICloudStorageProvider interface.
+		virtual FString GetProviderName() const override;
+		virtual FString GetRemoteBaseFolderPath() const override;
+		virtual bool IsAuthenticated() const override;
+		virtual void RefreshTokenIfNeeded(TFunction<void(bool bSuccess)> OnComplete) override;
+		virtual FString ComputeContentHash(const FString& LocalFilePath) const override;
+		virtual void FindItem(
+			const FString& RemoteFilePath,
+			TFunction<void(bool bFound, const FString& ItemId, const FString& ContentHash)> OnComplete
+		) override;
+		virtual void UploadFile(
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+			const FString& RemoteFilePath,
+			TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+			TFunction<void(float Progress)> OnProgress
+		) override;
+		virtual void GetShareUrl(
+			const FString& RemoteItemId,
+			TFunction<void(bool bSuccess, const FString& ShareUrl)> OnComplete
+		) override;
+		// End of ICloudStorageProvider interface.
+
+	private:
+		// The state of a multipart upload shared by the requests of its parts.
+		struct FMultipartUpload
+		{
+			// The reader of the local file being uploaded.
+			TSharedPtr<FCloudStorageFileReader, ESPMode::ThreadSafe> FileReader;
+
+			// The key of the object being uploaded.
+			FString ObjectKey;
+
+			// The ID returned by CreateMultipartUpload.
+			FString UploadId;
+
+			// The size of the file and of each part in bytes.
+			int64 FileSize = 0;
+			int64 PartSize = 0;
+
+			// The number of parts, the index of the next part to send and the number of parts in flight.
+			int32 NumParts = 0;
+			int32 NextPartIndex = 0;
+			int32 NumPartsInFlight = 0;
+
+			// The number of bytes of the parts that have been uploaded.
+			int64 UploadedBytes = 0;
+
+			// The ETags of the uploaded parts, in part order.
+			TArray<FString> PartETags;
+
+			// Whether any part failed. No more parts are started once this is set.
+			bool bHasFailed = false;
+
+			// The callbacks passed to UploadFile.
+			TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete;
+			TFunction<void(float Progress)> OnProgress;
+		};
+
+	private:
+		// Uploads a small file with a single PUT request.
+		void PutObject(
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+			const FString& ObjectKey,
+			TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+			TFunction<void(float Progress)> OnProgress
+		);
+
+		// Starts a multipart upload and sends its parts.
+		void StartMultipartUpload(
+			const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>& FileReader,
+			const FString& ObjectKey,
+			TFunction<void(bool bSuccess, const FString& RemoteItemId)> OnComplete,
+			TFunction<void(float Progress)> OnProgress
+		);
+
+		// Starts as many parts as the concurrency limit allows.
+		void SendPendingParts(const TSharedRef<FMultipartUpload>& Upload);
+
+		// Reads a part through the file reader and sends it once the bandwidth limit allows.
+		void SendPart(const TSharedRef<FMultipartUpload>& Upload, int32 PartIndex);
+
+		// Called when a part request finishes.
+		void HandleOnPartFinished(const TSharedRef<FMultipartUpload>& Upload, int32 PartIndex, int64 PartLength, const FString& ETag);
+
+		// Sends CompleteMultipartUpload once every part has been uploaded.
+		void CompleteMultipartUpload(const TSharedRef<FMultipartUpload>& Upload);
+
+		// Sends AbortMultipartUpload so that the storage releases the uploaded parts.
+		void AbortMultipartUpload(const TSharedRef<FMultipartUpload>& Upload);
+
+		// Calls the function after the bandwidth limit allows the specified number of bytes to be sent.
+		static void RunWhenBandwidthAllows(int64 NumBytes, TFunction<void()> Function);
+
+		// Returns the object key for the specified remote path.
+		static FString ToObjectKey(const FString& RemoteFilePath);
+
+		// Returns a request signer with the current settings.
+		static FS3RequestSigner CreateSigner();
+	};
+}
@@ -0,0 +1,270 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/CloudStorages/S3/S3RequestSigner.h"
+#include "PluginBuilder/Utilities/S3Settings.h"
+#include "Misc/DateTime.h"
+
+THIRD_PARTY_INCLUDES_START
+#define UI UI_ST
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/sha.h>
+#undef UI
+THIRD_PARTY_INCLUDES_END
+
+namespace PluginBuilder
+{
+	const FString FS3RequestSigner::UnsignedPayload = TEXT("UNSIGNED-PAYLOAD");
+
+	FS3RequestSigner::FS3RequestSigner(const US3Settings& Settings)
+		: Region(Settings.Region)
+		, Bucket(Settings.Bucket)
+		, AccessKeyId(Settings.AccessKeyId)
+		, SecretAccessKey(Settings.SecretAccessKey)
+		, bUsePathStyle(Settings.bUsePathStyle)
+	{
+		FString Remaining = Settings.Endpoint.TrimStartAndEnd();
+		if (!Remaining.Split(TEXT("://"), &Scheme, &Remaining))
+		{
+			Scheme = TEXT("https");
+		}
+		Scheme = Scheme.ToLower();
+
+		// Any path after the host name is not part of the endpoint.
+		if (!Remaining.Split(TEXT("/"), &EndpointHost, nullptr))
+		{
+			EndpointHost = Remaining;
+		}
+	}
+
+	void FS3RequestSigner::SignRequest(
+		IHttpRequest& Request,
+		const FString& Verb,
+		const FString& ObjectKey,
+		const TMap<FString, FString>& QueryParameters,
+		const FString& PayloadHash
+	) const
+	{
+		const FDateTime Now = FDateTime::UtcNow();
+		const FString AmzDate = Now.ToString(TEXT("%Y%m%dT%H%M%SZ"));
+		const FString DateStamp = Now.ToString(TEXT("%Y%m%d"));
+
+		const FString Host = GetHost();
+		const FString CanonicalUri = GetCanonicalUri(ObjectKey);
+		const FString CanonicalQueryString = GetCanonicalQueryString(QueryParameters);
+
+		static const FString SignedHeaders = TEXT("host;x-amz-content-sha256;x-amz-date");
+		const FString CanonicalHeaders = FString::Printf(
+			TEXT("host:%s\nx-amz-content-sha256:%s\nx-amz-date:%s\n"),
+			*Host,
+			*PayloadHash,
+			*AmzDate
+		);
+
+		const FString CanonicalRequest = FString::Printf(
+			TEXT("%s\n%s\n%s\n%s\n%s\n%s"),
+			*Verb,
+			*CanonicalUri,
+			*CanonicalQueryString,
+			*CanonicalHeaders,
+			*SignedHeaders,
+			*PayloadHash
+		);
+
+		const FString CredentialScope = GetCredentialScope(DateStamp);
+		const FString StringToSign = FString::Printf(
+			TEXT("AWS4-HMAC-SHA256\n%s\n%s\n%s"),
+			*AmzDate,
+			*CredentialScope,
+			*Sha256Hex(CanonicalRequest)
+		);
+
+		const FString Authorization = FString::Printf(
+			TEXT("AWS4-HMAC-SHA256 Credential=%s/%s, SignedHeaders=%s, Signature=%s"),
+			*AccessKeyId,
+			*CredentialScope,
+			*SignedHeaders,
+			*CalculateSignature(DateStamp, StringToSign)
+		);
+
+		FString Url = FString::Printf(TEXT("%s://%s%s"), *Scheme, *Host, *CanonicalUri);
+		if (!CanonicalQueryString.IsEmpty())
+		{
+			Url += FString::Printf(TEXT("?%s"), *CanonicalQueryString);
+		}
+
+		Request.SetURL(Url);
+		Request.SetVerb(Verb);
+		Request.SetHeader(TEXT("x-amz-date"), AmzDate);
+		Request.SetHeader(TEXT("x-amz-content-sha256"), PayloadHash);
+		Request.SetHeader(TEXT("Authorization"), Authorization);
+	}
+
+	FString FS3RequestSigner::PresignGetObjectUrl(const FString& ObjectKey, const int32 ExpiresInSeconds) const
+	{
+		const FDateTime Now = FDateTime::UtcNow();
+		const FString AmzDate = Now.ToString(TEXT("%Y%m%dT%H%M%SZ"));
+		const FString DateStamp = Now.ToString(TEXT("%Y%m%d"));
+
+		const FString Host = GetHost();
+		const FString CanonicalUri = GetCanonicalUri(ObjectKey);
+		const FString CredentialScope = GetCredentialScope(DateStamp);
+
+		TMap<FString, FString> QueryParameters;
+		QueryParameters.Add(TEXT("X-Amz-Algorithm"), TEXT("AWS4-HMAC-SHA256"));
+		QueryParameters.Add(TEXT("X-Amz-Credential"), FString::Printf(TEXT("%s/%s"), *AccessKeyId, *CredentialScope));
+		QueryParameters.Add(TEXT("X-Amz-Date"), AmzDate);
+		QueryParameters.Add(TEXT("X-Amz-Expires"), FString::FromInt(FMath::Clamp(ExpiresInSeconds, 1, 604800)));
+		QueryParameters.Add(TEXT("X-Amz-SignedHeaders"), TEXT("host"));
+		const FString CanonicalQueryString = GetCanonicalQueryString(QueryParameters);
+
+		const FString CanonicalRequest = FString::Printf(
+			TEXT("GET\n%s\n%s\nhost:%s\n\nhost\n%s"),
+			*CanonicalUri,
+			*CanonicalQueryString,
+			*Host,
+			*UnsignedPayload
+		);
+
+		const FString StringToSign = FString::Printf(
+			TEXT("AWS4-HMAC-SHA256\n%s\n%s\n%s"),
+			*AmzDate,
+			*CredentialScope,
+			*Sha256Hex(CanonicalRequest)
+		);
+
+		return FString::Printf(
+			TEXT("%s://%s%s?%s&X-Amz-Signature=%s"),
+			*Scheme,
+			*Host,
+			*CanonicalUri,
+			*CanonicalQueryString,
+			*CalculateSignature(DateStamp, StringToSign)
+		);
+	}
+
+	FString FS3RequestSigner::Sha256Hex(const uint8* Data, const int64 Size)
+	{
+		uint8 Hash[SHA256_DIGEST_LENGTH];
+		SHA256(Data, static_cast<size_t>(Size), Hash);
+		return ToHex(Hash, SHA256_DIGEST_LENGTH);
+	}
+
+	FString FS3RequestSigner::Sha256Hex(const FString& Text)
+	{
+		const FTCHARToUTF8 Utf8Text(*Text);
+		return Sha256Hex(reinterpret_cast<const uint8*>(Utf8Text.Get()), Utf8Text.Length());
+	}
+
+	FString FS3RequestSigner::GetHost() const
+	{
+		if (bUsePathStyle)
+		{
+			return EndpointHost;
+		}
+
+		return FString::Printf(TEXT("%s.%s"), *Bucket, *EndpointHost);
+	}
+
+	FString FS3RequestSigner::GetCanonicalUri(const FString& ObjectKey) const
+	{
+		if (bUsePathStyle)
+		{
+			return FString::Printf(TEXT("/%s/%s"), *UriEncode(Bucket, true), *UriEncode(ObjectKey, false));
+		}
+
+		return FString::Printf(TEXT("/%s"), *UriEncode(ObjectKey, false));
+	}
+
+	FString FS3RequestSigner::GetCanonicalQueryString(const TMap<FString, FString>& QueryParameters)
+	{
+		TArray<FString> EncodedParameters;
+		for (const auto& Pair : QueryParameters)
+		{
+			EncodedParameters.Add(FString::Printf(TEXT("%s=%s"), *UriEncode(Pair.Key, true), *UriEncode(Pair.Value, true)));
+		}
+
+		// Parameters are sorted by their encoded byte value, which is the same as an ordinal comparison here.
+		EncodedParameters.Sort([](const FString& A, const FString& B)
+		{
+			return (FCString::Strcmp(*A, *B) < 0);
+		});
+
+		return FString::Join(EncodedParameters, TEXT("&"));
+	}
+
+	FString FS3RequestSigner::CalculateSignature(const FString& DateStamp, const FString& StringToSign) const
+	{
+		const FTCHARToUTF8 Utf8SecretKey(*FString::Printf(TEXT("AWS4%s"), *SecretAccessKey));
+		const TArray<uint8> SecretKey(reinterpret_cast<const uint8*>(Utf8SecretKey.Get()), Utf8SecretKey.Length());
+
+		const TArray<uint8> DateKey = HmacSha256(SecretKey, DateStamp);
+		const TArray<uint8> RegionKey = HmacSha256(DateKey, Region);
+		const TArray<uint8> ServiceKey = HmacSha256(RegionKey, TEXT("s3"));
+		const TArray<uint8> SigningKey = HmacSha256(ServiceKey, TEXT("aws4_request"));
+
+		const TArray<uint8> Signature = HmacSha256(SigningKey, StringToSign);
+		return ToHex(Signature.GetData(), Signature.Num());
+	}
+
+	FString FS3RequestSigner::GetCredentialScope(const FString& DateStamp) const
+	{
+		return FString::Printf(TEXT("%s/%s/s3/aws4_request"), *DateStamp, *Region);
+	}
+
+	FString FS3RequestSigner::UriEncode(const FString& Value, const bool bEncodeSlash)
+	{
+		const FTCHARToUTF8 Utf8Value(*Value);
+		const ANSICHAR* Chars = Utf8Value.Get();
+
+		FString EncodedValue;
+		EncodedValue.Reserve(Utf8Value.Length() * 3);
+		for (int32 Index = 0; Index < Utf8Value.Length(); Index++)
+		{
+			const ANSICHAR Char = Chars[Index];
+			const bool bIsUnreserved = (
+				(Char >= 'A' && Char <= 'Z') ||
+				(Char >= 'a' && Char <= 'z') ||
+				(Char >= '0' && Char <= '9') ||
+				Char == '-' || Char == '_' || Char == '.' || Char == '~'
+			);
+
+			if (bIsUnreserved || (Char == '/' && !bEncodeSlash))
+			{
+				EncodedValue.AppendChar(static_cast<TCHAR>(Char));
+			}
+			else
+			{
+				EncodedValue += FString::Printf(TEXT("%%%02X"), static_cast<uint8>(Char));
+			}
+		}
+
+		return EncodedValue;
+	}
+
+	TArray<uint8> FS3RequestSigner::HmacSha256(const TArray<uint8>& Key, const FString& Text)
+	{
+		const FTCHARToUTF8 Utf8Text(*Text);
+
+		TArray<uint8> Result;
+		Result.SetNumUninitialized(EVP_MAX_MD_SIZE);
+		unsigned int ResultLength = 0;
+		HMAC(
+			EVP_sha256(),
+			Key.GetData(),
+			Key.Num(),
+			reinterpret_cast<const unsigned char*>(Utf8Text.Get()),
+			static_cast<size_t>(Utf8Text.Length()),
+			Result.GetData(),
+			&ResultLength
+		);
+		Result.SetNum(static_cast<int32>(ResultLength));
+
+		return Result;
+	}
+
+	FString FS3RequestSigner::ToHex(const uint8* Data, const int32 Size)
+	{
+		return BytesToHex(Data, Size).ToLower();
+	}
+}
@@ -0,0 +1,82 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+
+class US3Settings;
+
+namespace PluginBuilder
+{
+	/**
+	 * A class that builds object URLs and signs requests with AWS Signature Version 4.
+	 * The connection settings are copied when constructed, so an instance can be used from any thread.
+	 */
+	class FS3RequestSigner
+	{
+	public:
+		// The payload hash used for requests whose body is not hashed, such as part uploads.
+		static const FString UnsignedPayload;
+
+	public:
+		// Constructor.
+		explicit FS3RequestSigner(const US3Settings& Settings);
+
+		// Sets the URL and the signing headers of a request for the specified object.
+		// PayloadHash is the hex encoded SHA-256 of the body, or UnsignedPayload.
+		void SignRequest(
+			IHttpRequest& Request,
+			const FString& Verb,
+			const FString& ObjectKey,
+			const TMap<FString, FString>& QueryParameters,
+			const FString& PayloadHash
+		) const;
+
+		// Returns a URL that allows anyone to download the specified object until it expires.
+		FString PresignGetObjectUrl(const FString& ObjectKey, int32 ExpiresInSeconds) const;
+
+		// Returns the hex encoded SHA-256 hash of the specified data.
+		static FString Sha256Hex(const uint8* Data, int64 Size);
+		static FString Sha256Hex(const FString& Text);
+
+	private:
+		// Returns the host name of the bucket, including the port if specified.
+		FString GetHost() const;
+
+		// Returns the URI-encoded path of the specified object.
+		FString GetCanonicalUri(const FString& ObjectKey) const;
+
+		// Returns the query parameters sorted and encoded as required by the signature.
+		static FString GetCanonicalQueryString(const TMap<FString, FString>& QueryParameters);
+
+		// Returns the signature of the specified string to sign.
+		FString CalculateSignature(const FString& DateStamp, const FString& StringToSign) const;
+
+		// Returns the credential scope for the specified date.
+		FString GetCredentialScope(const FString& DateStamp) const;
+
+		// Encodes a string as required by the signature. '/' is kept as is unless bEncodeSlash is true.
+		static FString UriEncode(const FString& Value, bool bEncodeSlash);
+
+		// Returns the HMAC-SHA256 of the specified text.
+		static TArray<uint8> HmacSha256(const TArray<uint8>& Key, const FString& Text);
+
+		// Returns the specified bytes as a lowercase hex string.
+		static FString ToHex(const uint8* Data, int32 Size);
+
+	private:
+		// The scheme of the endpoint (http or https).
+		FString Scheme;
+
+		// The host name and port of the endpoint.
+		FString EndpointHost;
+
+		// The connection and credential settings.
+		FString Region;
+		FString Bucket;
+		FString AccessKeyId;
+		FString SecretAccessKey;
+		bool bUsePathStyle;
+	};
+}
@@ -0,0 +1,97 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/CloudStorages/UploadBandwidthThrottle.h"
+#include "PluginBuilder/Utilities/PluginBuilderEditorSettings.h"
+#include "PluginBuilder/Utilities/PluginBuilderSettings.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+
+namespace PluginBuilder
+{
+	FUploadBandwidthThrottle::FUploadBandwidthThrottle()
+		: Tokens(0.)
+		, LastRefillTime(FPlatformTime::Seconds())
+	{
+	}
+
+	FUploadBandwidthThrottle& FUploadBandwidthThrottle::Get()
+	{
+		check(IsInGameThread());
+		static FUploadBandwidthThrottle Instance;
+		return Instance;
+	}
+
+	int64 FUploadBandwidthThrottle::GetCurrentBandwidthLimit()
+	{
+		const auto& Settings = GetSettings<UPluginBuilderEditorSettings>();
+
+		int32 LimitKilobytesPerSecond = Settings.UploadBandwidthLimit;
+		if (Settings.bUseWorkHoursUploadBandwidthLimit)
+		{
+			const FDateTime Now = FDateTime::Now();
+			const EDayOfWeek DayOfWeek = Now.GetDayOfWeek();
+			const bool bIsWeekend = (DayOfWeek == EDayOfWeek::Saturday || DayOfWeek == EDayOfWeek::Sunday);
+
+			const int32 Hour = Now.GetHour();
+			const int32 StartHour = Settings.WorkHoursStartHour;
+			const int32 EndHour = Settings.WorkHoursEndHour;
+
+			// A range whose end is before its start wraps past midnight (e.g. 22 to 6).
+			const bool bIsInWorkHours = (
+				(StartHour <= EndHour) ?
+				(StartHour <= Hour && Hour < EndHour) :
+				(StartHour <= Hour || Hour < EndHour)
+			);
+
+			if (bIsInWorkHours && !(Settings.bWorkHoursOnWeekdaysOnly && bIsWeekend))
+			{
+				LimitKilobytesPerSecond = Settings.WorkHoursUploadBandwidthLimit;
+			}
+		}
+
+		return (static_cast<int64>(FMath::Max(LimitKilobytesPerSecond, 0)) * 1024);
+	}
+
+	double FUploadBandwidthThrottle::Reserve(const int64 NumBytes)
+	{
+		const int64 BytesPerSecond = GetCurrentBandwidthLimit();
+		if (BytesPerSecond <= 0)
+		{
+			Tokens = 0.;
+			LastRefillTime = FPlatformTime::Seconds();
+			return 0.;
+		}
+
+		Refill(BytesPerSecond);
+
+		Tokens -= static_cast<double>(NumBytes);
+		if (Tokens >= 0.)
+		{
+			return 0.;
+		}
+
+		return (-Tokens / static_cast<double>(BytesPerSecond));
+	}
+
+	int64 FUploadBandwidthThrottle::GetPacedChunkSize(const int64 MaxChunkSize, const int64 Granularity)
+	{
+		const int64 BytesPerSecond = GetCurrentBandwidthLimit();
+		if (BytesPerSecond <= 0)
+		{
+			return MaxChunkSize;
+		}
+
+		// Aim for about one request per second so that progress updates stay smooth under a low limit.
+		const int64 NumGranules = FMath::Max<int64>(BytesPerSecond / Granularity, 1);
+		return FMath::Min(NumGranules * Granularity, MaxChunkSize);
+	}
+
+	void FUploadBandwidthThrottle::Refill(const int64 BytesPerSecond)
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		const double ElapsedTime = (CurrentTime - LastRefillTime);
+		LastRefillTime = CurrentTime;
+
+		Tokens = FMath::Min(Tokens + ElapsedTime * static_cast<double>(BytesPerSecond), static_cast<double>(BytesPerSecond));
+	}
+}
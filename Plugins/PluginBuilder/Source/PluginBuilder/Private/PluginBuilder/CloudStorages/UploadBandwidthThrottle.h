@@ -0,0 +1,46 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * A token bucket that paces upload requests so that the average upload rate stays under the limit in the editor settings.
+	 * Tokens are bytes, and the bucket can hold at most one second worth of the current limit.
+	 * Providers use the shared instance, so that the limit applies to the total of all upload destinations.
+	 */
+	class FUploadBandwidthThrottle
+	{
+	public:
+		// Constructor.
+		FUploadBandwidthThrottle();
+
+		// Returns the throttle shared by all providers. Must be used from the game thread.
+		static FUploadBandwidthThrottle& Get();
+
+		// Returns the upload bandwidth limit in bytes per second that applies right now.
+		// Returns 0 if uploads are not limited.
+		static int64 GetCurrentBandwidthLimit();
+
+		// Takes the tokens needed to send the specified number of bytes and returns how many seconds the caller
+		// should wait before sending them. The bucket may go into debt, which delays the following requests.
+		double Reserve(int64 NumBytes);
+
+		// Returns a request size suited to the current limit, so that requests are sent at a steady pace.
+		// The result is a multiple of Granularity and no larger than MaxChunkSize.
+		static int64 GetPacedChunkSize(int64 MaxChunkSize, int64 Granularity);
+
+	private:
+		// Adds the tokens accumulated since the last refill.
+		void Refill(int64 BytesPerSecond);
+
+	private:
+		// The number of bytes that can currently be sent without waiting.
+		double Tokens;
+
+		// The time of the last refill in seconds.
+		double LastRefillTime;
+	};
+}
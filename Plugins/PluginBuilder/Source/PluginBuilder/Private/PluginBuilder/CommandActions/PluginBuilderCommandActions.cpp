@@ -4,7 +4,7 @@
 #include "PluginBuilder/Utilities/PluginPackager.h"
 #include "PluginBuilder/Utilities/PluginBuilderEditorSettings.h"
 #include "PluginBuilder/Utilities/PluginBuilderPackagingSettings.h"
-#include "PluginBuilder/Utilities/OneDriveSettings.h"
+#include "PluginBuilder/Widgets/SBuildMonitor.h"
 #include "PluginBuilder/CloudStorages/CloudStorageManager.h"
 #include "PluginBuilder/CloudStorages/ICloudStorageProvider.h"
 #include "PluginBuilder/PluginBuilderGlobals.h"
@@ -91,6 +91,30 @@ namespace PluginBuilder
 		return Settings.bUnversioned;
 	}
 
+	void FPluginBuilderCommandActions::ToggleStopOnFirstBuildError()
+	{
+		auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
+		Settings.bStopOnFirstBuildError = !Settings.bStopOnFirstBuildError;
+	}
+
+	bool FPluginBuilderCommandActions::GetStopOnFirstBuildErrorState()
+	{
+		const auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
+		return Settings.bStopOnFirstBuildError;
+	}
+
+	void FPluginBuilderCommandActions::ToggleBuildWithUBTDirectly()
+	{
+		auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
+		Settings.bBuildWithUBTDirectly = !Settings.bBuildWithUBTDirectly;
+	}
+
+	bool FPluginBuilderCommandActions::GetBuildWithUBTDirectlyState()
+	{
+		const auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
+		return Settings.bBuildWithUBTDirectly;
+	}
+
 	void FPluginBuilderCommandActions::ToggleZipUp()
 	{
 		auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
@@ -156,6 +180,11 @@ namespace PluginBuilder
 		OpenSettings<UPluginBuilderEditorSettings>();
 	}
 
+	void FPluginBuilderCommandActions::OpenBuildMonitor()
+	{
+		SBuildMonitor::OpenTab();
+	}
+
 	void FPluginBuilderCommandActions::ToggleAutoUploadZipFiles()
 	{
 		auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
@@ -180,9 +209,21 @@ namespace PluginBuilder
 		return Settings.bGetShareUrls;
 	}
 
+	void FPluginBuilderCommandActions::ToggleSkipIdenticalUploads()
+	{
+		auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
+		Settings.bSkipIdenticalUploads = !Settings.bSkipIdenticalUploads;
+	}
+
+	bool FPluginBuilderCommandActions::GetSkipIdenticalUploadsState()
+	{
+		const auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
+		return Settings.bSkipIdenticalUploads;
+	}
+
 	void FPluginBuilderCommandActions::OpenCloudStorageSettings()
 	{
-		OpenSettings<UOneDriveSettings>();
+		FCloudStorageManager::OpenCurrentProviderSettings();
 	}
 
 	bool FPluginBuilderCommandActions::IsCloudStorageAuthenticated()
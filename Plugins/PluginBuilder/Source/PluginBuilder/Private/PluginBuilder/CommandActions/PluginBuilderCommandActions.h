@@ -36,6 +36,14 @@ namespace PluginBuilder
 		static void ToggleUnversioned();
 		static bool GetUnversionedState();
 
+		// Whether to skip the remaining builds and zips as soon as a compile error is found in the build for one engine version.
+		static void ToggleStopOnFirstBuildError();
+		static bool GetStopOnFirstBuildErrorState();
+
+		// Whether to build with UnrealBuildTool directly instead of the BuildPlugin command of UAT.
+		static void ToggleBuildWithUBTDirectly();
+		static bool GetBuildWithUBTDirectlyState();
+
 		// Whether to create a zip file that contains only the files we need after the build.
 		static void ToggleZipUp();
 		static bool GetZipUpState();
@@ -63,6 +71,9 @@ namespace PluginBuilder
 		// Opens the settings for Plugin Builder.
 		static void OpenBuildSettings();
 
+		// Opens the build monitor tab.
+		static void OpenBuildMonitor();
+
 		// Whether to automatically upload packaged zip files to cloud storage after the zip step.
 		static void ToggleAutoUploadZipFiles();
 		static bool GetAutoUploadZipFilesState();
@@ -71,6 +82,10 @@ namespace PluginBuilder
 		static void ToggleGetShareUrls();
 		static bool GetGetShareUrlsState();
 
+		// Whether to skip uploading files whose content is identical to the remote file.
+		static void ToggleSkipIdenticalUploads();
+		static bool GetSkipIdenticalUploadsState();
+
 		// Opens the cloud storage provider settings page.
 		static void OpenCloudStorageSettings();
 
@@ -82,6 +82,22 @@ namespace PluginBuilder
 			FInputChord()
 		);
 
+		UI_COMMAND(
+			StopOnFirstBuildError,
+			"Stop On First Build Error",
+			"Whether to skip the remaining builds and zips as soon as a compile error is found in the build for one engine version.",
+			EUserInterfaceActionType::ToggleButton,
+			FInputChord()
+		);
+
+		UI_COMMAND(
+			BuildWithUBTDirectly,
+			"Build With UBT Directly",
+			"Whether to build with UnrealBuildTool directly instead of the BuildPlugin command of UAT, for quick iteration builds. A host project is kept for each engine version so that only changed files are rebuilt.",
+			EUserInterfaceActionType::ToggleButton,
+			FInputChord()
+		);
+
 		UI_COMMAND(
 			ZipUp,
 			"Zip Up",
@@ -130,6 +146,14 @@ namespace PluginBuilder
 			FInputChord()
 		);
 
+		UI_COMMAND(
+			OpenBuildMonitor,
+			"Build Monitor",
+			"Opens the tab that shows the progress, output and diagnostics of each task of the packaging process.",
+			EUserInterfaceActionType::Button,
+			FInputChord()
+		);
+
 		UI_COMMAND(
 			AutoUploadZipFiles,
 			"Auto Upload Zip Files",
@@ -146,6 +170,14 @@ namespace PluginBuilder
 			FInputChord()
 		);
 
+		UI_COMMAND(
+			SkipIdenticalUploads,
+			"Skip Identical Uploads",
+			"Whether to skip uploading a file when the file on cloud storage already has exactly the same content.",
+			EUserInterfaceActionType::ToggleButton,
+			FInputChord()
+		);
+
 		UI_COMMAND(
 			ConflictBehaviorReplace,
 			"Replace",
@@ -287,6 +319,20 @@ namespace PluginBuilder
 			FIsActionChecked::CreateStatic(&FPluginBuilderCommandActions::GetUnversionedState)
 		);
 
+		CommandBindings->MapAction(
+			StopOnFirstBuildError,
+			FExecuteAction::CreateStatic(&FPluginBuilderCommandActions::ToggleStopOnFirstBuildError),
+			FCanExecuteAction(),
+			FIsActionChecked::CreateStatic(&FPluginBuilderCommandActions::GetStopOnFirstBuildErrorState)
+		);
+
+		CommandBindings->MapAction(
+			BuildWithUBTDirectly,
+			FExecuteAction::CreateStatic(&FPluginBuilderCommandActions::ToggleBuildWithUBTDirectly),
+			FCanExecuteAction(),
+			FIsActionChecked::CreateStatic(&FPluginBuilderCommandActions::GetBuildWithUBTDirectlyState)
+		);
+
 		CommandBindings->MapAction(
 			ZipUp,
 			FExecuteAction::CreateStatic(&FPluginBuilderCommandActions::ToggleZipUp),
@@ -327,6 +373,11 @@ namespace PluginBuilder
 			FExecuteAction::CreateStatic(&FPluginBuilderCommandActions::OpenBuildSettings)
 		);
 
+		CommandBindings->MapAction(
+			OpenBuildMonitor,
+			FExecuteAction::CreateStatic(&FPluginBuilderCommandActions::OpenBuildMonitor)
+		);
+
 		CommandBindings->MapAction(
 			AutoUploadZipFiles,
 			FExecuteAction::CreateStatic(&FPluginBuilderCommandActions::ToggleAutoUploadZipFiles),
@@ -341,6 +392,13 @@ namespace PluginBuilder
 			FIsActionChecked::CreateStatic(&FPluginBuilderCommandActions::GetGetShareUrlsState)
 		);
 
+		CommandBindings->MapAction(
+			SkipIdenticalUploads,
+			FExecuteAction::CreateStatic(&FPluginBuilderCommandActions::ToggleSkipIdenticalUploads),
+			FCanExecuteAction::CreateStatic(&FPluginBuilderCommandActions::IsCloudStorageAuthenticated),
+			FIsActionChecked::CreateStatic(&FPluginBuilderCommandActions::GetSkipIdenticalUploadsState)
+		);
+
 		CommandBindings->MapAction(
 			ConflictBehaviorReplace,
 			FExecuteAction::CreateStatic(&FPluginBuilderCommandActions::SetConflictBehaviorReplace),
@@ -43,17 +43,22 @@ namespace PluginBuilder
 		TSharedPtr<FUICommandInfo> CreateSubFolder;
 		TSharedPtr<FUICommandInfo> StrictIncludes;
 		TSharedPtr<FUICommandInfo> Unversioned;
+		TSharedPtr<FUICommandInfo> StopOnFirstBuildError;
+		TSharedPtr<FUICommandInfo> BuildWithUBTDirectly;
 		TSharedPtr<FUICommandInfo> ZipUp;
 		TSharedPtr<FUICommandInfo> KeepBinariesFolder;
 		TSharedPtr<FUICommandInfo> OutputAllZipFilesToSingleFolder;
 		TSharedPtr<FUICommandInfo> KeepUPluginProperties;
 		TSharedPtr<FUICommandInfo> AppendEngineVersionToZipFileName;
 		TSharedPtr<FUICommandInfo> OpenBuildSettings;
+		TSharedPtr<FUICommandInfo> OpenBuildMonitor;
 
 		// Whether to automatically upload zip files to cloud storage after packaging.
 		TSharedPtr<FUICommandInfo> AutoUploadZipFiles;
 		// Whether to retrieve a share URL for each uploaded file.
 		TSharedPtr<FUICommandInfo> GetShareUrls;
+		// Whether to skip uploading files whose content is identical to the remote file.
+		TSharedPtr<FUICommandInfo> SkipIdenticalUploads;
 		// Conflict behavior: overwrite the existing file.
 		TSharedPtr<FUICommandInfo> ConflictBehaviorReplace;
 		// Conflict behavior: rename the uploaded file to avoid collision.
@@ -0,0 +1,64 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Commandlets/PluginBuilderWorkerCommandlet.h"
+#include "PluginBuilder/Utilities/BuildWorker.h"
+#include "PluginBuilder/Utilities/RemoteBuildConnection.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "Misc/Paths.h"
+#include "Misc/Parse.h"
+#include "Containers/Ticker.h"
+
+UPluginBuilderWorkerCommandlet::UPluginBuilderWorkerCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = false;
+}
+
+int32 UPluginBuilderWorkerCommandlet::Main(const FString& Params)
+{
+	// Only this machine can connect unless another address is specified, such as 0.0.0.0 for all network interfaces.
+	FString BindAddress = TEXT("127.0.0.1");
+	FParse::Value(*Params, TEXT("BindAddress="), BindAddress);
+
+	int32 PortNo = PluginBuilder::FRemoteBuildConnection::DefaultPortNo;
+	FParse::Value(*Params, TEXT("Port="), PortNo);
+
+	int32 MaxJobs = 1;
+	FParse::Value(*Params, TEXT("MaxJobs="), MaxJobs);
+
+	FString WorkingDirectoryPath = (FPaths::ProjectSavedDir() / TEXT("PluginBuilder") / TEXT("Worker") / FString::FromInt(PortNo));
+	FParse::Value(*Params, TEXT("WorkingDirectory="), WorkingDirectoryPath);
+
+	FString AccessToken;
+	FParse::Value(*Params, TEXT("AccessToken="), AccessToken);
+
+	PluginBuilder::FBuildWorker BuildWorker(WorkingDirectoryPath, MaxJobs, AccessToken);
+	if (!BuildWorker.Start(BindAddress, PortNo))
+	{
+		return 1;
+	}
+
+	double LastTickTime = FPlatformTime::Seconds();
+	while (!IsEngineExitRequested())
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		const float DeltaTime = static_cast<float>(CurrentTime - LastTickTime);
+		LastTickTime = CurrentTime;
+
+		BuildWorker.Tick(DeltaTime);
+#if UE_5_00_OR_LATER
+		FTSTicker::GetCoreTicker().Tick(DeltaTime);
+#else
+		FTicker::GetCoreTicker().Tick(DeltaTime);
+#endif
+		GLog->Flush();
+
+		FPlatformProcess::Sleep(TickInterval);
+	}
+
+	BuildWorker.Shutdown();
+	return 0;
+}
@@ -0,0 +1,31 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PluginBuilderWorkerCommandlet.generated.h"
+
+/**
+ * A commandlet that runs this machine as a build worker until the process is asked to exit.
+ * Usage: UnrealEditor-Cmd <Project> -run=PluginBuilderWorker -AccessToken=<Token> [-BindAddress=127.0.0.1] [-Port=9100] [-MaxJobs=1] [-WorkingDirectory=<Path>]
+ * The worker only listens on this machine unless a BindAddress such as 0.0.0.0 is specified, and refuses builds that do not send the access token.
+ * To try several workers on one machine, start each with its own port. The working directory defaults to one per port.
+ */
+UCLASS()
+class UPluginBuilderWorkerCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	// Constructor.
+	UPluginBuilderWorkerCommandlet();
+
+	// UCommandlet interface.
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface.
+
+private:
+	// How often the running builds are processed, in seconds.
+	static constexpr float TickInterval = 0.05f;
+};
@@ -7,10 +7,14 @@
 #include "PluginBuilder/Utilities/PluginBuilderSettings.h"
 #include "PluginBuilder/UIExtensions/ToolMenuExtender.h"
 #include "PluginBuilder/Utilities/PluginPackager.h"
+#include "PluginBuilder/Utilities/BuildMonitor.h"
+#include "PluginBuilder/Widgets/SBuildMonitor.h"
+#include "PluginBuilder/Types/BuildTargets.h"
 #include "PluginBuilder/Types/EngineVersions.h"
 #include "PluginBuilder/Types/HostPlatforms.h"
 #include "PluginBuilder/Types/TargetPlatforms.h"
 #include "PluginBuilder/DetailCustomizations/OneDriveAuthenticationActionsCustomization.h"
+#include "PluginBuilder/CloudStorages/OneDrive/OneDriveUploadBenchmark.h"
 
 DEFINE_LOG_CATEGORY(LogPluginBuilder);
 
@@ -28,45 +32,79 @@ namespace PluginBuilder
 
 		// IPluginBuilder interface.
 		virtual bool StartPackagePluginTask(const TOptional<FPackagePluginParams>& InParams) override;
+		virtual bool StartBatchPackagePluginTask(const TArray<FPackagePluginParams>& InParamsList) override;
 		virtual bool IsPackagePluginTaskRunning() override;
+		virtual TArray<FBuildDiagnostics> GetLastPackageDiagnostics() override;
+		virtual FPackageRunReport GetLastPackageRunReport() override;
 		// End of IPluginBuilder interface.
 	};
 
 	void FPluginBuilderModule::StartupModule()
 	{
-		// Registers command actions.
-		FPluginBuilderCommands::Register();
-		FPluginBuilderCommands::Bind();
+		// The module is loaded in every editor commandlet, such as cooking, so nothing is done there.
+		// The build worker commandlet collects the engine versions and platforms it needs when it starts.
+		if (!IsRunningCommandlet())
+		{
+			// Registers command actions.
+			FPluginBuilderCommands::Register();
+			FPluginBuilderCommands::Bind();
+
+			// Registers style set.
+			FPluginBuilderStyle::Register();
+
+			// Registers the build target registry before the settings select a build target from it.
+			FBuildTargets::Register();
 
-		// Registers style set.
-		FPluginBuilderStyle::Register();
+			// Registers settings.
+			UPluginBuilderSettings::Register();
 
-		// Registers settings.
-		UPluginBuilderSettings::Register();
+			// Registers menu extension.
+			FToolMenuExtender::Register();
 
-		// Registers menu extension.
-		FToolMenuExtender::Register();
+			// Registers the build monitor tab.
+			SBuildMonitor::RegisterTabSpawner();
 
-		// Registers property type customizations.
-		FOneDriveAuthenticationActionsCustomization::Register();
+			// Registers property type customizations.
+			FOneDriveAuthenticationActionsCustomization::Register();
 
-		// Logs installed engine versions and available platforms.
-		FEngineVersions::LogInstalledEngineVersions();
-		FHostPlatforms::LogAvailableHostPlatformNames();
-		FTargetPlatforms::LogAvailableTargetPlatformNames();
+			// Registers console commands.
+			FOneDriveUploadBenchmark::Register();
+			FPluginPackager::RegisterConsoleCommand();
+
+			// Logs installed engine versions and available platforms.
+			FEngineVersions::LogInstalledEngineVersions();
+			FHostPlatforms::LogAvailableHostPlatformNames();
+			FTargetPlatforms::LogAvailableTargetPlatformNames();
+		}
 	}
 
 	void FPluginBuilderModule::ShutdownModule()
 	{
+		if (IsRunningCommandlet())
+		{
+			return;
+		}
+
 		// Releases static state that holds Slate references before Slate is torn down.
 		FPluginPackager::CleanupStatics();
+		FBuildMonitor::CleanupStatics();
+
+		// Unregisters console commands.
+		FPluginPackager::UnregisterConsoleCommand();
+		FOneDriveUploadBenchmark::Unregister();
 
 		// Unregisters property type customizations.
 		FOneDriveAuthenticationActionsCustomization::Unregister();
 
+		// Unregisters the build monitor tab.
+		SBuildMonitor::UnregisterTabSpawner();
+
 		// Unregisters menu extension.
 		FToolMenuExtender::Unregister();
 
+		// Unregisters the build target registry.
+		FBuildTargets::Unregister();
+
 		// Unregisters style set.
 		FPluginBuilderStyle::Unregister();
 
@@ -82,10 +120,25 @@ namespace PluginBuilder
 		return FPluginPackager::StartPackagePluginTask(InParams);
 	}
 
+	bool FPluginBuilderModule::StartBatchPackagePluginTask(const TArray<FPackagePluginParams>& InParamsList)
+	{
+		return FPluginPackager::StartBatchPackagePluginTask(InParamsList);
+	}
+
 	bool FPluginBuilderModule::IsPackagePluginTaskRunning()
 	{
 		return FPluginPackager::IsPackagePluginTaskRunning();
 	}
+
+	TArray<FBuildDiagnostics> FPluginBuilderModule::GetLastPackageDiagnostics()
+	{
+		return FPluginPackager::GetLastDiagnostics();
+	}
+
+	FPackageRunReport FPluginBuilderModule::GetLastPackageRunReport()
+	{
+		return FPluginPackager::GetLastRunReport();
+	}
 }
 
 IMPLEMENT_MODULE(PluginBuilder::FPluginBuilderModule, PluginBuilder)
@@ -107,45 +107,72 @@ namespace PluginBuilder
 		return GetBuiltPluginDestinationPath();
 	}
 
+	ETaskPhase FBuildPluginTask::GetCurrentTaskPhase() const
+	{
+		if (OutputParser.GetTotalActions() <= 0)
+		{
+			return ETaskPhase::Startup;
+		}
+
+		return (OutputParser.IsLinking() ? ETaskPhase::Link : ETaskPhase::Compile);
+	}
+
 	float FBuildPluginTask::GetProgress() const
 	{
+		const int32 TotalActions = OutputParser.GetTotalActions();
 		if (TotalActions <= 0)
 		{
 			return -1.f;
 		}
 		
-		return FMath::Clamp(static_cast<float>(CompletedActions) / static_cast<float>(TotalActions), 0.f, 1.f);
+		return FMath::Clamp(static_cast<float>(OutputParser.GetCompletedActions()) / static_cast<float>(TotalActions), 0.f, 1.f);
 	}
 
 	FString FBuildPluginTask::GetProgressText() const
 	{
+		const int32 TotalActions = OutputParser.GetTotalActions();
 		if (TotalActions <= 0)
 		{
-			return FString();
+			// Shows what UAT is doing until UBT starts reporting compile actions.
+			return OutputParser.GetCurrentPhase();
 		}
 		
-		return FString::Printf(TEXT("[%d/%d]"), CompletedActions, TotalActions);
+		return FString::Printf(TEXT("[%d/%d]"), OutputParser.GetCompletedActions(), TotalActions);
 	}
 
-	void FBuildPluginTask::OnOutputLine(const FString& Line)
+	FString FBuildPluginTask::GetThroughputText() const
 	{
-		const FString TrimmedLine = Line.TrimStart();
-		if (!TrimmedLine.StartsWith(TEXT("[")))
+		const double ActionsPerSecond = GetActionsPerSecond(OutputParser.GetCompletedActions());
+		if (ActionsPerSecond < 0.0)
 		{
-			return;
+			return FString();
 		}
-		
-		int32 SlashPos = INDEX_NONE;
-		int32 BracketEndPos = INDEX_NONE;
-		if (TrimmedLine.FindChar(TEXT('/'), SlashPos) && TrimmedLine.FindChar(TEXT(']'), BracketEndPos) && (SlashPos < BracketEndPos))
+
+		return FString::Printf(TEXT("%.1f actions/s"), ActionsPerSecond);
+	}
+
+	FString FBuildPluginTask::GetTimingKey() const
+	{
+		FString HostPlatforms = TEXT("NoHost");
+		if (!BuildPluginParams.bNoHostPlatform)
 		{
-			const int32 ParsedCompleted = FCString::Atoi(*TrimmedLine.Mid(1, SlashPos - 1).TrimStartAndEnd());
-			const int32 ParsedTotal = FCString::Atoi(*TrimmedLine.Mid(SlashPos + 1, BracketEndPos - SlashPos - 1).TrimStartAndEnd());
-			if ((ParsedCompleted > 0) && (ParsedTotal > 0))
-			{
-				CompletedActions = ParsedCompleted;
-				TotalActions = ParsedTotal;
-			}
+			HostPlatforms = (BuildPluginParams.HostPlatforms.Num() > 0 ? FString::Join(BuildPluginParams.HostPlatforms, TEXT("+")) : TEXT("Host"));
 		}
+
+		return FString::Printf(
+			TEXT("Build|%s|%s|%s|%s"),
+			*UATBatchFileParams.PluginName,
+			*EngineVersion,
+			*HostPlatforms,
+			*FString::Join(BuildPluginParams.TargetPlatforms, TEXT("+"))
+		);
+	}
+
+	void FBuildPluginTask::GetReportMetrics(TMap<FString, double>& OutMetrics) const
+	{
+		IUATBatchFileTask::GetReportMetrics(OutMetrics);
+
+		// Fewer actions than usual means UBT reused more of the previous build output.
+		OutMetrics.Add(TEXT("actions"), OutputParser.GetTotalActions());
 	}
 }
@@ -24,6 +24,9 @@ namespace PluginBuilder
 		virtual bool IsBuildTask() const override { return true; }
 		virtual float GetProgress() const override;
 		virtual FString GetProgressText() const override;
+		virtual FString GetThroughputText() const override;
+		virtual FString GetTimingKey() const override;
+		virtual void GetReportMetrics(TMap<FString, double>& OutMetrics) const override;
 		// End of IPluginBuilderTask interface.
 
 	protected:
@@ -31,17 +34,11 @@ namespace PluginBuilder
 		virtual void Initialize() override;
 		virtual TArray<FString> GetUATArguments() const override;
 		virtual FString GetDestinationDirectoryPath() const override;
-		virtual void OnOutputLine(const FString& Line) override;
+		virtual ETaskPhase GetCurrentTaskPhase() const override;
 		// End of IUATBatchFileTask interface.
 
 	private:
 		// The dataset used to process plugin build.
 		FBuildPluginParams BuildPluginParams;
-
-		// Total number of compile actions reported by UBT. 0 means unknown.
-		int32 TotalActions = 0;
-
-		// Number of compile actions completed so far.
-		int32 CompletedActions = 0;
 	};
 }
@@ -0,0 +1,971 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Tasks/DirectBuildPluginTask.h"
+#include "PluginBuilder/Types/EngineVersions.h"
+#include "PluginBuilder/Utilities/PackageTrace.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformFile.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "XmlFile.h"
+
+namespace PluginBuilder
+{
+	namespace DirectBuildPluginTask
+	{
+		// The top-level directories of the plugin that are not copied to the host project, since they are build output or not needed to build.
+		static const TArray<FString> ExcludedDirectoryNames = {
+			TEXT("Binaries"),
+			TEXT("Intermediate"),
+			TEXT("Saved"),
+		};
+
+		// The directories of the plugin that BuildPlugin copies to the built plugin in addition to the build products.
+		static const TArray<FString> StagedDirectoryNames = {
+			TEXT("Config"),
+			TEXT("Content"),
+			TEXT("Resources"),
+			TEXT("Shaders"),
+			TEXT("Source"),
+		};
+
+		// Returns whether a path relative to the plugin directory is in a directory that is not copied to the host project.
+		static bool IsExcludedFromHostProject(const FString& RelativePath)
+		{
+			FString TopLevelName;
+			if (!RelativePath.Split(TEXT("/"), &TopLevelName, nullptr))
+			{
+				return false;
+			}
+
+			return (TopLevelName.StartsWith(TEXT(".")) || ExcludedDirectoryNames.Contains(TopLevelName));
+		}
+
+		// Returns the path relative to the directory, or false if the path is not under it.
+		static bool MakeRelativePath(const FString& Path, const FString& DirectoryPath, FString& OutRelativePath)
+		{
+			const FString NormalizedPath = FPaths::ConvertRelativePathToFull(Path);
+			const FString NormalizedDirectoryPath = FPaths::ConvertRelativePathToFull(DirectoryPath) / TEXT("");
+			if (!NormalizedPath.StartsWith(NormalizedDirectoryPath))
+			{
+				return false;
+			}
+
+			OutRelativePath = NormalizedPath.RightChop(NormalizedDirectoryPath.Len());
+			return true;
+		}
+
+		// Makes the destination directory hold the same files as the source directory, except those the filter rejects.
+		// Only files that are new or have changed are copied, so that UBT does not rebuild the ones that have not,
+		// and files that are no longer in the source directory are removed, so that deleted source files are not compiled.
+		static bool MirrorDirectory(
+			const FString& SourceDirectoryPath,
+			const FString& DestinationDirectoryPath,
+			TFunctionRef<bool(const FString& /* RelativePath */)> ShouldMirror,
+			int32& OutNumCopiedFiles,
+			int32& OutNumRemovedFiles
+		)
+		{
+			IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+			if (!PlatformFile.CreateDirectoryTree(*DestinationDirectoryPath))
+			{
+				return false;
+			}
+
+			bool bHasSucceeded = true;
+			OutNumCopiedFiles = 0;
+			TSet<FString> SourceFiles;
+			PlatformFile.IterateDirectoryStatRecursively(
+				*SourceDirectoryPath,
+				[&](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData) -> bool
+				{
+					FString RelativePath;
+					if (StatData.bIsDirectory || !MakeRelativePath(FilenameOrDirectory, SourceDirectoryPath, RelativePath))
+					{
+						return true;
+					}
+					if (!ShouldMirror(RelativePath))
+					{
+						return true;
+					}
+					SourceFiles.Add(RelativePath);
+
+					const FString DestinationFile = (DestinationDirectoryPath / RelativePath);
+					const FFileStatData DestinationStatData = PlatformFile.GetStatData(*DestinationFile);
+					if (DestinationStatData.bIsValid &&
+						(DestinationStatData.FileSize == StatData.FileSize) &&
+						(DestinationStatData.ModificationTime >= StatData.ModificationTime))
+					{
+						return true;
+					}
+
+					PlatformFile.CreateDirectoryTree(*FPaths::GetPath(DestinationFile));
+					if (PlatformFile.CopyFile(*DestinationFile, FilenameOrDirectory))
+					{
+						OutNumCopiedFiles++;
+					}
+					else
+					{
+						UE_LOG(LogPluginBuilder, Error, TEXT("Failed to copy %s to the host project."), FilenameOrDirectory);
+						bHasSucceeded = false;
+					}
+					return true;
+				}
+			);
+
+			TArray<FString> StaleFiles;
+			PlatformFile.IterateDirectoryStatRecursively(
+				*DestinationDirectoryPath,
+				[&](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData) -> bool
+				{
+					FString RelativePath;
+					if (StatData.bIsDirectory || !MakeRelativePath(FilenameOrDirectory, DestinationDirectoryPath, RelativePath))
+					{
+						return true;
+					}
+					if (ShouldMirror(RelativePath) && !SourceFiles.Contains(RelativePath))
+					{
+						StaleFiles.Add(FilenameOrDirectory);
+					}
+					return true;
+				}
+			);
+			for (const FString& StaleFile : StaleFiles)
+			{
+				PlatformFile.DeleteFile(*StaleFile);
+			}
+			OutNumRemovedFiles = StaleFiles.Num();
+
+			return bHasSucceeded;
+		}
+	}
+
+	FString FDirectBuildPluginTask::FTargetBuild::GetLabel() const
+	{
+		return FString::Printf(TEXT("%s %s %s"), *TargetName, *Platform, *Configuration);
+	}
+
+	FDirectBuildPluginTask::FDirectBuildPluginTask(
+		const FString& InEngineVersion,
+		const FUATBatchFileParams& InUATBatchFileParams,
+		const FBuildPluginParams& InBuildPluginParams
+	)
+		: IUATBatchFileTask(InEngineVersion, InUATBatchFileParams)
+		, BuildPluginParams(InBuildPluginParams)
+		, bIsCancelRequested(false)
+	{
+	}
+
+	FDirectBuildPluginTask::~FDirectBuildPluginTask()
+	{
+		CloseTargetBuilds();
+	}
+
+	void FDirectBuildPluginTask::AddPrecompiledDependency(const FString& InBuiltPluginDirectoryPath)
+	{
+		check(State == EState::PreInitialize);
+
+		PrecompiledDependencyDirectoryPaths.AddUnique(InBuiltPluginDirectoryPath);
+	}
+
+	FString FDirectBuildPluginTask::GetStagedPluginDirectoryPath() const
+	{
+		FString OutputDirectoryPath = GetBuiltPluginDestinationPath();
+		if (BuildPluginParams.bCreateSubFolder)
+		{
+			OutputDirectoryPath /= FPaths::GetBaseFilename(UATBatchFileParams.UPluginFile);
+		}
+
+		return OutputDirectoryPath;
+	}
+
+	void FDirectBuildPluginTask::Initialize()
+	{
+		UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
+		UE_LOG(LogPluginBuilder, Log, TEXT("[Plugin Name] %s / [Plugin Version] %s / [Engine Version] %s"), *UATBatchFileParams.GetPluginNameInSpecifiedFormat(), *UATBatchFileParams.PluginVersionName, *EngineVersion);
+		UE_LOG(LogPluginBuilder, Log, TEXT("[Build Mode] UnrealBuildTool (direct)"));
+		UE_LOG(LogPluginBuilder, Log, TEXT("----------------------------------------------------------------------------------------------------"));
+
+		if (!FEngineVersions::FindUBTBatchFileByVersionName(EngineVersion, UBTBatchFile))
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Could not find UBT batch file. (Engine Version = %s)"), *EngineVersion);
+			bHasAnyError = true;
+			State = EState::Terminated;
+			return;
+		}
+
+		FPackageTrace& Trace = FPackageTrace::Get();
+		TraceTrackId = Trace.GetTrackId(GetTraceTrackName());
+
+		// Copying the plugin is done on the game thread, like the staging of zip tasks, and is traced apart from the builds.
+		const int32 HostProjectTraceEventId = Trace.BeginEvent(TraceTrackId, TEXT("Host project"), TEXT("Process"));
+		const bool bHasUpdatedHostProject = UpdateHostProject();
+		Trace.EndEvent(HostProjectTraceEventId);
+		if (!bHasUpdatedHostProject)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Failed to prepare the host project. (%s)"), *GetHostProjectDirectoryPath());
+			bHasAnyError = true;
+			State = EState::Terminated;
+			return;
+		}
+
+		AddTargetBuilds();
+		if (TargetBuilds.Num() == 0)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("There is no host or target platform to build."));
+			bHasAnyError = true;
+			State = EState::Terminated;
+			return;
+		}
+
+		ProcessSpawnTime = FPlatformTime::Seconds();
+		LastPhaseUpdateTime = ProcessSpawnTime;
+		LastMetricsSampleTime = ProcessSpawnTime;
+
+		State = EState::Processing;
+	}
+
+	void FDirectBuildPluginTask::Tick(float DeltaTime)
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		PhaseTimes.Add(GetCurrentTaskPhase(), CurrentTime - LastPhaseUpdateTime);
+		LastPhaseUpdateTime = CurrentTime;
+
+		int32 NumRunningTargetBuilds = 0;
+		for (FTargetBuild& TargetBuild : TargetBuilds)
+		{
+			if (TargetBuild.bHasStarted && !TargetBuild.bHasExited)
+			{
+				UpdateTargetBuild(TargetBuild);
+				if (!TargetBuild.bHasExited)
+				{
+					NumRunningTargetBuilds++;
+				}
+			}
+		}
+
+		// Like BuildPlugin, no more targets are built once one of them has failed.
+		if (!bIsCancelRequested && !bHasAnyError)
+		{
+			for (FTargetBuild& TargetBuild : TargetBuilds)
+			{
+				if (NumRunningTargetBuilds >= MaxConcurrentTargetBuilds)
+				{
+					break;
+				}
+				if (TargetBuild.bHasStarted)
+				{
+					continue;
+				}
+
+				if (StartTargetBuild(TargetBuild))
+				{
+					NumRunningTargetBuilds++;
+				}
+				else
+				{
+					bHasAnyError = true;
+					break;
+				}
+			}
+		}
+
+		if (NumRunningTargetBuilds > 0)
+		{
+			return;
+		}
+
+		const bool bHasBuiltAllTargets = !TargetBuilds.ContainsByPredicate(
+			[](const FTargetBuild& TargetBuild) -> bool
+			{
+				return !TargetBuild.bHasExited;
+			}
+		);
+		if (!bHasBuiltAllTargets && !bHasAnyError)
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("The build was canceled before all targets were built."));
+			bHasAnyError = true;
+		}
+
+		if (!bHasAnyError)
+		{
+			FPackageTrace& Trace = FPackageTrace::Get();
+			const int32 StagingTraceEventId = Trace.BeginEvent(TraceTrackId, TEXT("Staging copy"), TEXT("Process"));
+			if (!StageBuiltPlugin())
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Failed to copy the built plugin. (%s)"), *GetDestinationDirectoryPath());
+				bHasAnyError = true;
+			}
+			Trace.EndEvent(StagingTraceEventId);
+		}
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("----------------------------------------------------------------------------------------------------"));
+		if (!bHasAnyError)
+		{
+			UE_LOG(LogPluginBuilder, Log, TEXT("[Output Directory] %s"), *GetDestinationDirectoryPath());
+		}
+
+		if (bIsMeasuringProcess)
+		{
+			ProcessMetrics.Sample(LastMetricsSample);
+		}
+
+		State = EState::PreTerminate;
+	}
+
+	void FDirectBuildPluginTask::Terminate()
+	{
+		CloseTargetBuilds();
+
+		IUATBatchFileTask::Terminate();
+	}
+
+	void FDirectBuildPluginTask::RequestCancel()
+	{
+		bIsCancelRequested = true;
+
+		if (UATBatchFileParams.bStopPackagingProcessImmediately)
+		{
+			for (FTargetBuild& TargetBuild : TargetBuilds)
+			{
+				if (TargetBuild.bHasStarted && !TargetBuild.bHasExited)
+				{
+					FPlatformProcess::TerminateProc(TargetBuild.ProcessHandle, true);
+				}
+			}
+			CloseTargetBuilds();
+			State = EState::Terminated;
+		}
+	}
+
+	float FDirectBuildPluginTask::GetProgress() const
+	{
+		if (TargetBuilds.Num() == 0)
+		{
+			return -1.f;
+		}
+
+		// Each target counts the same, since the number of actions of a target is unknown until its build starts.
+		float Progress = 0.f;
+		for (const FTargetBuild& TargetBuild : TargetBuilds)
+		{
+			if (TargetBuild.bHasExited)
+			{
+				Progress += 1.f;
+			}
+			else if (TargetBuild.OutputParser.IsValid() && (TargetBuild.OutputParser->GetTotalActions() > 0))
+			{
+				Progress += FMath::Clamp(
+					static_cast<float>(TargetBuild.OutputParser->GetCompletedActions()) / static_cast<float>(TargetBuild.OutputParser->GetTotalActions()),
+					0.f,
+					1.f
+				);
+			}
+		}
+
+		return (Progress / TargetBuilds.Num());
+	}
+
+	FString FDirectBuildPluginTask::GetProgressText() const
+	{
+		int32 NumBuiltTargets = 0;
+		int32 CompletedActions = 0;
+		int32 TotalActions = 0;
+		for (const FTargetBuild& TargetBuild : TargetBuilds)
+		{
+			if (TargetBuild.bHasExited)
+			{
+				NumBuiltTargets++;
+			}
+			else if (TargetBuild.OutputParser.IsValid())
+			{
+				CompletedActions += TargetBuild.OutputParser->GetCompletedActions();
+				TotalActions += TargetBuild.OutputParser->GetTotalActions();
+			}
+		}
+
+		if (TotalActions <= 0)
+		{
+			return FString::Printf(TEXT("%d/%d targets"), NumBuiltTargets, TargetBuilds.Num());
+		}
+
+		return FString::Printf(TEXT("[%d/%d] %d/%d targets"), CompletedActions, TotalActions, NumBuiltTargets, TargetBuilds.Num());
+	}
+
+	FString FDirectBuildPluginTask::GetThroughputText() const
+	{
+		// The targets are built at the same time, so their actions are added up over the time since the first one started.
+		int32 CompletedActions = 0;
+		for (const FTargetBuild& TargetBuild : TargetBuilds)
+		{
+			if (TargetBuild.OutputParser.IsValid())
+			{
+				CompletedActions += TargetBuild.OutputParser->GetCompletedActions();
+			}
+		}
+
+		const double ActionsPerSecond = GetActionsPerSecond(CompletedActions);
+		if (ActionsPerSecond < 0.0)
+		{
+			return FString();
+		}
+
+		return FString::Printf(TEXT("%.1f actions/s"), ActionsPerSecond);
+	}
+
+	FBuildDiagnostics FDirectBuildPluginTask::GetDiagnostics() const
+	{
+		FBuildDiagnostics Diagnostics;
+		Diagnostics.TaskLabel = GetTaskLabel();
+		for (const FTargetBuild& TargetBuild : TargetBuilds)
+		{
+			if (TargetBuild.OutputParser.IsValid())
+			{
+				Diagnostics.Entries.Append(TargetBuild.OutputParser->GetDiagnostics());
+			}
+		}
+		return Diagnostics;
+	}
+
+	FString FDirectBuildPluginTask::GetTimingKey() const
+	{
+		FString HostPlatforms = TEXT("NoHost");
+		if (!BuildPluginParams.bNoHostPlatform)
+		{
+			HostPlatforms = (BuildPluginParams.HostPlatforms.Num() > 0 ? FString::Join(BuildPluginParams.HostPlatforms, TEXT("+")) : TEXT("Host"));
+		}
+
+		// Recorded apart from builds by UAT, since the host project is reused and usually only a few files are rebuilt.
+		return FString::Printf(
+			TEXT("DirectBuild|%s|%s|%s|%s"),
+			*UATBatchFileParams.PluginName,
+			*EngineVersion,
+			*HostPlatforms,
+			*FString::Join(BuildPluginParams.TargetPlatforms, TEXT("+"))
+		);
+	}
+
+	void FDirectBuildPluginTask::GetReportMetrics(TMap<FString, double>& OutMetrics) const
+	{
+		IUATBatchFileTask::GetReportMetrics(OutMetrics);
+
+		int32 TotalActions = 0;
+		for (const FTargetBuild& TargetBuild : TargetBuilds)
+		{
+			if (TargetBuild.OutputParser.IsValid())
+			{
+				TotalActions += TargetBuild.OutputParser->GetTotalActions();
+			}
+		}
+		OutMetrics.Add(TEXT("actions"), TotalActions);
+		OutMetrics.Add(TEXT("targets"), TargetBuilds.Num());
+	}
+
+	TArray<FString> FDirectBuildPluginTask::GetUATArguments() const
+	{
+		// UAT is not used, since each target is built by running UBT directly.
+		return TArray<FString>();
+	}
+
+	FString FDirectBuildPluginTask::GetDestinationDirectoryPath() const
+	{
+		return GetBuiltPluginDestinationPath();
+	}
+
+	ETaskPhase FDirectBuildPluginTask::GetCurrentTaskPhase() const
+	{
+		ETaskPhase CurrentPhase = ETaskPhase::Startup;
+		for (const FTargetBuild& TargetBuild : TargetBuilds)
+		{
+			if (!TargetBuild.bHasStarted || TargetBuild.bHasExited || (TargetBuild.OutputParser->GetTotalActions() <= 0))
+			{
+				continue;
+			}
+
+			if (TargetBuild.OutputParser->IsLinking())
+			{
+				return ETaskPhase::Link;
+			}
+			CurrentPhase = ETaskPhase::Compile;
+		}
+
+		return CurrentPhase;
+	}
+
+	void FDirectBuildPluginTask::AddTargetBuilds()
+	{
+		auto AddTargetBuild = [this](const FString& TargetName, const FString& Platform, const TCHAR* Configuration)
+		{
+			FTargetBuild& TargetBuild = TargetBuilds.AddDefaulted_GetRef();
+			TargetBuild.TargetName = TargetName;
+			TargetBuild.Platform = Platform;
+			TargetBuild.Configuration = Configuration;
+			TargetBuild.ManifestFile = (
+				GetHostProjectDirectoryPath() / TEXT("Intermediate") / TEXT("PluginBuilder") /
+				FString::Printf(TEXT("Manifest-%s-%s-%s.xml"), *TargetName, *Platform, Configuration)
+			);
+		};
+
+		// The editor targets of the host platforms are built first, since they are usually the ones being iterated on.
+		if (!BuildPluginParams.bNoHostPlatform)
+		{
+			TArray<FString> HostPlatforms = BuildPluginParams.HostPlatforms;
+			if (HostPlatforms.Num() == 0)
+			{
+				HostPlatforms.Add(FPlatformMisc::GetUBTPlatform());
+			}
+			for (const FString& HostPlatform : HostPlatforms)
+			{
+				AddTargetBuild(GetEditorTargetName(), HostPlatform, TEXT("Development"));
+			}
+		}
+
+		// Unlike BuildPlugin, only the current host platform is built for games if no target platform is specified, to keep iteration builds short.
+		TArray<FString> TargetPlatforms = BuildPluginParams.TargetPlatforms;
+		if (TargetPlatforms.Num() == 0)
+		{
+			TargetPlatforms.Add(FPlatformMisc::GetUBTPlatform());
+		}
+		for (const FString& TargetPlatform : TargetPlatforms)
+		{
+			AddTargetBuild(GetGameTargetName(), TargetPlatform, TEXT("Development"));
+			AddTargetBuild(GetGameTargetName(), TargetPlatform, TEXT("Shipping"));
+		}
+	}
+
+	bool FDirectBuildPluginTask::UpdateHostProject() const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDirectBuildPluginTask_UpdateHostProject);
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		const FString SourceDirectoryPath = FPaths::GetPath(UATBatchFileParams.UPluginFile);
+		const FString HostPluginDirectoryPath = GetHostPluginDirectoryPath();
+		if (!PlatformFile.CreateDirectoryTree(*HostPluginDirectoryPath))
+		{
+			return false;
+		}
+
+		// The project file is only rewritten when it changes, since UBT rebuilds its makefiles when it is newer.
+		const FString HostProjectFile = GetHostProjectFile();
+		const FString HostProjectContents = FString::Printf(
+			TEXT("{\n\t\"FileVersion\": 3,\n\t\"Plugins\": [\n\t\t{\n\t\t\t\"Name\": \"%s\",\n\t\t\t\"Enabled\": true\n\t\t}\n\t]\n}\n"),
+			*FPaths::GetBaseFilename(UATBatchFileParams.UPluginFile)
+		);
+		FString ExistingHostProjectContents;
+		if (!FFileHelper::LoadFileToString(ExistingHostProjectContents, *HostProjectFile) || !ExistingHostProjectContents.Equals(HostProjectContents))
+		{
+			if (!FFileHelper::SaveStringToFile(HostProjectContents, *HostProjectFile))
+			{
+				return false;
+			}
+		}
+
+		int32 NumCopiedFiles = 0;
+		int32 NumRemovedFiles = 0;
+		const bool bHasSucceeded = DirectBuildPluginTask::MirrorDirectory(
+			SourceDirectoryPath,
+			HostPluginDirectoryPath,
+			[](const FString& RelativePath) -> bool
+			{
+				return !DirectBuildPluginTask::IsExcludedFromHostProject(RelativePath);
+			},
+			NumCopiedFiles,
+			NumRemovedFiles
+		);
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("[Host Project] %s (%d file(s) updated, %d removed)"), *HostProjectFile, NumCopiedFiles, NumRemovedFiles);
+		return (bHasSucceeded && UpdateHostProjectDependencies());
+	}
+
+	bool FDirectBuildPluginTask::UpdateHostProjectDependencies() const
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		const FString HostPluginsDirectoryPath = FPaths::GetPath(GetHostPluginDirectoryPath());
+		TSet<FString> UsedPluginNames = { FPaths::GetBaseFilename(UATBatchFileParams.UPluginFile) };
+
+		bool bHasSucceeded = true;
+		for (const FString& DependencyDirectoryPath : PrecompiledDependencyDirectoryPaths)
+		{
+			TArray<FString> DependencyUPluginFiles;
+			PlatformFile.FindFiles(DependencyUPluginFiles, *DependencyDirectoryPath, TEXT(".uplugin"));
+			if (DependencyUPluginFiles.Num() != 1)
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Could not find the built plugin of a dependency. (%s)"), *DependencyDirectoryPath);
+				bHasSucceeded = false;
+				continue;
+			}
+
+			// The whole built plugin is copied, since the binaries and the import libraries in Intermediate are what is linked against.
+			const FString DependencyName = FPaths::GetBaseFilename(DependencyUPluginFiles[0]);
+			const FString HostDependencyDirectoryPath = (HostPluginsDirectoryPath / DependencyName);
+			UsedPluginNames.Add(DependencyName);
+
+			int32 NumCopiedFiles = 0;
+			int32 NumRemovedFiles = 0;
+			if (!DirectBuildPluginTask::MirrorDirectory(
+				DependencyDirectoryPath,
+				HostDependencyDirectoryPath,
+				[](const FString& RelativePath) -> bool
+				{
+					return true;
+				},
+				NumCopiedFiles,
+				NumRemovedFiles
+			))
+			{
+				bHasSucceeded = false;
+				continue;
+			}
+
+			// UBT uses the binaries of installed plugins as they are rather than compiling their modules.
+			const FString HostDependencyUPluginFile = (HostDependencyDirectoryPath / FPaths::GetCleanFilename(DependencyUPluginFiles[0]));
+			FString UPluginContents;
+			TSharedPtr<FJsonObject> UPluginObject;
+			if (!FFileHelper::LoadFileToString(UPluginContents, *HostDependencyUPluginFile) ||
+				!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(UPluginContents), UPluginObject) ||
+				!UPluginObject.IsValid())
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Failed to read %s."), *HostDependencyUPluginFile);
+				bHasSucceeded = false;
+				continue;
+			}
+			bool bIsInstalled = false;
+			if (!UPluginObject->TryGetBoolField(TEXT("Installed"), bIsInstalled) || !bIsInstalled)
+			{
+				UPluginObject->SetBoolField(TEXT("Installed"), true);
+
+				FString JsonString;
+				const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+				FJsonSerializer::Serialize(UPluginObject.ToSharedRef(), Writer);
+				FFileHelper::SaveStringToFile(JsonString, *HostDependencyUPluginFile);
+			}
+
+			UE_LOG(LogPluginBuilder, Log, TEXT("[Precompiled Dependency] %s (%d file(s) updated, %d removed)"), *DependencyName, NumCopiedFiles, NumRemovedFiles);
+		}
+
+		// A dependency left from an earlier run would otherwise be used instead of the one in the engine or the project.
+		TArray<FString> StalePluginDirectoryPaths;
+		PlatformFile.IterateDirectory(
+			*HostPluginsDirectoryPath,
+			[&](const TCHAR* FilenameOrDirectory, const bool bIsDirectory) -> bool
+			{
+				if (bIsDirectory && !UsedPluginNames.Contains(FPaths::GetCleanFilename(FilenameOrDirectory)))
+				{
+					StalePluginDirectoryPaths.Add(FilenameOrDirectory);
+				}
+				return true;
+			}
+		);
+		for (const FString& StalePluginDirectoryPath : StalePluginDirectoryPaths)
+		{
+			PlatformFile.DeleteDirectoryRecursively(*StalePluginDirectoryPath);
+		}
+
+		return bHasSucceeded;
+	}
+
+	bool FDirectBuildPluginTask::StartTargetBuild(FTargetBuild& TargetBuild)
+	{
+		TargetBuild.bHasStarted = true;
+
+		// A manifest left from the last build would list the build products even if this build fails to write it.
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.DeleteFile(*TargetBuild.ManifestFile);
+
+		const FString Label = TargetBuild.GetLabel();
+		TargetBuild.OutputParser = MakeUnique<FUATOutputParser>();
+		TargetBuild.OutputParser->OnOutputLine.BindLambda(
+			[this, Label](const TCHAR* Line)
+			{
+				// The output of the targets built at the same time is interleaved, so each line is prefixed with its target.
+				UE_LOG(LogPluginBuilder, Log, TEXT("[%s] %s"), *Label, Line);
+				OutputLog->AddLine(*FString::Printf(TEXT("[%s] %s"), *Label, Line));
+			}
+		);
+		TargetBuild.OutputParser->OnDiagnostic.BindRaw(this, &FDirectBuildPluginTask::HandleOnDiagnostic);
+
+		const FString Arguments = FString::Join(GetUBTArguments(TargetBuild), TEXT(" "));
+		UE_LOG(LogPluginBuilder, Log, TEXT("[UBT] %s"), *Arguments);
+
+		void* WritePipe = nullptr;
+		FPlatformProcess::CreatePipe(TargetBuild.ReadPipe, WritePipe);
+		TargetBuild.ProcessHandle = FPlatformProcess::CreateProc(
+			*UBTBatchFile,
+			*Arguments,
+			false,
+			true,
+			true,
+			nullptr,
+			0,
+			nullptr,
+			WritePipe,
+			nullptr
+		);
+		if (!TargetBuild.ProcessHandle.IsValid())
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("UBT process did not run. (%s)"), *Label);
+			TargetBuild.bHasExited = true;
+			return false;
+		}
+
+		if (ProcessMetrics.Attach(TargetBuild.ProcessHandle))
+		{
+			bIsMeasuringProcess = true;
+		}
+		TargetBuild.TraceEventId = FPackageTrace::Get().BeginEvent(TraceTrackId, Label, TEXT("Process"), true);
+		return true;
+	}
+
+	void FDirectBuildPluginTask::UpdateTargetBuild(FTargetBuild& TargetBuild)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDirectBuildPluginTask_UpdateTargetBuild);
+
+		// Checked before reading, so that the output written just before the process exited is not missed.
+		const bool bIsRunning = FPlatformProcess::IsProcRunning(TargetBuild.ProcessHandle);
+		if (FPlatformProcess::ReadPipeToArray(TargetBuild.ReadPipe, OutputBytes))
+		{
+			TargetBuild.OutputParser->Feed(OutputBytes.GetData(), OutputBytes.Num());
+		}
+		if (bIsRunning)
+		{
+			return;
+		}
+
+		TargetBuild.OutputParser->Flush();
+		TargetBuild.bHasExited = true;
+
+		int32 ReturnCode;
+		if (!FPlatformProcess::GetProcReturnCode(TargetBuild.ProcessHandle, &ReturnCode))
+		{
+			ReturnCode = INDEX_NONE;
+		}
+
+		if (ReturnCode == 0)
+		{
+			UE_LOG(LogPluginBuilder, Log, TEXT("[%s] [Return Code] %d"), *TargetBuild.GetLabel(), ReturnCode);
+		}
+		else
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("[%s] [Return Code] %d"), *TargetBuild.GetLabel(), ReturnCode);
+			bHasAnyError = true;
+		}
+
+		FPackageTrace::Get().EndEvent(
+			TargetBuild.TraceEventId,
+			{
+				{ TEXT("returnCode"), static_cast<double>(ReturnCode) },
+				{ TEXT("actions"), static_cast<double>(TargetBuild.OutputParser->GetTotalActions()) }
+			}
+		);
+		TargetBuild.TraceEventId = INDEX_NONE;
+	}
+
+	TArray<FString> FDirectBuildPluginTask::GetUBTArguments(const FTargetBuild& TargetBuild) const
+	{
+		const FString HostPluginFile = (GetHostPluginDirectoryPath() / FPaths::GetCleanFilename(UATBatchFileParams.UPluginFile));
+
+		// These are the arguments BuildPlugin passes to UBT, except that makefiles are kept for incremental builds.
+		// Several UBT processes run at the same time, so they must not wait for each other's mutex.
+		TArray<FString> Arguments = {
+			TargetBuild.TargetName,
+			TargetBuild.Platform,
+			TargetBuild.Configuration,
+			FString::Printf(TEXT("-Project=\"%s\""), *GetHostProjectFile()),
+			FString::Printf(TEXT("-Plugin=\"%s\""), *HostPluginFile),
+			FString::Printf(TEXT("-Manifest=\"%s\""), *TargetBuild.ManifestFile),
+			TEXT("-NoHotReload"),
+			TEXT("-NoMutex"),
+		};
+		if (BuildPluginParams.bStrictIncludes)
+		{
+			// UE5.3 engine code does not compile with strict includes, which BuildPluginTask also works around.
+			if (EngineVersion.StartsWith(TEXT("5.3")))
+			{
+				UE_LOG(LogPluginBuilder, Warning, TEXT("In UE5.3, enabling strict includes causes an include error in the engine code, so exclude strict includes."));
+			}
+			else
+			{
+				Arguments.Append({ TEXT("-NoPCH"), TEXT("-NoSharedPCH"), TEXT("-DisableUnity") });
+			}
+		}
+
+		return Arguments;
+	}
+
+	bool FDirectBuildPluginTask::StageBuiltPlugin() const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDirectBuildPluginTask_StageBuiltPlugin);
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		const FString SourceDirectoryPath = FPaths::GetPath(UATBatchFileParams.UPluginFile);
+		const FString HostPluginDirectoryPath = GetHostPluginDirectoryPath();
+		PlatformFile.DeleteDirectoryRecursively(*GetBuiltPluginDestinationPath());
+		const FString OutputDirectoryPath = GetStagedPluginDirectoryPath();
+		if (!PlatformFile.CreateDirectoryTree(*OutputDirectoryPath))
+		{
+			return false;
+		}
+
+		for (const FString& DirectoryName : DirectBuildPluginTask::StagedDirectoryNames)
+		{
+			const FString SourcePath = (SourceDirectoryPath / DirectoryName);
+			if (PlatformFile.DirectoryExists(*SourcePath))
+			{
+				PlatformFile.CopyDirectoryTree(*(OutputDirectoryPath / DirectoryName), *SourcePath, true);
+			}
+		}
+
+		// Additional files listed in the [FilterPlugin] section, such as "/Docs/..." or "/README.md".
+		TArray<FString> FilterLines;
+		if (FFileHelper::LoadFileToStringArray(FilterLines, *(SourceDirectoryPath / TEXT("Config") / TEXT("FilterPlugin.ini"))))
+		{
+			for (FString FilterLine : FilterLines)
+			{
+				FilterLine.TrimStartAndEndInline();
+				if (!FilterLine.StartsWith(TEXT("/")))
+				{
+					continue;
+				}
+
+				FString RelativePath = FilterLine.RightChop(1);
+				RelativePath.RemoveFromEnd(TEXT("/..."));
+				const FString SourcePath = (SourceDirectoryPath / RelativePath);
+				if (PlatformFile.DirectoryExists(*SourcePath))
+				{
+					PlatformFile.CopyDirectoryTree(*(OutputDirectoryPath / RelativePath), *SourcePath, true);
+				}
+				else if (PlatformFile.FileExists(*SourcePath))
+				{
+					PlatformFile.CreateDirectoryTree(*FPaths::GetPath(OutputDirectoryPath / RelativePath));
+					PlatformFile.CopyFile(*(OutputDirectoryPath / RelativePath), *SourcePath);
+				}
+			}
+		}
+
+		TSet<FString> BuildProducts;
+		for (const FTargetBuild& TargetBuild : TargetBuilds)
+		{
+			if (!ReadManifest(TargetBuild, BuildProducts))
+			{
+				UE_LOG(LogPluginBuilder, Warning, TEXT("Could not read the build products of %s, so the whole Binaries folder is copied instead."), *TargetBuild.GetLabel());
+				PlatformFile.CopyDirectoryTree(*(OutputDirectoryPath / TEXT("Binaries")), *(HostPluginDirectoryPath / TEXT("Binaries")), true);
+			}
+		}
+		for (const FString& BuildProduct : BuildProducts)
+		{
+			// Products outside the plugin, such as the receipts of the host project, are not part of the built plugin.
+			FString RelativePath;
+			if (!DirectBuildPluginTask::MakeRelativePath(BuildProduct, HostPluginDirectoryPath, RelativePath))
+			{
+				continue;
+			}
+
+			const FString DestinationFile = (OutputDirectoryPath / RelativePath);
+			PlatformFile.CreateDirectoryTree(*FPaths::GetPath(DestinationFile));
+			if (!PlatformFile.CopyFile(*DestinationFile, *BuildProduct))
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Failed to copy %s to the built plugin."), *BuildProduct);
+				return false;
+			}
+		}
+
+		// BuildPlugin embeds the engine version into the descriptor unless the plugin is built unversioned.
+		const FString OutputUPluginFile = (OutputDirectoryPath / FPaths::GetCleanFilename(UATBatchFileParams.UPluginFile));
+		if (!PlatformFile.CopyFile(*OutputUPluginFile, *UATBatchFileParams.UPluginFile))
+		{
+			return false;
+		}
+		if (!BuildPluginParams.bUnversioned)
+		{
+			FString UPluginContents;
+			TSharedPtr<FJsonObject> UPluginObject;
+			if (FFileHelper::LoadFileToString(UPluginContents, *OutputUPluginFile) &&
+				FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(UPluginContents), UPluginObject) &&
+				UPluginObject.IsValid())
+			{
+				UPluginObject->SetStringField(TEXT("EngineVersion"), FString::Printf(TEXT("%s.0"), *EngineVersion));
+
+				FString JsonString;
+				const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+				FJsonSerializer::Serialize(UPluginObject.ToSharedRef(), Writer);
+				FFileHelper::SaveStringToFile(JsonString, *OutputUPluginFile);
+			}
+		}
+
+		return true;
+	}
+
+	bool FDirectBuildPluginTask::ReadManifest(const FTargetBuild& TargetBuild, TSet<FString>& OutBuildProducts) const
+	{
+		const FXmlFile ManifestXml(TargetBuild.ManifestFile);
+		const FXmlNode* RootNode = ManifestXml.GetRootNode();
+		const FXmlNode* BuildProductsNode = (RootNode != nullptr ? RootNode->FindChildNode(TEXT("BuildProducts")) : nullptr);
+		if (BuildProductsNode == nullptr)
+		{
+			return false;
+		}
+
+		for (const FXmlNode* BuildProductNode : BuildProductsNode->GetChildrenNodes())
+		{
+			FString BuildProduct = BuildProductNode->GetContent();
+			FPaths::NormalizeFilename(BuildProduct);
+			OutBuildProducts.Add(BuildProduct);
+		}
+		return true;
+	}
+
+	FString FDirectBuildPluginTask::GetHostProjectDirectoryPath() const
+	{
+		// Kept between builds so that UBT only rebuilds what changed. Each engine version has its own, since their build output is not compatible.
+		return FPaths::ConvertRelativePathToFull(
+			FPaths::ProjectIntermediateDir() / TEXT("PluginBuilder") / TEXT("HostProjects") /
+			FString::Printf(TEXT("%s_%s"), *FPaths::GetBaseFilename(UATBatchFileParams.UPluginFile), *EngineVersion)
+		);
+	}
+
+	FString FDirectBuildPluginTask::GetHostProjectFile() const
+	{
+		return (GetHostProjectDirectoryPath() / TEXT("HostProject.uproject"));
+	}
+
+	FString FDirectBuildPluginTask::GetHostPluginDirectoryPath() const
+	{
+		return (GetHostProjectDirectoryPath() / TEXT("Plugins") / FPaths::GetBaseFilename(UATBatchFileParams.UPluginFile));
+	}
+
+	FString FDirectBuildPluginTask::GetEditorTargetName() const
+	{
+		return ((FCString::Atoi(*EngineVersion) >= 5) ? TEXT("UnrealEditor") : TEXT("UE4Editor"));
+	}
+
+	FString FDirectBuildPluginTask::GetGameTargetName() const
+	{
+		return ((FCString::Atoi(*EngineVersion) >= 5) ? TEXT("UnrealGame") : TEXT("UE4Game"));
+	}
+
+	void FDirectBuildPluginTask::CloseTargetBuilds()
+	{
+		for (FTargetBuild& TargetBuild : TargetBuilds)
+		{
+			if (TargetBuild.TraceEventId != INDEX_NONE)
+			{
+				FPackageTrace::Get().EndEvent(TargetBuild.TraceEventId, { { TEXT("returnCode"), static_cast<double>(INDEX_NONE) } });
+				TargetBuild.TraceEventId = INDEX_NONE;
+			}
+			if (TargetBuild.ProcessHandle.IsValid())
+			{
+				FPlatformProcess::CloseProc(TargetBuild.ProcessHandle);
+			}
+		}
+	}
+}
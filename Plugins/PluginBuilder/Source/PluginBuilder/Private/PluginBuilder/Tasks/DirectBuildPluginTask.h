@@ -0,0 +1,148 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/Tasks/IUATBatchFileTask.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * A task class to build the plugin with UnrealBuildTool directly instead of the BuildPlugin command of UAT.
+	 * Keeps a host project for each plugin and engine version, copying only the plugin files that changed into it,
+	 * so that UBT can reuse the previous build output. Each target, platform and configuration is built by its own
+	 * UBT process, several at a time, and the build products are then copied to the same place as BuildPlugin does.
+	 */
+	class PLUGINBUILDER_API FDirectBuildPluginTask : public IUATBatchFileTask
+	{
+	public:
+		// Constructor.
+		FDirectBuildPluginTask(
+			const FString& InEngineVersion,
+			const FUATBatchFileParams& InUATBatchFileParams,
+			const FBuildPluginParams& InBuildPluginParams
+		);
+
+		// Destructor.
+		virtual ~FDirectBuildPluginTask() override;
+
+		// Adds a plugin that this plugin depends on and that has already been built for the same engine version.
+		// Its built plugin is put in the host project as an installed plugin, so that UBT links against its binaries instead of compiling it.
+		// Must be called before Initialize.
+		void AddPrecompiledDependency(const FString& InBuiltPluginDirectoryPath);
+
+		// Returns the path of the directory the built plugin is copied to, which contains its descriptor.
+		FString GetStagedPluginDirectoryPath() const;
+
+		// IPluginBuilderTask interface.
+		virtual bool IsBuildTask() const override { return true; }
+		virtual void Initialize() override;
+		virtual void Tick(float DeltaTime) override;
+		virtual void Terminate() override;
+		virtual void RequestCancel() override;
+		virtual float GetProgress() const override;
+		virtual FString GetProgressText() const override;
+		virtual FString GetThroughputText() const override;
+		virtual FBuildDiagnostics GetDiagnostics() const override;
+		virtual FString GetTimingKey() const override;
+		virtual void GetReportMetrics(TMap<FString, double>& OutMetrics) const override;
+		// End of IPluginBuilderTask interface.
+
+	protected:
+		// IUATBatchFileTask interface.
+		virtual TArray<FString> GetUATArguments() const override;
+		virtual bool RunsUATBatchFile() const override { return false; }
+		virtual FString GetDestinationDirectoryPath() const override;
+		virtual ETaskPhase GetCurrentTaskPhase() const override;
+		// End of IUATBatchFileTask interface.
+
+	private:
+		// A build of one target, platform and configuration by a UBT process.
+		struct FTargetBuild
+		{
+		public:
+			// The target, platform and configuration to build, such as "UnrealGame", "Win64" and "Shipping".
+			FString TargetName;
+			FString Platform;
+			FString Configuration;
+
+			// The file UBT writes the list of build products to.
+			FString ManifestFile;
+
+			// The UBT process and the read pipe of its standard output.
+			FProcHandle ProcessHandle;
+			void* ReadPipe = nullptr;
+
+			// The parser for the standard output of the UBT process.
+			TUniquePtr<FUATOutputParser> OutputParser;
+
+			// The span of the UBT process in the package trace.
+			int32 TraceEventId = INDEX_NONE;
+
+			// Whether the UBT process has been started and whether it has exited.
+			bool bHasStarted = false;
+			bool bHasExited = false;
+
+		public:
+			// Returns a label for logs and traces, such as "UnrealGame Win64 Shipping".
+			FString GetLabel() const;
+		};
+
+	private:
+		// Creates the list of target builds from the build parameters.
+		void AddTargetBuilds();
+
+		// Writes the host project file and copies the plugin files that changed since the last build into it.
+		bool UpdateHostProject() const;
+
+		// Copies the built plugins of the precompiled dependencies into the host project, and removes the plugins that are no longer used.
+		bool UpdateHostProjectDependencies() const;
+
+		// Starts the UBT process of a target build.
+		bool StartTargetBuild(FTargetBuild& TargetBuild);
+
+		// Reads the output of a running UBT process and collects its return code once it has exited.
+		void UpdateTargetBuild(FTargetBuild& TargetBuild);
+
+		// Returns a list of arguments to pass to UBT for a target build.
+		TArray<FString> GetUBTArguments(const FTargetBuild& TargetBuild) const;
+
+		// Copies the plugin files and the build products to the built plugin directory, like BuildPlugin does.
+		bool StageBuiltPlugin() const;
+
+		// Adds the build products listed in the manifest of a target build to the list of files to stage.
+		bool ReadManifest(const FTargetBuild& TargetBuild, TSet<FString>& OutBuildProducts) const;
+
+		// Returns the paths of the host project file and of the plugin directory in it.
+		FString GetHostProjectDirectoryPath() const;
+		FString GetHostProjectFile() const;
+		FString GetHostPluginDirectoryPath() const;
+
+		// Returns the names of the editor and game targets of the engine version, such as "UnrealEditor" and "UnrealGame".
+		FString GetEditorTargetName() const;
+		FString GetGameTargetName() const;
+
+		// Closes the handles of all UBT processes and ends their spans in the trace.
+		void CloseTargetBuilds();
+
+	private:
+		// The dataset used to process plugin build.
+		FBuildPluginParams BuildPluginParams;
+
+		// The Build.bat (Linux/Build.sh on Linux) file of the engine version that runs UBT.
+		FString UBTBatchFile;
+
+		// The built plugin directories of the plugins this plugin depends on that are used instead of compiling them.
+		TArray<FString> PrecompiledDependencyDirectoryPaths;
+
+		// The builds of each target, platform and configuration, in the order they are started.
+		TArray<FTargetBuild> TargetBuilds;
+
+		// Whether no more target builds are started because the task was canceled.
+		bool bIsCancelRequested;
+
+		// The maximum number of UBT processes that run at the same time.
+		// Each UBT process already runs its actions in parallel, so this mostly overlaps their startup and linking.
+		static constexpr int32 MaxConcurrentTargetBuilds = 2;
+	};
+}
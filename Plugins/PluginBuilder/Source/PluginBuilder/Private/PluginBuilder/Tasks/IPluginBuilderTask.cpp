@@ -8,4 +8,22 @@ namespace PluginBuilder
 	{
 		return FString();
 	}
+
+	FString IPluginBuilderTask::GetTraceTrackName() const
+	{
+		const TCHAR* Kind = TEXT("Task");
+		if (IsBuildTask())
+		{
+			Kind = TEXT("Build");
+		}
+		else if (IsZipTask())
+		{
+			Kind = TEXT("Zip");
+		}
+		else if (IsCloudUploadTask())
+		{
+			Kind = TEXT("Upload");
+		}
+		return FString::Printf(TEXT("%s %s"), Kind, *GetTaskLabel());
+	}
 }
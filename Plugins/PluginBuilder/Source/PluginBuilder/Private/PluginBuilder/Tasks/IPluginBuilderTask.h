@@ -3,9 +3,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PluginBuilder/Types/BuildDiagnostics.h"
+#include "PluginBuilder/Types/TaskPhaseTimes.h"
 
 namespace PluginBuilder
 {
+	class FTaskOutputLog;
+	
 	/**
 	 * An abstract base interface for all tasks used in the processing of this plugin.
 	 */
@@ -34,6 +38,9 @@ namespace PluginBuilder
 		// Returns a short label for this task used in progress notifications.
 		virtual FString GetTaskLabel() const;
 
+		// Returns whether the tasks this task depends on have finished, so that it can be initialized.
+		virtual bool CanStart() const { return true; }
+
 		// Called only once when task processing starts.
 		virtual void Initialize() = 0;
 
@@ -52,6 +59,30 @@ namespace PluginBuilder
 		// Returns a short progress detail string (e.g. "[35/200]"), or empty if unavailable.
 		virtual FString GetProgressText() const { return FString(); }
 
+		// Returns the errors and warnings reported while the task was processed.
+		virtual FBuildDiagnostics GetDiagnostics() const { return FBuildDiagnostics(); }
+
+		// Returns the output of the task kept for the build monitor, or null if the task does not output anything.
+		virtual TSharedPtr<const FTaskOutputLog> GetOutputLog() const { return nullptr; }
+
+		// Returns how fast the task is processing, such as "3.2 actions/s", or empty if unavailable.
+		virtual FString GetThroughputText() const { return FString(); }
+
+		// Returns whether a compile, link or header tool error has been found so far, which means the task will fail.
+		virtual bool HasFoundBuildError() const { return false; }
+
+		// Returns the key under which the time spent on this task is recorded in the timing database, or empty if it is not recorded.
+		virtual FString GetTimingKey() const { return FString(); }
+
+		// Returns the seconds spent in each phase of the task so far.
+		virtual FTaskPhaseTimes GetPhaseTimes() const { return FTaskPhaseTimes(); }
+
+		// Adds measurements of the task for the run report, such as "cpuSeconds" or "uploadedBytes".
+		virtual void GetReportMetrics(TMap<FString, double>& OutMetrics) const {}
+
+		// Returns the name of the track the task is drawn on in package traces, such as "Build UnrealEngine (5.4)".
+		virtual FString GetTraceTrackName() const;
+
 		// Returns true when this task is a plugin build task.
 		virtual bool IsBuildTask() const { return false; }
 
@@ -60,5 +91,8 @@ namespace PluginBuilder
 
 		// Returns true when this task is a cloud storage upload task.
 		virtual bool IsCloudUploadTask() const { return false; }
+
+		// Returns true when this task runs on a build worker, so that it does not use the CPU of this machine.
+		virtual bool IsRemoteTask() const { return false; }
 	};
 }
@@ -2,10 +2,13 @@
 
 #include "PluginBuilder/Tasks/IUATBatchFileTask.h"
 #include "PluginBuilder/Types/EngineVersions.h"
+#include "PluginBuilder/Utilities/PackageTrace.h"
+#include "PluginBuilder/Utilities/AutomationScriptsState.h"
 #include "PluginBuilder/PluginBuilderGlobals.h"
 #include "HAL/PlatformFileManager.h"
 #include "HAL/PlatformFile.h"
 #include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 namespace PluginBuilder
 {
@@ -16,18 +19,48 @@ namespace PluginBuilder
 	)
 		: EngineVersion(InEngineVersion)
 		, UATBatchFileParams(InUATBatchFileParams)
+		, bHasSkippedScriptCompile(false)
+		, bIsCompilingScripts(false)
 		, State(EState::PreInitialize)
 		, bHasAnyError(false)
 		, ReadPipe(nullptr)
+		, OutputLog(MakeShared<FTaskOutputLog>())
+		, bHasFoundBuildError(false)
+		, LastPhaseUpdateTime(0.0)
+		, bHasDependentTask(DependentTask.IsValid())
+		, WeakDependentTask(DependentTask)
+		, bIsMeasuringProcess(false)
+		, LastMetricsSampleTime(0.0)
+		, TraceTrackId(INDEX_NONE)
+		, ProcessTraceEventId(INDEX_NONE)
+		, PhaseTraceEventId(INDEX_NONE)
+		, TracedPhase(ETaskPhase::Num)
+		, ProcessSpawnTime(0.0)
+		, bHasReceivedOutput(false)
 	{
 		if (DependentTask.IsValid())
 		{
 			DependentTask->OnDestroy.BindRaw(this, &IUATBatchFileTask::HandleOnDestroy);
 		}
+
+		OutputParser.OnOutputLine.BindLambda(
+			[this](const TCHAR* Line)
+			{
+				UE_LOG(LogPluginBuilder, Log, TEXT("%s"), Line);
+				OutputLog->AddLine(Line);
+			}
+		);
+		OutputParser.OnDiagnostic.BindRaw(this, &IUATBatchFileTask::HandleOnDiagnostic);
 	}
 
 	IUATBatchFileTask::~IUATBatchFileTask()
 	{
+		// Tasks may be destroyed in any order when they run concurrently or packaging is canceled.
+		if (const TSharedPtr<IUATBatchFileTask> DependentTask = WeakDependentTask.Pin())
+		{
+			DependentTask->OnDestroy.Unbind();
+		}
+		
 		OnDestroy.ExecuteIfBound(bHasAnyError);
 	}
 
@@ -36,6 +69,18 @@ namespace PluginBuilder
 		return State;
 	}
 
+	bool IUATBatchFileTask::CanStart() const
+	{
+		// The dependent task reports its result when it is destroyed after it has been processed.
+		if (bHasDependentTask && !HasDependentTaskSucceeded.IsSet())
+		{
+			return false;
+		}
+
+		// Waits for the task compiling the automation scripts of the same engine version, so that this one can start without compiling them.
+		return (!RunsUATBatchFile() || !FAutomationScriptsState::IsCompiling(EngineVersion));
+	}
+
 	bool IUATBatchFileTask::HasAnyError() const
 	{
 		return bHasAnyError;
@@ -43,6 +88,11 @@ namespace PluginBuilder
 
 	FString IUATBatchFileTask::GetTaskLabel() const
 	{
+		if (UATBatchFileParams.bIncludePluginNameInTaskLabel)
+		{
+			return FString::Printf(TEXT("%s UnrealEngine (%s)"), *UATBatchFileParams.PluginFriendlyName, *EngineVersion);
+		}
+
 		return FString::Printf(TEXT("UnrealEngine (%s)"), *EngineVersion);
 	}
 
@@ -51,9 +101,20 @@ namespace PluginBuilder
 		return EngineVersion;
 	}
 
+	double IUATBatchFileTask::GetActionsPerSecond(const int32 CompletedActions) const
+	{
+		// The phase times are updated every tick until the process exits, so this is also the rate of a finished process.
+		const double ElapsedTime = (LastPhaseUpdateTime - ProcessSpawnTime);
+		if ((CompletedActions <= 0) || (ElapsedTime <= 0.0))
+		{
+			return -1.0;
+		}
+
+		return (static_cast<double>(CompletedActions) / ElapsedTime);
+	}
+
 	void IUATBatchFileTask::Initialize()
 	{
-		FString UATBatchFile;
 		if (!FEngineVersions::FindUATBatchFileByVersionName(EngineVersion, UATBatchFile))
 		{
 			UE_LOG(LogPluginBuilder, Error, TEXT("Could not find UAT batch file. (Engine Version = %s)"), *EngineVersion);
@@ -62,11 +123,30 @@ namespace PluginBuilder
 			return;
 		}
 		
+		FPackageTrace& Trace = FPackageTrace::Get();
+		TraceTrackId = Trace.GetTrackId(GetTraceTrackName());
+		ProcessTraceEventId = Trace.BeginEvent(TraceTrackId, TEXT("UAT process"), TEXT("Process"));
+		const int32 SpawnTraceEventId = Trace.BeginEvent(TraceTrackId, TEXT("Spawn"), TEXT("Process"));
+
+		// Compiling the automation scripts takes most of the UAT startup, so it is only done by the first task of each engine version in a session.
+		TArray<FString> Arguments = GetUATArguments();
+		bHasSkippedScriptCompile = FAutomationScriptsState::AreScriptsUpToDate(EngineVersion, UATBatchFile);
+		if (bHasSkippedScriptCompile)
+		{
+			Arguments.Append(FAutomationScriptsState::GetNoCompileArguments(EngineVersion));
+			UE_LOG(LogPluginBuilder, Log, TEXT("Automation scripts of %s are up to date, so they are not compiled."), *EngineVersion);
+		}
+		else
+		{
+			FAutomationScriptsState::BeginCompile(EngineVersion);
+			bIsCompilingScripts = true;
+		}
+
 		void* WritePipe = nullptr;
 		FPlatformProcess::CreatePipe(ReadPipe, WritePipe);
 		ProcessHandle = FPlatformProcess::CreateProc(
 			*UATBatchFile,
-			*FString::Join(GetUATArguments(), TEXT(" ")),
+			*FString::Join(Arguments, TEXT(" ")),
 			false,
 			true,
 			true,
@@ -76,28 +156,33 @@ namespace PluginBuilder
 			WritePipe,
 			nullptr
 		);
+		ProcessSpawnTime = FPlatformTime::Seconds();
+		LastPhaseUpdateTime = ProcessSpawnTime;
+
+		Trace.EndEvent(SpawnTraceEventId);
+		bIsMeasuringProcess = ProcessMetrics.Attach(ProcessHandle);
+		LastMetricsSampleTime = ProcessSpawnTime;
 
 		State = EState::Processing;
 	}
 
 	void IUATBatchFileTask::Tick(float DeltaTime)
 	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		PhaseTimes.Add(GetCurrentTaskPhase(), CurrentTime - LastPhaseUpdateTime);
+		LastPhaseUpdateTime = CurrentTime;
+
 		if (FPlatformProcess::IsProcRunning(ProcessHandle))
 		{
-			const FString OutputLog = FPlatformProcess::ReadPipe(ReadPipe);
-			if (!OutputLog.IsEmpty())
-			{
-				TArray<FString> Lines;
-				OutputLog.ParseIntoArrayLines(Lines);
-				for (const FString& Line : Lines)
-				{
-					UE_LOG(LogPluginBuilder, Log, TEXT("%s"), *Line);
-					OnOutputLine(Line);
-				}
-			}
+			ReadOutput();
+			UpdateTrace();
 		}
 		else
 		{
+			// Reads the output written just before the process exited.
+			ReadOutput();
+			OutputParser.Flush();
+
 			enum EReturnCode
 			{
 				RC_ProcessDidNotRun = -1,
@@ -142,6 +227,23 @@ namespace PluginBuilder
 				bHasAnyError = true;
 			}
 
+			if ((ReturnCode == 0) && bIsCompilingScripts)
+			{
+				FAutomationScriptsState::MarkScriptsCompiled(EngineVersion, UATBatchFile);
+			}
+			else if (ReturnCode != 0)
+			{
+				// The failure may be caused by stale script assemblies, so the next task compiles them again.
+				FAutomationScriptsState::Invalidate(EngineVersion);
+			}
+			bIsCompilingScripts = false;
+
+			if (bIsMeasuringProcess)
+			{
+				ProcessMetrics.Sample(LastMetricsSample);
+			}
+			EndTrace(ReturnCode);
+
 			State = EState::PreTerminate;
 		}
 	}
@@ -165,6 +267,14 @@ namespace PluginBuilder
 		if (UATBatchFileParams.bStopPackagingProcessImmediately)
 		{
 			FPlatformProcess::TerminateProc(ProcessHandle);
+			EndTrace(INDEX_NONE);
+
+			// The scripts may have been left half compiled, so the next task compiles them again.
+			if (bIsCompilingScripts)
+			{
+				FAutomationScriptsState::Invalidate(EngineVersion);
+				bIsCompilingScripts = false;
+			}
 			State = EState::Terminated;
 		}
 	}
@@ -194,6 +304,143 @@ namespace PluginBuilder
 		return FString();
 	}
 
+	FBuildDiagnostics IUATBatchFileTask::GetDiagnostics() const
+	{
+		FBuildDiagnostics Diagnostics;
+		Diagnostics.TaskLabel = GetTaskLabel();
+		Diagnostics.Entries = OutputParser.GetDiagnostics();
+		return Diagnostics;
+	}
+
+	TSharedPtr<const FTaskOutputLog> IUATBatchFileTask::GetOutputLog() const
+	{
+		return OutputLog;
+	}
+
+	bool IUATBatchFileTask::HasFoundBuildError() const
+	{
+		return bHasFoundBuildError;
+	}
+
+	FTaskPhaseTimes IUATBatchFileTask::GetPhaseTimes() const
+	{
+		return PhaseTimes;
+	}
+
+	void IUATBatchFileTask::GetReportMetrics(TMap<FString, double>& OutMetrics) const
+	{
+		if (bIsMeasuringProcess)
+		{
+			OutMetrics.Add(TEXT("cpuSeconds"), LastMetricsSample.CpuSeconds);
+			OutMetrics.Add(TEXT("peakMemoryMB"), LastMetricsSample.PeakMemoryBytes / (1024.0 * 1024.0));
+		}
+
+		const FBuildDiagnostics Diagnostics = GetDiagnostics();
+		OutMetrics.Add(TEXT("errors"), Diagnostics.GetNum(EBuildDiagnosticSeverity::Error));
+		OutMetrics.Add(TEXT("warnings"), Diagnostics.GetNum(EBuildDiagnosticSeverity::Warning));
+	}
+
+	void IUATBatchFileTask::ReadOutput()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(IUATBatchFileTask_ReadOutput);
+
+		if (FPlatformProcess::ReadPipeToArray(ReadPipe, OutputBytes))
+		{
+			if (!bHasReceivedOutput && (OutputBytes.Num() > 0))
+			{
+				bHasReceivedOutput = true;
+				FPackageTrace::Get().AddInstantEvent(
+					TraceTrackId,
+					TEXT("First output"),
+					TEXT("Process"),
+					{ { TEXT("secondsSinceSpawn"), FPlatformTime::Seconds() - ProcessSpawnTime } }
+				);
+			}
+			
+			OutputParser.Feed(OutputBytes.GetData(), OutputBytes.Num());
+		}
+	}
+
+	void IUATBatchFileTask::UpdateTrace()
+	{
+		if (TraceTrackId == INDEX_NONE)
+		{
+			return;
+		}
+
+		FPackageTrace& Trace = FPackageTrace::Get();
+
+		// The phase spans show how long UAT starts up and how the UBT actions split into compiling and linking.
+		const ETaskPhase CurrentPhase = GetCurrentTaskPhase();
+		if (CurrentPhase != TracedPhase)
+		{
+			Trace.EndEvent(PhaseTraceEventId, { { TEXT("completedActions"), static_cast<double>(OutputParser.GetCompletedActions()) } });
+			PhaseTraceEventId = Trace.BeginEvent(TraceTrackId, LexToString(CurrentPhase), TEXT("Phase"));
+			TracedPhase = CurrentPhase;
+		}
+
+		const double CurrentTime = FPlatformTime::Seconds();
+		if (!bIsMeasuringProcess || ((CurrentTime - LastMetricsSampleTime) < MetricsSampleInterval))
+		{
+			return;
+		}
+
+		FChildProcessMetrics::FSample Sample;
+		if (ProcessMetrics.Sample(Sample))
+		{
+			// The number of cores kept busy on average since the last sample.
+			const double CpuUsage = ((Sample.CpuSeconds - LastMetricsSample.CpuSeconds) / (CurrentTime - LastMetricsSampleTime));
+			Trace.AddCounter(TraceTrackId, TEXT("CPU"), { { TEXT("cores"), CpuUsage } });
+			Trace.AddCounter(
+				TraceTrackId,
+				TEXT("Processes"),
+				{
+					{ TEXT("active"), static_cast<double>(Sample.NumActiveProcesses) },
+					{ TEXT("peakMemoryMB"), Sample.PeakMemoryBytes / (1024.0 * 1024.0) }
+				}
+			);
+			LastMetricsSample = Sample;
+		}
+		LastMetricsSampleTime = CurrentTime;
+	}
+
+	void IUATBatchFileTask::EndTrace(const int32 ReturnCode)
+	{
+		if (TraceTrackId == INDEX_NONE)
+		{
+			return;
+		}
+
+		FPackageTrace& Trace = FPackageTrace::Get();
+		Trace.EndEvent(PhaseTraceEventId, { { TEXT("completedActions"), static_cast<double>(OutputParser.GetCompletedActions()) } });
+
+		FPackageTrace::FArgs Args;
+		Args.Add(TEXT("returnCode"), ReturnCode);
+		Args.Add(TEXT("skippedScriptCompile"), bHasSkippedScriptCompile ? 1.0 : 0.0);
+		Args.Add(TEXT("diagnostics"), OutputParser.GetDiagnostics().Num());
+
+		if (bIsMeasuringProcess)
+		{
+			Args.Add(TEXT("cpuSeconds"), LastMetricsSample.CpuSeconds);
+			Args.Add(TEXT("peakMemoryMB"), LastMetricsSample.PeakMemoryBytes / (1024.0 * 1024.0));
+		}
+		Trace.EndEvent(ProcessTraceEventId, Args);
+
+		// Later calls, such as the one when the process is killed on cancellation, do nothing.
+		TraceTrackId = INDEX_NONE;
+	}
+
+	void IUATBatchFileTask::HandleOnDiagnostic(const FBuildDiagnostic& Diagnostic)
+	{
+		OutputLog->AddDiagnostic(Diagnostic);
+
+		// Errors reported by UAT itself, such as "BUILD FAILED", follow the actual error and may not be fatal on their own.
+		if (Diagnostic.IsError() && (Diagnostic.Source != EBuildDiagnosticSource::AutomationTool))
+		{
+			bHasFoundBuildError = true;
+		}
+	}
+
 	void IUATBatchFileTask::HandleOnDestroy(const bool bHasDependentTaskError)
 	{
 		HasDependentTaskSucceeded = !bHasDependentTaskError;
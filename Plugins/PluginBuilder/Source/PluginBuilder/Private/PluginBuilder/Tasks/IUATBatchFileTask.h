@@ -6,6 +6,9 @@
 #include "HAL/PlatformProcess.h"
 #include "PluginBuilder/Tasks/IPluginBuilderTask.h"
 #include "PluginBuilder/Types/PackagePluginParams.h"
+#include "PluginBuilder/Utilities/UATOutputParser.h"
+#include "PluginBuilder/Utilities/ChildProcessMetrics.h"
+#include "PluginBuilder/Utilities/TaskOutputLog.h"
 
 namespace PluginBuilder
 {
@@ -27,6 +30,7 @@ namespace PluginBuilder
 
 		// IPluginBuilderTask interface.
 		virtual EState GetState() const override;
+		virtual bool CanStart() const override;
 		virtual bool HasAnyError() const override;
 		virtual FString GetTaskLabel() const override;
 		virtual void Initialize() override;
@@ -35,27 +39,51 @@ namespace PluginBuilder
 		virtual void RequestCancel() override;
 		virtual float GetProgress() const override;
 		virtual FString GetProgressText() const override;
+		virtual FBuildDiagnostics GetDiagnostics() const override;
+		virtual TSharedPtr<const FTaskOutputLog> GetOutputLog() const override;
+		virtual bool HasFoundBuildError() const override;
+		virtual FTaskPhaseTimes GetPhaseTimes() const override;
+		virtual void GetReportMetrics(TMap<FString, double>& OutMetrics) const override;
 		// End of IPluginBuilderTask interface.
 
 		// Returns the engine version for this task.
 		FString GetEngineVersion() const;
 
+	protected:
+		// Returns the number of build actions completed per second since the process was spawned, or a negative value if none has completed.
+		double GetActionsPerSecond(int32 CompletedActions) const;
+
 	protected:
 		// Returns a list of arguments to pass to the UAT batch file.
 		virtual TArray<FString> GetUATArguments() const = 0;
 
+		// Returns whether the task runs the UAT batch file, and so may compile the automation scripts of the engine version.
+		virtual bool RunsUATBatchFile() const { return true; }
+
 		// Returns the path of the directory where task results are output.
 		virtual FString GetDestinationDirectoryPath() const = 0;
 
+		// Returns the phase the UAT process is currently in, which the time since the last tick is added to.
+		virtual ETaskPhase GetCurrentTaskPhase() const = 0;
+
 		// Functions that returns the path of a directory or working directory that outputs pre-built or packaged plugins.
 		FString GetDestinationDirectoryName() const;
 		FString GetBuiltPluginDestinationPath() const;
 		FString GetPackagedPluginDestinationPath() const;
 
-		// Called for each line read from the UAT process stdout. Override to parse task-specific progress.
-		virtual void OnOutputLine(const FString& Line) {}
+		// Called when the parser finds an error or warning.
+		void HandleOnDiagnostic(const FBuildDiagnostic& Diagnostic);
 
 	private:
+		// Reads the output of the UAT process that is available now and passes it to the parser.
+		void ReadOutput();
+
+		// Updates the trace of the UAT process: the span of the current phase and the CPU and memory counters.
+		void UpdateTrace();
+
+		// Ends the spans of the UAT process and its current phase in the trace, attaching what the process used.
+		void EndTrace(int32 ReturnCode);
+
 		// Called when a dependent task is destroyed.
 		void HandleOnDestroy(const bool bHasDependentTaskError);
 		
@@ -70,6 +98,12 @@ namespace PluginBuilder
 		// The dataset used to process UAT batch file.
 		FUATBatchFileParams UATBatchFileParams;
 
+		// The RunUAT batch file of the engine version, whether it was run without compiling the automation scripts,
+		// and whether the process is compiling them and the other tasks of the engine version are waiting for it.
+		FString UATBatchFile;
+		bool bHasSkippedScriptCompile;
+		bool bIsCompilingScripts;
+
 		// The task progress state.
 		EState State;
 
@@ -82,7 +116,51 @@ namespace PluginBuilder
 		// The read pipe for outputting from the standard output of a batch file to the output log.
 		void* ReadPipe;
 
+		// The buffer reused to read the standard output of a batch file.
+		TArray<uint8> OutputBytes;
+
+		// The parser for the standard output of a batch file, which also collects errors and warnings.
+		FUATOutputParser OutputParser;
+
+		// The output and diagnostics of the UAT process kept for the build monitor.
+		TSharedRef<FTaskOutputLog> OutputLog;
+
+		// Whether a compile, link or header tool error has been found in the output.
+		bool bHasFoundBuildError;
+
+		// The seconds spent in each phase since the UAT process started, and the time they were last updated.
+		FTaskPhaseTimes PhaseTimes;
+		double LastPhaseUpdateTime;
+
 		// Whether the dependent task completed successfully.
 		TOptional<bool> HasDependentTaskSucceeded;
+
+		// Whether this task was created with a dependent task and has to wait for it to finish.
+		bool bHasDependentTask;
+
+		// The dependent task, used to stop it from notifying this task after this task has been destroyed.
+		TWeakPtr<IUATBatchFileTask> WeakDependentTask;
+
+		// The CPU time and memory used by the UAT process and its children, if they can be measured on this platform.
+		FChildProcessMetrics ProcessMetrics;
+		bool bIsMeasuringProcess;
+
+		// The last sample of the process metrics and when it was taken, used to compute the CPU usage between samples.
+		// The sample taken when the process exits is reported as the resources used by the task.
+		FChildProcessMetrics::FSample LastMetricsSample;
+		double LastMetricsSampleTime;
+
+		// The track of this task in the package trace, and the spans of the UAT process and its current phase.
+		int32 TraceTrackId;
+		int32 ProcessTraceEventId;
+		int32 PhaseTraceEventId;
+		ETaskPhase TracedPhase;
+
+		// The time at which the UAT process was spawned and whether it has written anything yet.
+		double ProcessSpawnTime;
+		bool bHasReceivedOutput;
+
+		// How often the process metrics are added to the trace, in seconds.
+		static constexpr double MetricsSampleInterval = 1.0;
 	};
 }
@@ -0,0 +1,250 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Tasks/RemoteBuildPluginTask.h"
+#include "PluginBuilder/Utilities/RemoteBuildConnection.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformFile.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Async/Async.h"
+
+namespace PluginBuilder
+{
+	namespace RemoteBuildPluginTask
+	{
+		// The top-level directories of the plugin that are not sent to the worker, since they are build output or not needed to build.
+		static const TArray<FString> ExcludedDirectoryNames = {
+			TEXT("Binaries"),
+			TEXT("Intermediate"),
+			TEXT("Saved"),
+		};
+
+		// Returns whether a path relative to the plugin directory is sent to the worker.
+		static bool ShouldSendToWorker(const FString& RelativePath)
+		{
+			FString TopLevelName;
+			if (!RelativePath.Split(TEXT("/"), &TopLevelName, nullptr))
+			{
+				return true;
+			}
+
+			return (!TopLevelName.StartsWith(TEXT(".")) && !ExcludedDirectoryNames.Contains(TopLevelName));
+		}
+	}
+
+	FRemoteBuildPluginTask::FRemoteBuildPluginTask(
+		const FString& InEngineVersion,
+		const FUATBatchFileParams& InUATBatchFileParams,
+		const FBuildPluginParams& InBuildPluginParams,
+		const FString& InWorkerAddress
+	)
+		: FBuildPluginTask(InEngineVersion, InUATBatchFileParams, InBuildPluginParams)
+		, RemoteBuildPluginParams(InBuildPluginParams)
+		, WorkerAddress(InWorkerAddress)
+		, bShouldStop(false)
+	{
+	}
+
+	FRemoteBuildPluginTask::~FRemoteBuildPluginTask()
+	{
+		StopConnection();
+	}
+
+	FString FRemoteBuildPluginTask::GetTaskLabel() const
+	{
+		return FString::Printf(TEXT("%s @ %s"), *FBuildPluginTask::GetTaskLabel(), *WorkerAddress);
+	}
+
+	void FRemoteBuildPluginTask::Initialize()
+	{
+		UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
+		UE_LOG(LogPluginBuilder, Log, TEXT("[Plugin Name] %s / [Plugin Version] %s / [Engine Version] %s"), *UATBatchFileParams.GetPluginNameInSpecifiedFormat(), *UATBatchFileParams.PluginVersionName, *EngineVersion);
+		UE_LOG(LogPluginBuilder, Log, TEXT("[Build Worker] %s"), *WorkerAddress);
+		UE_LOG(LogPluginBuilder, Log, TEXT("----------------------------------------------------------------------------------------------------"));
+
+		// The previous output is removed first, so that a failed transfer does not leave a mix of old and new files for the zip task.
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.DeleteDirectoryRecursively(*GetBuiltPluginDestinationPath());
+
+		ProcessSpawnTime = FPlatformTime::Seconds();
+		LastPhaseUpdateTime = ProcessSpawnTime;
+		ConnectionFuture = Async(EAsyncExecution::Thread, [this]()
+		{
+			RunConnection();
+		});
+
+		State = EState::Processing;
+	}
+
+	void FRemoteBuildPluginTask::Tick(float DeltaTime)
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		PhaseTimes.Add(GetCurrentTaskPhase(), CurrentTime - LastPhaseUpdateTime);
+		LastPhaseUpdateTime = CurrentTime;
+
+		bool bHasFinished;
+		{
+			FScopeLock Lock(&CriticalSection);
+			Swap(OutputBytes, ReceivedOutput);
+			ReceivedOutput.Reset();
+			bHasFinished = bHasConnectionFinished;
+		}
+
+		// The output of the worker is parsed here as if it came from a local UAT process.
+		if (OutputBytes.Num() > 0)
+		{
+			OutputParser.Feed(OutputBytes.GetData(), OutputBytes.Num());
+		}
+		if (!bHasFinished)
+		{
+			return;
+		}
+
+		OutputParser.Flush();
+		ConnectionFuture.Wait();
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("----------------------------------------------------------------------------------------------------"));
+		if (bHasRemoteBuildSucceeded)
+		{
+			UE_LOG(LogPluginBuilder, Log, TEXT("[Build Worker] %s"), *WorkerAddress);
+			UE_LOG(LogPluginBuilder, Log, TEXT("[Output Directory] %s"), *GetBuiltPluginDestinationPath());
+		}
+		else
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("The build on %s failed. %s"), *WorkerAddress, *RemoteError);
+			bHasAnyError = true;
+		}
+
+		State = EState::PreTerminate;
+	}
+
+	void FRemoteBuildPluginTask::Terminate()
+	{
+		StopConnection();
+
+		if (bHasAnyError)
+		{
+			IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+			PlatformFile.DeleteDirectoryRecursively(*GetBuiltPluginDestinationPath());
+		}
+
+		State = EState::Terminated;
+	}
+
+	void FRemoteBuildPluginTask::RequestCancel()
+	{
+		// Closing the connection makes the worker kill its build, as it has nobody to send the result to.
+		// Otherwise the build on the worker is left to finish, like a local build.
+		if (UATBatchFileParams.bStopPackagingProcessImmediately)
+		{
+			StopConnection();
+			State = EState::Terminated;
+		}
+	}
+
+	FString FRemoteBuildPluginTask::GetTimingKey() const
+	{
+		// Builds on a worker take as long as that machine takes, so they are recorded apart from the local ones.
+		return FString::Printf(TEXT("%s|%s"), *FBuildPluginTask::GetTimingKey(), *WorkerAddress);
+	}
+
+	void FRemoteBuildPluginTask::RunConnection()
+	{
+		auto Finish = [this](const bool bHasSucceeded, const FString& Error)
+		{
+			FScopeLock Lock(&CriticalSection);
+			bHasRemoteBuildSucceeded = bHasSucceeded;
+			RemoteError = Error;
+			bHasConnectionFinished = true;
+		};
+
+		const TSharedPtr<FRemoteBuildConnection> NewConnection = FRemoteBuildConnection::Connect(WorkerAddress);
+		if (!NewConnection.IsValid())
+		{
+			Finish(false, TEXT("Could not connect to the build worker."));
+			return;
+		}
+		{
+			FScopeLock Lock(&CriticalSection);
+			if (bShouldStop)
+			{
+				return;
+			}
+			Connection = NewConnection;
+		}
+
+		// The source is only sent once the worker has accepted the request, so that a refused build reports why it was refused.
+		FRemoteBuildMessage Message;
+		if (!NewConnection->Send(FRemoteBuildMessage::MakeBuild(EngineVersion, UATBatchFileParams, RemoteBuildPluginParams)) ||
+			!NewConnection->Receive(Message, bShouldStop))
+		{
+			Finish(false, TEXT("The connection to the build worker was lost."));
+			return;
+		}
+		if (Message.Type != FRemoteBuildMessage::Accepted)
+		{
+			FString Error = TEXT("The build worker did not accept the build.");
+			Message.Fields->TryGetStringField(TEXT("Error"), Error);
+			Finish(false, Error);
+			return;
+		}
+
+		if (!NewConnection->SendDirectory(FPaths::GetPath(UATBatchFileParams.UPluginFile), &RemoteBuildPluginTask::ShouldSendToWorker, bShouldStop))
+		{
+			Finish(false, TEXT("Failed to send the plugin source to the build worker."));
+			return;
+		}
+
+		while (NewConnection->Receive(Message, bShouldStop))
+		{
+			if (Message.Type == FRemoteBuildMessage::Output)
+			{
+				FScopeLock Lock(&CriticalSection);
+				ReceivedOutput.Append(Message.Payload);
+				continue;
+			}
+			break;
+		}
+
+		bool bHasSucceeded = false;
+		FString Error;
+		if ((Message.Type != FRemoteBuildMessage::Result) || !Message.Fields->TryGetBoolField(TEXT("bSucceeded"), bHasSucceeded))
+		{
+			Finish(false, TEXT("The connection to the build worker was lost."));
+			return;
+		}
+		Message.Fields->TryGetStringField(TEXT("Error"), Error);
+		if (!bHasSucceeded)
+		{
+			Finish(false, Error);
+			return;
+		}
+
+		// The worker sends the contents of its BuiltPlugins directory, which holds the destination directory of this task.
+		if (!NewConnection->ReceiveDirectory(FPaths::GetPath(GetBuiltPluginDestinationPath()), false, bShouldStop))
+		{
+			Finish(false, TEXT("Failed to receive the built plugin from the build worker."));
+			return;
+		}
+
+		Finish(true, FString());
+	}
+
+	void FRemoteBuildPluginTask::StopConnection()
+	{
+		{
+			FScopeLock Lock(&CriticalSection);
+			bShouldStop = true;
+			if (Connection.IsValid())
+			{
+				Connection->Close();
+			}
+		}
+
+		if (ConnectionFuture.IsValid())
+		{
+			ConnectionFuture.Wait();
+		}
+	}
+}
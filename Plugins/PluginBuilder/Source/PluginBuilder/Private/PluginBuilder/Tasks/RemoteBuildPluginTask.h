@@ -0,0 +1,83 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Async/Future.h"
+#include "PluginBuilder/Tasks/BuildPluginTask.h"
+
+namespace PluginBuilder
+{
+	class FRemoteBuildConnection;
+
+	/**
+	 * A task class to build the plugin on a build worker instead of on this machine.
+	 * The plugin source is sent to the worker, whose output is fed to the same parser as a local build so that the progress
+	 * and diagnostics are shown in the same way, and the built plugin is received into the same directory as a local build,
+	 * so that the zip task does not need to know where it was built.
+	 */
+	class PLUGINBUILDER_API FRemoteBuildPluginTask : public FBuildPluginTask
+	{
+	public:
+		// Constructor.
+		FRemoteBuildPluginTask(
+			const FString& InEngineVersion,
+			const FUATBatchFileParams& InUATBatchFileParams,
+			const FBuildPluginParams& InBuildPluginParams,
+			const FString& InWorkerAddress
+		);
+
+		// Destructor.
+		virtual ~FRemoteBuildPluginTask() override;
+
+		// IPluginBuilderTask interface.
+		virtual FString GetTaskLabel() const override;
+		virtual void Tick(float DeltaTime) override;
+		virtual void Terminate() override;
+		virtual void RequestCancel() override;
+		virtual FString GetTimingKey() const override;
+		virtual bool IsRemoteTask() const override { return true; }
+		// End of IPluginBuilderTask interface.
+
+	protected:
+		// IUATBatchFileTask interface.
+		virtual void Initialize() override;
+		virtual bool RunsUATBatchFile() const override { return false; }
+		// End of IUATBatchFileTask interface.
+
+	private:
+		// Sends the build request and the plugin source, then receives the output and the built plugin. Runs on its own thread.
+		void RunConnection();
+
+		// Stops the connection thread and waits for it to finish.
+		void StopConnection();
+
+	private:
+		// The dataset used to process plugin build, sent to the worker.
+		FBuildPluginParams RemoteBuildPluginParams;
+
+		// The address of the build worker, such as "192.168.0.10:9100".
+		FString WorkerAddress;
+
+		// The thread that talks to the worker.
+		TFuture<void> ConnectionFuture;
+
+		// Set when the connection thread should stop.
+		FThreadSafeBool bShouldStop;
+
+		// Guards the state below, which is shared by the connection thread and the game thread.
+		FCriticalSection CriticalSection;
+
+		// The connection to the worker while it is open.
+		TSharedPtr<FRemoteBuildConnection> Connection;
+
+		// The output of the build received since the last tick.
+		TArray<uint8> ReceivedOutput;
+
+		// Whether the connection thread has finished, whether the build succeeded, and why it failed.
+		bool bHasConnectionFinished = false;
+		bool bHasRemoteBuildSucceeded = false;
+		FString RemoteError;
+	};
+}
@@ -2,16 +2,21 @@
 
 #include "PluginBuilder/Tasks/UploadToCloudTask.h"
 #include "PluginBuilder/Tasks/ZipUpPluginTask.h"
+#include "PluginBuilder/CloudStorages/CloudStorageFileReader.h"
 #include "PluginBuilder/CloudStorages/CloudStorageManager.h"
 #include "PluginBuilder/CloudStorages/ICloudStorageProvider.h"
+#include "PluginBuilder/CloudStorages/UploadBandwidthThrottle.h"
 #include "PluginBuilder/Types/OneDriveConflictBehavior.h"
 #include "PluginBuilder/Utilities/PluginBuilderPackagingSettings.h"
 #include "PluginBuilder/Utilities/PluginBuilderSettings.h"
+#include "PluginBuilder/Utilities/PackageTrace.h"
 #include "PluginBuilder/PluginBuilderGlobals.h"
+#include "Async/Async.h"
 #include "Misc/Paths.h"
 #include "Misc/DateTime.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
 
 namespace PluginBuilder
 {
@@ -25,12 +30,26 @@ namespace PluginBuilder
 		, PackagedPluginsPath(InPackagedPluginsPath)
 		, PluginName(InPluginName)
 		, bGetShareUrls(bInGetShareUrls)
+		, bIncludePluginNameInTaskLabel(false)
 		, State(EState::PreInitialize)
 		, bHasAnyError(false)
-		, bHttpRequestPending(false)
+		, bIsFileInProgress(false)
 		, CurrentFileIndex(0)
-		, CurrentFileProgress(0.f)
+		, TotalBytes(0)
+		, ProcessedBytes(0)
+		, TransferredBytes(0)
+		, UploadedBytes(0)
+		, NumSkippedUploads(0)
+		, FileProcessingTime(0.0)
 	{
+		for (const TSharedPtr<FZipUpPluginTask>& ZipTask : ZipTasks)
+		{
+			if (ZipTask.IsValid())
+			{
+				ZipTask->OnZipStarted.BindRaw(this, &FUploadToCloudTask::HandleOnZipStarted);
+				ZipTask->OnZipCompleted.BindRaw(this, &FUploadToCloudTask::HandleOnZipCompleted);
+			}
+		}
 	}
 
 	FUploadToCloudTask::FUploadToCloudTask(
@@ -43,12 +62,68 @@ namespace PluginBuilder
 		, PackagedPluginsPath(InPackagedPluginsPath)
 		, PluginName(InPluginName)
 		, bGetShareUrls(bInGetShareUrls)
+		, bIncludePluginNameInTaskLabel(false)
 		, State(EState::PreInitialize)
 		, bHasAnyError(false)
-		, bHttpRequestPending(false)
+		, bIsFileInProgress(false)
 		, CurrentFileIndex(0)
-		, CurrentFileProgress(0.f)
+		, TotalBytes(0)
+		, ProcessedBytes(0)
+		, TransferredBytes(0)
+		, UploadedBytes(0)
+		, NumSkippedUploads(0)
+		, FileProcessingTime(0.0)
+	{
+	}
+
+	FUploadToCloudTask::~FUploadToCloudTask()
+	{
+		for (const TSharedPtr<FZipUpPluginTask>& ZipTask : ZipTasks)
+		{
+			if (ZipTask.IsValid())
+			{
+				ZipTask->OnZipStarted.Unbind();
+				ZipTask->OnZipCompleted.Unbind();
+			}
+		}
+
+		for (FDestination& Destination : Destinations)
+		{
+			for (const FString& RemotePath : Destination.PreparedRemotePaths.Array())
+			{
+				DiscardPreparedUpload(Destination, RemotePath);
+			}
+		}
+	}
+
+	void FUploadToCloudTask::SetDestinationProviders(const TArray<TSharedPtr<ICloudStorageProvider>>& InProviders)
+	{
+		check(State == EState::PreInitialize && Destinations.Num() == 0);
+
+		for (const TSharedPtr<ICloudStorageProvider>& Provider : InProviders)
+		{
+			FDestination& Destination = Destinations.AddDefaulted_GetRef();
+			Destination.Provider = Provider;
+		}
+	}
+
+	void FUploadToCloudTask::SetIncludePluginNameInTaskLabel(const bool bInIncludePluginNameInTaskLabel)
+	{
+		check(State == EState::PreInitialize);
+
+		bIncludePluginNameInTaskLabel = bInIncludePluginNameInTaskLabel;
+	}
+
+	void FUploadToCloudTask::HandleOnTaskSkipped(const IPluginBuilderTask* SkippedTask)
 	{
+		// A skipped zip task never starts, so it is treated as collected in the same way as a failed one.
+		for (const TSharedPtr<FZipUpPluginTask>& ZipTask : ZipTasks)
+		{
+			if (ZipTask.Get() == SkippedTask)
+			{
+				CollectedZipTasks.Add(ZipTask.Get());
+			}
+		}
 	}
 
 	IPluginBuilderTask::EState FUploadToCloudTask::GetState() const
@@ -56,6 +131,24 @@ namespace PluginBuilder
 		return State;
 	}
 
+	bool FUploadToCloudTask::CanStart() const
+	{
+		// Uploading starts as soon as the first zip task has completed.
+		if (ZipTasks.Num() == 0)
+		{
+			return true;
+		}
+
+		for (const TSharedPtr<FZipUpPluginTask>& ZipTask : ZipTasks)
+		{
+			if (!ZipTask.IsValid() || (ZipTask->GetState() == EState::Terminated))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
 	bool FUploadToCloudTask::HasAnyError() const
 	{
 		return bHasAnyError;
@@ -63,38 +156,59 @@ namespace PluginBuilder
 
 	FString FUploadToCloudTask::GetTaskLabel() const
 	{
+		if (bIncludePluginNameInTaskLabel)
+		{
+			return FString::Printf(TEXT("%s Cloud Storage"), *PluginName);
+		}
+
 		return TEXT("Cloud Storage");
 	}
 
 	void FUploadToCloudTask::Initialize()
 	{
-		Provider = FCloudStorageManager::GetCurrentProvider();
-		if (!Provider.IsValid() || !Provider->IsAuthenticated())
+		ResolveDestinations();
+
+		// A destination that cannot be used is reported, and the files are still uploaded to the others.
+		for (int32 DestinationIndex = Destinations.Num() - 1; DestinationIndex >= 0; DestinationIndex--)
 		{
-			UE_LOG(LogPluginBuilder, Error, TEXT("Cloud Storage upload: Not authenticated. Please sign in from Editor Preferences > Plugins > Plugin Builder - OneDrive."));
+			FDestination& Destination = Destinations[DestinationIndex];
+			if (Destination.Provider.IsValid() && Destination.Provider->IsAuthenticated())
+			{
+				continue;
+			}
+
+			UE_LOG(LogPluginBuilder, Error, TEXT("Cloud Storage upload: Not authenticated. Please sign in or enter the credentials from Editor Preferences > Plugins > Plugin Builder - %s."), Destination.Provider.IsValid() ? *Destination.Provider->GetProviderName() : TEXT("OneDrive"));
 			bHasAnyError = true;
+
+			for (const FString& RemotePath : Destination.PreparedRemotePaths.Array())
+			{
+				DiscardPreparedUpload(Destination, RemotePath);
+			}
+			Destinations.RemoveAt(DestinationIndex);
+		}
+
+		if (Destinations.Num() == 0)
+		{
 			State = EState::Terminated;
 			return;
 		}
 
-		// Resolve zip file paths from zip tasks if not already set.
-		if (ZipFilePaths.Num() == 0)
+		// Zip files of zip tasks are added as each task completes, so that uploading overlaps the remaining builds.
+		if (ZipTasks.Num() > 0)
 		{
-			for (const TSharedPtr<FZipUpPluginTask>& ZipTask : ZipTasks)
+			CollectCompletedZipFiles();
+		}
+		else
+		{
+			const TArray<FString> InitialZipFilePaths = MoveTemp(ZipFilePaths);
+			ZipFilePaths.Reset();
+			for (const FString& ZipFilePath : InitialZipFilePaths)
 			{
-				if (!ZipTask.IsValid() || ZipTask->HasAnyError())
-				{
-					continue;
-				}
-				const FString& ZipPath = ZipTask->GetZipFilePath();
-				if (!ZipPath.IsEmpty())
-				{
-					ZipFilePaths.Add(ZipPath);
-				}
+				AddFileToUpload(ZipFilePath);
 			}
 		}
 
-		if (ZipFilePaths.Num() == 0)
+		if (GetNumFilesToUpload() == 0)
 		{
 			UE_LOG(LogPluginBuilder, Warning, TEXT("Cloud Storage upload: No zip files to upload."));
 			State = EState::Terminated;
@@ -102,7 +216,7 @@ namespace PluginBuilder
 		}
 
 		UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
-		UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: Starting upload of %d file(s)..."), ZipFilePaths.Num());
+		UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: Starting upload of %d file(s) to %d destination(s)..."), GetNumFilesToUpload(), Destinations.Num());
 
 		State = EState::Processing;
 		ProcessNextFile();
@@ -110,16 +224,17 @@ namespace PluginBuilder
 
 	void FUploadToCloudTask::Tick(float /* DeltaTime */)
 	{
-		if (bHttpRequestPending)
+		if (bIsFileInProgress)
 		{
 			return;
 		}
 
+		CollectCompletedZipFiles();
 		if (CurrentFileIndex < ZipFilePaths.Num())
 		{
 			ProcessNextFile();
 		}
-		else
+		else if (AreAllZipTasksCollected())
 		{
 			State = EState::PreTerminate;
 		}
@@ -133,21 +248,46 @@ namespace PluginBuilder
 
 	float FUploadToCloudTask::GetProgress() const
 	{
-		if (ZipFilePaths.Num() == 0)
+		const int32 NumFiles = GetNumFilesToUpload();
+		if (NumFiles == 0)
 		{
 			return -1.f;
 		}
-		const float FileProgress = (static_cast<float>(CurrentFileIndex) + FMath::Clamp(CurrentFileProgress, 0.f, 1.f)) / static_cast<float>(ZipFilePaths.Num());
+		const float FileProgress = (static_cast<float>(CurrentFileIndex) + GetCurrentFileProgress()) / static_cast<float>(NumFiles);
 		return FMath::Clamp(FileProgress, 0.f, 1.f);
 	}
 
 	FString FUploadToCloudTask::GetProgressText() const
 	{
-		if (ZipFilePaths.Num() == 0)
+		const int32 NumFiles = GetNumFilesToUpload();
+		if (NumFiles == 0)
 		{
 			return FString();
 		}
-		return FString::Printf(TEXT("[%d/%d]"), FMath::Min(CurrentFileIndex + 1, ZipFilePaths.Num()), ZipFilePaths.Num());
+
+		FString ProgressText = FString::Printf(TEXT("[%d/%d]"), FMath::Min(CurrentFileIndex + 1, NumFiles), NumFiles);
+		if (TotalBytes <= 0)
+		{
+			return ProgressText;
+		}
+
+		const int64 CurrentFileSize = (FileSizes.IsValidIndex(CurrentFileIndex) ? FileSizes[CurrentFileIndex] : 0);
+		const int64 DisplayedBytes = ProcessedBytes + static_cast<int64>(GetCurrentFileProgress() * CurrentFileSize);
+		ProgressText += FString::Printf(TEXT(" %s / %s"), *FormatBytes(DisplayedBytes), *FormatBytes(TotalBytes));
+
+		const double RemainingTime = GetEstimatedRemainingTime();
+		if (RemainingTime >= 0.)
+		{
+			ProgressText += FString::Printf(TEXT(", ETA %s"), *FormatDuration(RemainingTime));
+		}
+
+		const int64 BandwidthLimit = FUploadBandwidthThrottle::GetCurrentBandwidthLimit();
+		if (BandwidthLimit > 0)
+		{
+			ProgressText += FString::Printf(TEXT(" (limited to %s/s)"), *FormatBytes(BandwidthLimit));
+		}
+
+		return ProgressText;
 	}
 
 	bool FUploadToCloudTask::IsCloudUploadTask() const
@@ -155,164 +295,360 @@ namespace PluginBuilder
 		return true;
 	}
 
+	FString FUploadToCloudTask::GetTimingKey() const
+	{
+		TArray<FString> ProviderNames;
+		if (Destinations.Num() > 0)
+		{
+			for (const FDestination& Destination : Destinations)
+			{
+				if (Destination.Provider.IsValid())
+				{
+					ProviderNames.Add(Destination.Provider->GetProviderName());
+				}
+			}
+		}
+		else
+		{
+			for (const TSharedPtr<ICloudStorageProvider>& Provider : FCloudStorageManager::GetDestinationProviders())
+			{
+				if (Provider.IsValid())
+				{
+					ProviderNames.Add(Provider->GetProviderName());
+				}
+			}
+		}
+
+		// The number of files is part of the key since the time grows with it.
+		const int32 NumFiles = (ZipTasks.Num() > 0 ? ZipTasks.Num() : ZipFilePaths.Num());
+		return FString::Printf(TEXT("Upload|%s|%s|%d"), *PluginName, *FString::Join(ProviderNames, TEXT("+")), NumFiles);
+	}
+
+	FTaskPhaseTimes FUploadToCloudTask::GetPhaseTimes() const
+	{
+		FTaskPhaseTimes PhaseTimes;
+		PhaseTimes.Add(ETaskPhase::Upload, FileProcessingTime);
+		if (FileProcessingStartTime.IsSet())
+		{
+			PhaseTimes.Add(ETaskPhase::Upload, FPlatformTime::Seconds() - FileProcessingStartTime.GetValue());
+		}
+		return PhaseTimes;
+	}
+
+	void FUploadToCloudTask::GetReportMetrics(TMap<FString, double>& OutMetrics) const
+	{
+		OutMetrics.Add(TEXT("files"), ZipFilePaths.Num());
+		OutMetrics.Add(TEXT("destinations"), Destinations.Num());
+		OutMetrics.Add(TEXT("uploadedBytes"), UploadedBytes);
+		OutMetrics.Add(TEXT("skippedUploads"), NumSkippedUploads);
+	}
+
 	void FUploadToCloudTask::ProcessNextFile()
 	{
 		if (CurrentFileIndex >= ZipFilePaths.Num())
 		{
-			State = EState::PreTerminate;
+			// Tick waits here for the zip tasks that are still running.
+			if (AreAllZipTasksCollected())
+			{
+				State = EState::PreTerminate;
+			}
 			return;
 		}
 
-		CurrentFileProgress = 0.f;
-
 		const FString& LocalPath = ZipFilePaths[CurrentFileIndex];
-		const FString RemotePath = BuildRemotePath(LocalPath);
-
-		UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: [%d/%d] %s"), CurrentFileIndex + 1, ZipFilePaths.Num(), *FPaths::GetCleanFilename(LocalPath));
-
-		bHttpRequestPending = true;
 
-		const EOneDriveConflictBehavior ConflictBehavior = GetSettings<UPluginBuilderPackagingSettings>().ConflictBehavior;
-		if (ConflictBehavior == EOneDriveConflictBehavior::Ignore)
+		// Wait for the hashes of this file; Tick calls back here until they are ready.
+		if (GetSettings<UPluginBuilderPackagingSettings>().bSkipIdenticalUploads)
 		{
-			Provider->FindItem(
-				RemotePath,
-				[this, LocalPath, RemotePath](bool bFound, const FString& ExistingItemId)
+			for (const FDestination& Destination : Destinations)
+			{
+				const TFuture<FString>* LocalContentHashPtr = Destination.LocalContentHashes.Find(LocalPath);
+				if ((LocalContentHashPtr != nullptr) && !LocalContentHashPtr->IsReady())
 				{
-					if (bFound && !ExistingItemId.IsEmpty())
-					{
-						UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: File already exists, skipping upload."));
-						SuccessfulUploads.Add(LocalPath);
-
-						if (!bGetShareUrls)
-						{
-							CurrentFileIndex++;
-							bHttpRequestPending = false;
-							return;
-						}
-
-						Provider->GetShareUrl(
-							ExistingItemId,
-							[this, LocalPath](bool bUrlSuccess, const FString& ShareUrl)
-							{
-								if (!bUrlSuccess || ShareUrl.IsEmpty())
-								{
-									UE_LOG(LogPluginBuilder, Error, TEXT("Cloud Storage upload: Failed to get share URL for %s."), *FPaths::GetCleanFilename(LocalPath));
-									bHasAnyError = true;
-								}
-								else
-								{
-									ShareUrlResults.Add(LocalPath, ShareUrl);
-								}
-								CurrentFileIndex++;
-								bHttpRequestPending = false;
-							}
-						);
-					}
-					else
-					{
-						// File not found; proceed with normal upload.
-						UploadFileNow(LocalPath, RemotePath);
-					}
+					return;
 				}
+			}
+		}
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: [%d/%d] %s"), CurrentFileIndex + 1, GetNumFilesToUpload(), *FPaths::GetCleanFilename(LocalPath));
+
+		// One reader per destination, so that every chunk is read from disk once and shared by all of them.
+		const TArray<TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe>> FileReaders = FCloudStorageFileReader::CreateReaders(LocalPath, Destinations.Num());
+
+		bIsFileInProgress = true;
+		FileProcessingStartTime = FPlatformTime::Seconds();
+		FPackageTrace& Trace = FPackageTrace::Get();
+		for (int32 DestinationIndex = 0; DestinationIndex < Destinations.Num(); DestinationIndex++)
+		{
+			FDestination& Destination = Destinations[DestinationIndex];
+			Destination.bIsProcessing = true;
+			Destination.CurrentFileProgress = 0.f;
+			Destination.FileTraceEventId = Trace.BeginEvent(
+				Trace.GetTrackId(FString::Printf(TEXT("%s - %s"), *GetTraceTrackName(), *Destination.Provider->GetProviderName())),
+				FPaths::GetCleanFilename(LocalPath),
+				TEXT("Upload")
 			);
-			return;
+			if (FileReaders.IsValidIndex(DestinationIndex))
+			{
+				Destination.FileReader = FileReaders[DestinationIndex];
+			}
 		}
 
-		UploadFileNow(LocalPath, RemotePath);
+		for (int32 DestinationIndex = 0; DestinationIndex < Destinations.Num(); DestinationIndex++)
+		{
+			ProcessFileForDestination(DestinationIndex, LocalPath);
+		}
 	}
 
-	void FUploadToCloudTask::UploadFileNow(const FString& LocalPath, const FString& RemotePath)
+	void FUploadToCloudTask::ProcessFileForDestination(const int32 DestinationIndex, const FString& LocalPath)
 	{
-		Provider->UploadFile(
-			LocalPath,
+		FDestination& Destination = Destinations[DestinationIndex];
+		const FString RemotePath = BuildRemotePath(Destination.Provider, LocalPath);
+
+		const auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
+		const TFuture<FString>* LocalContentHashPtr = Destination.LocalContentHashes.Find(LocalPath);
+		const FString LocalContentHash = (
+			(Settings.bSkipIdenticalUploads && (LocalContentHashPtr != nullptr)) ?
+			LocalContentHashPtr->Get() :
+			FString()
+		);
+
+		// From here on the provider owns any session prepared for this path.
+		Destination.PreparedRemotePaths.Remove(RemotePath);
+
+		const bool bIgnoreExisting = (Settings.ConflictBehavior == EOneDriveConflictBehavior::Ignore);
+		if (!bIgnoreExisting && LocalContentHash.IsEmpty())
+		{
+			UploadFileNow(DestinationIndex, LocalPath, RemotePath);
+			return;
+		}
+
+		Destination.Provider->FindItem(
 			RemotePath,
-			[this, LocalPath](bool bSuccess, const FString& ItemId)
+			[this, DestinationIndex, LocalPath, RemotePath, bIgnoreExisting, LocalContentHash](bool bFound, const FString& ExistingItemId, const FString& RemoteContentHash)
 			{
-				if (!bSuccess || ItemId.IsEmpty())
+				if (!bFound || ExistingItemId.IsEmpty())
 				{
-					UE_LOG(LogPluginBuilder, Error, TEXT("Cloud Storage upload: Failed to upload %s."), *FPaths::GetCleanFilename(LocalPath));
-					bHasAnyError = true;
-					CurrentFileIndex++;
-					bHttpRequestPending = false;
+					// File not found; proceed with normal upload.
+					UploadFileNow(DestinationIndex, LocalPath, RemotePath);
+					return;
+				}
+
+				if (bIgnoreExisting)
+				{
+					UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: %sFile already exists, skipping upload."), *GetLogPrefix(DestinationIndex));
+					SkipUpload(DestinationIndex, LocalPath, RemotePath, ExistingItemId);
+					return;
+				}
+
+				if (!LocalContentHash.IsEmpty() && LocalContentHash.Equals(RemoteContentHash, ESearchCase::IgnoreCase))
+				{
+					UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: %sIdentical file already exists, skipping upload. (Hash = %s)"), *GetLogPrefix(DestinationIndex), *LocalContentHash);
+					SkipUpload(DestinationIndex, LocalPath, RemotePath, ExistingItemId);
 					return;
 				}
 
-				SuccessfulUploads.Add(LocalPath);
+				UploadFileNow(DestinationIndex, LocalPath, RemotePath);
+			}
+		);
+	}
 
-				if (!bGetShareUrls)
+	void FUploadToCloudTask::SkipUpload(const int32 DestinationIndex, const FString& LocalPath, const FString& RemotePath, const FString& ExistingItemId)
+	{
+		FDestination& Destination = Destinations[DestinationIndex];
+
+		// Releasing the reader lets the other destinations drop the data this one would have read.
+		Destination.FileReader.Reset();
+		Destination.Provider->DiscardPreparedUpload(RemotePath);
+		Destination.SuccessfulUploads.Add(LocalPath);
+		Destination.CurrentFileProgress = 1.f;
+		NumSkippedUploads++;
+
+		GetShareUrlAndFinish(DestinationIndex, LocalPath, ExistingItemId);
+	}
+
+	void FUploadToCloudTask::UploadFileNow(const int32 DestinationIndex, const FString& LocalPath, const FString& RemotePath)
+	{
+		FDestination& Destination = Destinations[DestinationIndex];
+		if (!Destination.FileReader.IsValid())
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Cloud Storage upload: %sFailed to upload %s."), *GetLogPrefix(DestinationIndex), *FPaths::GetCleanFilename(LocalPath));
+			bHasAnyError = true;
+			FinishFileForDestination(DestinationIndex);
+			return;
+		}
+
+		if (!TransferStartTime.IsSet())
+		{
+			TransferStartTime = FPlatformTime::Seconds();
+		}
+
+		// From here on the provider holds the reader for as long as it needs it.
+		const TSharedRef<FCloudStorageFileReader, ESPMode::ThreadSafe> FileReader = Destination.FileReader.ToSharedRef();
+		Destination.FileReader.Reset();
+
+		const int64 FileSize = FileReader->GetFileSize();
+		Destination.Provider->UploadFile(
+			FileReader,
+			RemotePath,
+			[this, DestinationIndex, LocalPath, FileSize](bool bSuccess, const FString& ItemId)
+			{
+				if (!bSuccess || ItemId.IsEmpty())
 				{
-					CurrentFileIndex++;
-					bHttpRequestPending = false;
+					UE_LOG(LogPluginBuilder, Error, TEXT("Cloud Storage upload: %sFailed to upload %s."), *GetLogPrefix(DestinationIndex), *FPaths::GetCleanFilename(LocalPath));
+					bHasAnyError = true;
+					FinishFileForDestination(DestinationIndex);
 					return;
 				}
 
-				UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: Upload succeeded. Getting share URL..."));
+				Destinations[DestinationIndex].SuccessfulUploads.Add(LocalPath);
+				UploadedBytes += FileSize;
 
-				Provider->GetShareUrl(
-					ItemId,
-					[this, LocalPath](bool bUrlSuccess, const FString& ShareUrl)
-					{
-						if (!bUrlSuccess || ShareUrl.IsEmpty())
-						{
-							UE_LOG(LogPluginBuilder, Error, TEXT("Cloud Storage upload: Failed to get share URL for %s."), *FPaths::GetCleanFilename(LocalPath));
-							bHasAnyError = true;
-						}
-						else
-						{
-							ShareUrlResults.Add(LocalPath, ShareUrl);
-						}
-						CurrentFileIndex++;
-						bHttpRequestPending = false;
-					}
-				);
+				if (bGetShareUrls)
+				{
+					UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: %sUpload succeeded. Getting share URL..."), *GetLogPrefix(DestinationIndex));
+				}
+				GetShareUrlAndFinish(DestinationIndex, LocalPath, ItemId);
 			},
-			[this](float Progress)
+			[this, DestinationIndex](float Progress)
 			{
-				CurrentFileProgress = Progress;
+				FDestination& Destination = Destinations[DestinationIndex];
+				const int64 CurrentFileSize = (FileSizes.IsValidIndex(CurrentFileIndex) ? FileSizes[CurrentFileIndex] : 0);
+				const float ProgressDelta = FMath::Max(Progress - Destination.CurrentFileProgress, 0.f);
+				TransferredBytes += static_cast<int64>(ProgressDelta * CurrentFileSize / Destinations.Num());
+				Destination.CurrentFileProgress = Progress;
 			}
 		);
 	}
 
-	void FUploadToCloudTask::FinalizeResults()
+	void FUploadToCloudTask::GetShareUrlAndFinish(const int32 DestinationIndex, const FString& LocalPath, const FString& ItemId)
 	{
-		UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
-		UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: Results:"));
-
-		for (const FString& FilePath : ZipFilePaths)
+		if (!bGetShareUrls)
 		{
-			const FString FileName = FPaths::GetCleanFilename(FilePath);
+			FinishFileForDestination(DestinationIndex);
+			return;
+		}
 
-			if (!SuccessfulUploads.Contains(FilePath))
+		Destinations[DestinationIndex].Provider->GetShareUrl(
+			ItemId,
+			[this, DestinationIndex, LocalPath](bool bUrlSuccess, const FString& ShareUrl)
 			{
-				UE_LOG(LogPluginBuilder, Error, TEXT("  [FAILED] %s"), *FileName);
-				continue;
+				if (!bUrlSuccess || ShareUrl.IsEmpty())
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("Cloud Storage upload: %sFailed to get share URL for %s."), *GetLogPrefix(DestinationIndex), *FPaths::GetCleanFilename(LocalPath));
+					bHasAnyError = true;
+				}
+				else
+				{
+					Destinations[DestinationIndex].ShareUrlResults.Add(LocalPath, ShareUrl);
+				}
+				FinishFileForDestination(DestinationIndex);
 			}
+		);
+	}
+
+	void FUploadToCloudTask::FinishFileForDestination(const int32 DestinationIndex)
+	{
+		FDestination& Destination = Destinations[DestinationIndex];
+		Destination.FileReader.Reset();
+		Destination.bIsProcessing = false;
 
-			if (!bGetShareUrls)
+		const bool bHasUploaded = (ZipFilePaths.IsValidIndex(CurrentFileIndex) && Destination.SuccessfulUploads.Contains(ZipFilePaths[CurrentFileIndex]));
+		FPackageTrace::Get().EndEvent(
+			Destination.FileTraceEventId,
 			{
-				UE_LOG(LogPluginBuilder, Log, TEXT("  [OK] %s"), *FileName);
-				continue;
+				{ TEXT("bytes"), static_cast<double>(FileSizes.IsValidIndex(CurrentFileIndex) ? FileSizes[CurrentFileIndex] : 0) },
+				{ TEXT("succeeded"), (bHasUploaded ? 1.0 : 0.0) }
 			}
+		);
+		Destination.FileTraceEventId = INDEX_NONE;
 
-			const FString* ShareUrl = ShareUrlResults.Find(FilePath);
-			if (ShareUrl != nullptr && !ShareUrl->IsEmpty())
+		const bool bIsAnyDestinationProcessing = Destinations.ContainsByPredicate([](const FDestination& Other)
+		{
+			return Other.bIsProcessing;
+		});
+		if (bIsAnyDestinationProcessing)
+		{
+			return;
+		}
+
+		AdvanceToNextFile();
+		bIsFileInProgress = false;
+		if (FileProcessingStartTime.IsSet())
+		{
+			FileProcessingTime += (FPlatformTime::Seconds() - FileProcessingStartTime.GetValue());
+			FileProcessingStartTime.Reset();
+		}
+	}
+
+	void FUploadToCloudTask::FinalizeResults()
+	{
+		for (int32 DestinationIndex = 0; DestinationIndex < Destinations.Num(); DestinationIndex++)
+		{
+			const FDestination& Destination = Destinations[DestinationIndex];
+
+			UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
+			UE_LOG(LogPluginBuilder, Log, TEXT("Cloud Storage upload: %sResults:"), *GetLogPrefix(DestinationIndex));
+
+			for (const FString& FilePath : ZipFilePaths)
 			{
-				UE_LOG(LogPluginBuilder, Log, TEXT("  %s -> %s"), *FileName, **ShareUrl);
+				const FString FileName = FPaths::GetCleanFilename(FilePath);
+
+				if (!Destination.SuccessfulUploads.Contains(FilePath))
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("  [FAILED] %s"), *FileName);
+					continue;
+				}
+
+				if (!bGetShareUrls)
+				{
+					UE_LOG(LogPluginBuilder, Log, TEXT("  [OK] %s"), *FileName);
+					continue;
+				}
+
+				const FString* ShareUrl = Destination.ShareUrlResults.Find(FilePath);
+				if (ShareUrl != nullptr && !ShareUrl->IsEmpty())
+				{
+					UE_LOG(LogPluginBuilder, Log, TEXT("  %s -> %s"), *FileName, **ShareUrl);
+				}
+				else
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("  [FAILED to get URL] %s"), *FileName);
+				}
 			}
-			else
+
+			if (bGetShareUrls && (Destination.ShareUrlResults.Num() > 0))
 			{
-				UE_LOG(LogPluginBuilder, Error, TEXT("  [FAILED to get URL] %s"), *FileName);
+				WriteShareUrlsToFile(Destination);
 			}
 		}
+	}
+
+	void FUploadToCloudTask::ResolveDestinations()
+	{
+		if (Destinations.Num() > 0)
+		{
+			return;
+		}
 
-		if (bGetShareUrls && (ShareUrlResults.Num() > 0))
+		for (const TSharedPtr<ICloudStorageProvider>& Provider : FCloudStorageManager::GetDestinationProviders())
 		{
-			WriteShareUrlsToFile();
+			FDestination& Destination = Destinations.AddDefaulted_GetRef();
+			Destination.Provider = Provider;
 		}
 	}
 
-	FString FUploadToCloudTask::BuildRemotePath(const FString& LocalZipFilePath) const
+	FString FUploadToCloudTask::GetLogPrefix(const int32 DestinationIndex) const
+	{
+		// Messages stay as they were when there is only one destination.
+		if (Destinations.Num() <= 1 || !Destinations[DestinationIndex].Provider.IsValid())
+		{
+			return FString();
+		}
+		return FString::Printf(TEXT("[%s] "), *Destinations[DestinationIndex].Provider->GetProviderName());
+	}
+
+	FString FUploadToCloudTask::BuildRemotePath(const TSharedPtr<ICloudStorageProvider>& Provider, const FString& LocalZipFilePath) const
 	{
 		// Strip PackagedPlugins prefix to get the relative path.
 		FString RelativePath = LocalZipFilePath;
@@ -341,17 +677,257 @@ namespace PluginBuilder
 		return FString::Printf(TEXT("%s/%s/%s"), *BaseFolderPath, *PluginName, *RelativePath);
 	}
 
-	void FUploadToCloudTask::WriteShareUrlsToFile() const
+	void FUploadToCloudTask::HandleOnZipStarted(const FString& ZipFilePath)
+	{
+		ResolveDestinations();
+
+		// Ignore has to check for an existing item right before uploading, so a session cannot be opened in advance.
+		if (GetSettings<UPluginBuilderPackagingSettings>().ConflictBehavior == EOneDriveConflictBehavior::Ignore)
+		{
+			return;
+		}
+
+		for (FDestination& Destination : Destinations)
+		{
+			if (!Destination.Provider.IsValid() || !Destination.Provider->IsAuthenticated())
+			{
+				continue;
+			}
+
+			const FString RemotePath = BuildRemotePath(Destination.Provider, ZipFilePath);
+			Destination.Provider->PrepareUpload(RemotePath);
+			Destination.PreparedRemotePaths.Add(RemotePath);
+		}
+	}
+
+	void FUploadToCloudTask::HandleOnZipCompleted(const FString& ZipFilePath)
+	{
+		if (GetSettings<UPluginBuilderPackagingSettings>().bSkipIdenticalUploads)
+		{
+			StartComputingContentHash(ZipFilePath);
+		}
+	}
+
+	void FUploadToCloudTask::CollectCompletedZipFiles()
+	{
+		for (const TSharedPtr<FZipUpPluginTask>& ZipTask : ZipTasks)
+		{
+			if (!ZipTask.IsValid() || (ZipTask->GetState() != EState::Terminated) || CollectedZipTasks.Contains(ZipTask.Get()))
+			{
+				continue;
+			}
+			CollectedZipTasks.Add(ZipTask.Get());
+
+			const FString& ZipPath = ZipTask->GetZipFilePath();
+			if (ZipTask->HasAnyError())
+			{
+				if (!ZipPath.IsEmpty())
+				{
+					for (FDestination& Destination : Destinations)
+					{
+						DiscardPreparedUpload(Destination, BuildRemotePath(Destination.Provider, ZipPath));
+					}
+				}
+				continue;
+			}
+			if (!ZipPath.IsEmpty())
+			{
+				AddFileToUpload(ZipPath);
+			}
+		}
+	}
+
+	bool FUploadToCloudTask::AreAllZipTasksCollected() const
+	{
+		for (const TSharedPtr<FZipUpPluginTask>& ZipTask : ZipTasks)
+		{
+			if (ZipTask.IsValid() && !CollectedZipTasks.Contains(ZipTask.Get()))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	int32 FUploadToCloudTask::GetNumFilesToUpload() const
+	{
+		int32 NumFiles = ZipFilePaths.Num();
+		for (const TSharedPtr<FZipUpPluginTask>& ZipTask : ZipTasks)
+		{
+			if (ZipTask.IsValid() && !CollectedZipTasks.Contains(ZipTask.Get()))
+			{
+				NumFiles++;
+			}
+		}
+		return NumFiles;
+	}
+
+	void FUploadToCloudTask::AddFileToUpload(const FString& LocalPath)
+	{
+		const int64 FileSize = FMath::Max<int64>(IFileManager::Get().FileSize(*LocalPath), 0);
+		ZipFilePaths.Add(LocalPath);
+		FileSizes.Add(FileSize);
+		TotalBytes += FileSize;
+
+		if (GetSettings<UPluginBuilderPackagingSettings>().bSkipIdenticalUploads)
+		{
+			StartComputingContentHash(LocalPath);
+		}
+	}
+
+	void FUploadToCloudTask::StartComputingContentHash(const FString& LocalPath)
+	{
+		ResolveDestinations();
+
+		for (FDestination& Destination : Destinations)
+		{
+			if (!Destination.Provider.IsValid() || Destination.LocalContentHashes.Contains(LocalPath))
+			{
+				continue;
+			}
+
+			// The provider is kept alive by the worker so that the task can be destroyed while hashing.
+			const TSharedPtr<ICloudStorageProvider> HashProvider = Destination.Provider;
+			Destination.LocalContentHashes.Add(
+				LocalPath,
+				Async(EAsyncExecution::ThreadPool, [HashProvider, LocalPath]() -> FString
+				{
+					return HashProvider->ComputeContentHash(LocalPath);
+				})
+			);
+		}
+	}
+
+	void FUploadToCloudTask::DiscardPreparedUpload(FDestination& Destination, const FString& RemotePath)
+	{
+		if (Destination.PreparedRemotePaths.Remove(RemotePath) > 0 && Destination.Provider.IsValid())
+		{
+			Destination.Provider->DiscardPreparedUpload(RemotePath);
+		}
+	}
+
+	float FUploadToCloudTask::GetCurrentFileProgress() const
+	{
+		if (!bIsFileInProgress || Destinations.Num() == 0)
+		{
+			return 0.f;
+		}
+
+		float TotalProgress = 0.f;
+		for (const FDestination& Destination : Destinations)
+		{
+			TotalProgress += (Destination.bIsProcessing ? FMath::Clamp(Destination.CurrentFileProgress, 0.f, 1.f) : 1.f);
+		}
+		return (TotalProgress / static_cast<float>(Destinations.Num()));
+	}
+
+	double FUploadToCloudTask::GetEstimatedRemainingTime() const
+	{
+		const int64 CurrentFileSize = (FileSizes.IsValidIndex(CurrentFileIndex) ? FileSizes[CurrentFileIndex] : 0);
+		const int64 RemainingBytes = TotalBytes - ProcessedBytes - static_cast<int64>(GetCurrentFileProgress() * CurrentFileSize);
+		if (RemainingBytes <= 0)
+		{
+			return 0.;
+		}
+
+		double BytesPerSecond = 0.;
+		if (TransferStartTime.IsSet() && (TransferredBytes > 0))
+		{
+			const double ElapsedTime = (FPlatformTime::Seconds() - TransferStartTime.GetValue());
+			if (ElapsedTime > 0.)
+			{
+				BytesPerSecond = (static_cast<double>(TransferredBytes) / ElapsedTime);
+			}
+		}
+
+		// The limit may have just become stricter (e.g. work hours started), so the measured speed alone is too optimistic.
+		const int64 BandwidthLimit = FUploadBandwidthThrottle::GetCurrentBandwidthLimit();
+		if (BandwidthLimit > 0)
+		{
+			BytesPerSecond = ((BytesPerSecond > 0.) ? FMath::Min(BytesPerSecond, static_cast<double>(BandwidthLimit)) : static_cast<double>(BandwidthLimit));
+		}
+
+		if (BytesPerSecond <= 0.)
+		{
+			return -1.;
+		}
+
+		return (static_cast<double>(RemainingBytes) / BytesPerSecond);
+	}
+
+	void FUploadToCloudTask::AdvanceToNextFile()
+	{
+		if (FileSizes.IsValidIndex(CurrentFileIndex))
+		{
+			ProcessedBytes += FileSizes[CurrentFileIndex];
+		}
+		CurrentFileIndex++;
+	}
+
+	FString FUploadToCloudTask::GetThroughputText() const
+	{
+		if (!TransferStartTime.IsSet() || (TransferredBytes <= 0))
+		{
+			return FString();
+		}
+
+		const double ElapsedTime = (FPlatformTime::Seconds() - TransferStartTime.GetValue());
+		if (ElapsedTime <= 0.)
+		{
+			return FString();
+		}
+
+		return FString::Printf(TEXT("%s/s"), *FormatBytes(static_cast<int64>(static_cast<double>(TransferredBytes) / ElapsedTime)));
+	}
+
+	FString FUploadToCloudTask::FormatBytes(const int64 NumBytes)
+	{
+		if (NumBytes >= 1024 * 1024 * 1024)
+		{
+			return FString::Printf(TEXT("%.2f GB"), static_cast<double>(NumBytes) / (1024. * 1024. * 1024.));
+		}
+		if (NumBytes >= 1024 * 1024)
+		{
+			return FString::Printf(TEXT("%.1f MB"), static_cast<double>(NumBytes) / (1024. * 1024.));
+		}
+		return FString::Printf(TEXT("%.0f KB"), static_cast<double>(NumBytes) / 1024.);
+	}
+
+	FString FUploadToCloudTask::FormatDuration(const double Seconds)
+	{
+		const int64 TotalSeconds = static_cast<int64>(FMath::CeilToDouble(Seconds));
+		const int64 Hours = (TotalSeconds / 3600);
+		const int64 Minutes = ((TotalSeconds / 60) % 60);
+		const int64 RemainingSeconds = (TotalSeconds % 60);
+		if (Hours > 0)
+		{
+			return FString::Printf(TEXT("%lldh %02lldm"), Hours, Minutes);
+		}
+		if (Minutes > 0)
+		{
+			return FString::Printf(TEXT("%lldm %02llds"), Minutes, RemainingSeconds);
+		}
+		return FString::Printf(TEXT("%llds"), RemainingSeconds);
+	}
+
+	void FUploadToCloudTask::WriteShareUrlsToFile(const FDestination& Destination) const
 	{
 		const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
 		const FString OutputDirectory = (FPaths::ProjectSavedDir() / TEXT("PluginBuilder"));
-		const FString FilePath = (OutputDirectory / FString::Printf(TEXT("ShareUrls_%s.txt"), *Timestamp));
+
+		FString FileName = FString::Printf(TEXT("ShareUrls_%s.txt"), *Timestamp);
+		if (Destinations.Num() > 1)
+		{
+			const FString ProviderName = Destination.Provider->GetProviderName().Replace(TEXT(" "), TEXT(""));
+			FileName = FString::Printf(TEXT("ShareUrls_%s_%s.txt"), *ProviderName, *Timestamp);
+		}
+		const FString FilePath = (OutputDirectory / FileName);
 
 		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 		PlatformFile.CreateDirectoryTree(*OutputDirectory);
 
 		FString Content;
-		for (const auto& Result : ShareUrlResults)
+		for (const auto& Result : Destination.ShareUrlResults)
 		{
 			Content += FString::Printf(TEXT("%s -> %s\n"), *FPaths::GetCleanFilename(Result.Key), *Result.Value);
 		}
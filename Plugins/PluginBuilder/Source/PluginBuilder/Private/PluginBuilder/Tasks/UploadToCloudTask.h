@@ -4,17 +4,20 @@
 
 #include "CoreMinimal.h"
 #include "PluginBuilder/Tasks/IPluginBuilderTask.h"
+#include "Async/Future.h"
 
 namespace PluginBuilder
 {
 	class ICloudStorageProvider;
+	class FCloudStorageFileReader;
 	class FZipUpPluginTask;
 
 	/**
-	 * A task that uploads completed zip files to a cloud storage provider
+	 * A task that uploads completed zip files to one or more cloud storage providers
 	 * and optionally retrieves an edit-permission share URL for each file.
+	 * Each file is read from disk once and sent to every destination in parallel.
 	 * Results are logged to the Output Log and, when share URLs are requested,
-	 * saved to a text file under Saved/PluginBuilder/.
+	 * saved to a text file for each destination under Saved/PluginBuilder/.
 	 */
 	class PLUGINBUILDER_API FUploadToCloudTask : public IPluginBuilderTask
 	{
@@ -35,8 +38,22 @@ namespace PluginBuilder
 			bool bInGetShareUrls
 		);
 
+		// Destructor.
+		virtual ~FUploadToCloudTask() override;
+
+		// Uploads to the specified providers instead of the ones selected in editor preferences.
+		// Must be called before Initialize.
+		void SetDestinationProviders(const TArray<TSharedPtr<ICloudStorageProvider>>& InProviders);
+
+		// Prefixes the task label with the plugin name, so that the uploads of different plugins packaged together can be told apart.
+		void SetIncludePluginNameInTaskLabel(bool bInIncludePluginNameInTaskLabel);
+
+		// Called when a task is skipped before it started, so that the upload does not wait for the zip file of a skipped zip task.
+		void HandleOnTaskSkipped(const IPluginBuilderTask* SkippedTask);
+
 		// IPluginBuilderTask interface.
 		virtual EState GetState() const override;
+		virtual bool CanStart() const override;
 		virtual bool HasAnyError() const override;
 		virtual FString GetTaskLabel() const override;
 		virtual void Initialize() override;
@@ -44,24 +61,120 @@ namespace PluginBuilder
 		virtual void Terminate() override;
 		virtual float GetProgress() const override;
 		virtual FString GetProgressText() const override;
+		virtual FString GetThroughputText() const override;
 		virtual bool IsCloudUploadTask() const override;
+		virtual FString GetTimingKey() const override;
+		virtual FTaskPhaseTimes GetPhaseTimes() const override;
+		virtual void GetReportMetrics(TMap<FString, double>& OutMetrics) const override;
 		// End of IPluginBuilderTask interface.
 
 	private:
-		// Starts processing the next pending file (upload or find-existing for Ignore behavior).
+		// The upload state of one destination.
+		struct FDestination
+		{
+		public:
+			// The cloud storage provider of this destination.
+			TSharedPtr<ICloudStorageProvider> Provider;
+
+			// Remote paths whose upload sessions were opened while the zip tasks were still running and have not been used yet.
+			TSet<FString> PreparedRemotePaths;
+
+			// Content hashes of local zip files keyed by local path, computed on worker threads in the format of this provider.
+			TMap<FString, TFuture<FString>> LocalContentHashes;
+
+			// Tracks local paths of files that were uploaded successfully.
+			TSet<FString> SuccessfulUploads;
+
+			// Share URLs keyed by local zip path. Only populated when bGetShareUrls is true.
+			TMap<FString, FString> ShareUrlResults;
+
+			// The reader of the current file, until it is handed to the provider or the upload is skipped.
+			TSharedPtr<FCloudStorageFileReader, ESPMode::ThreadSafe> FileReader;
+
+			// Whether the current file is still being processed for this destination.
+			bool bIsProcessing = false;
+
+			// Upload byte progress of the current file, in [0, 1].
+			float CurrentFileProgress = 0.f;
+
+			// The span of the current file in the package trace.
+			int32 FileTraceEventId = INDEX_NONE;
+		};
+
+	private:
+		// Starts processing the next pending file for every destination once its content hashes are ready.
 		void ProcessNextFile();
 
-		// Uploads a file and optionally retrieves a share URL. Called by ProcessNextFile.
-		void UploadFileNow(const FString& LocalPath, const FString& RemotePath);
+		// Starts processing the current file for a destination (upload or find-existing for Ignore behavior).
+		void ProcessFileForDestination(int32 DestinationIndex, const FString& LocalPath);
+
+		// Marks the file as done without uploading it because the remote item can be used as is.
+		void SkipUpload(int32 DestinationIndex, const FString& LocalPath, const FString& RemotePath, const FString& ExistingItemId);
+
+		// Uploads a file and optionally retrieves a share URL. Called by ProcessFileForDestination.
+		void UploadFileNow(int32 DestinationIndex, const FString& LocalPath, const FString& RemotePath);
+
+		// Retrieves the share URL of an uploaded or existing item if requested, then finishes the file for the destination.
+		void GetShareUrlAndFinish(int32 DestinationIndex, const FString& LocalPath, const FString& ItemId);
+
+		// Marks the current file as done for a destination, and moves on once every destination is done.
+		void FinishFileForDestination(int32 DestinationIndex);
 
 		// Finishes processing: logs all results and optionally writes share URLs to disk.
 		void FinalizeResults();
 
+		// Creates the destinations from the providers selected in editor preferences, if not created or set yet.
+		void ResolveDestinations();
+
+		// Returns a prefix for log messages about the specified destination, such as "[OneDrive] ".
+		FString GetLogPrefix(int32 DestinationIndex) const;
+
 		// Builds the remote file path for a given local zip file.
-		FString BuildRemotePath(const FString& LocalZipFilePath) const;
+		FString BuildRemotePath(const TSharedPtr<ICloudStorageProvider>& Provider, const FString& LocalZipFilePath) const;
 
-		// Writes the collected share URLs to Saved/PluginBuilder/ShareUrls_<timestamp>.txt.
-		void WriteShareUrlsToFile() const;
+		// Called when a zip task decides its output path, to open the upload sessions ahead of time.
+		void HandleOnZipStarted(const FString& ZipFilePath);
+
+		// Called when a zip task has written its zip file, to start hashing it while other tasks run.
+		void HandleOnZipCompleted(const FString& ZipFilePath);
+
+		// Adds the zip files of zip tasks that have completed since the last call to the files to upload.
+		void CollectCompletedZipFiles();
+
+		// Returns whether the zip files of all zip tasks have been collected.
+		bool AreAllZipTasksCollected() const;
+
+		// Returns the number of files to upload, including the ones of zip tasks that are still running.
+		int32 GetNumFilesToUpload() const;
+
+		// Adds a local file to the end of the files to upload.
+		void AddFileToUpload(const FString& LocalPath);
+
+		// Starts computing the content hashes of a local file on worker threads.
+		void StartComputingContentHash(const FString& LocalPath);
+
+		// Releases an upload session opened ahead of time that will not be used.
+		void DiscardPreparedUpload(FDestination& Destination, const FString& RemotePath);
+
+		// Returns the upload byte progress of the current file averaged over the destinations, in [0, 1].
+		float GetCurrentFileProgress() const;
+
+		// Returns the estimated number of seconds until all files are uploaded, or a negative value if unknown.
+		// The estimate uses the measured upload speed, capped by the current upload bandwidth limit.
+		double GetEstimatedRemainingTime() const;
+
+		// Marks the current file as finished for the purpose of byte-based progress.
+		void AdvanceToNextFile();
+
+		// Returns a short human readable form of a byte count, such as "12.3 MB".
+		static FString FormatBytes(int64 NumBytes);
+
+		// Returns a short human readable form of a duration, such as "1m 05s".
+		static FString FormatDuration(double Seconds);
+
+		// Writes the share URLs collected for a destination to Saved/PluginBuilder/ShareUrls_[<Provider>_]<timestamp>.txt.
+		// The provider name is only included when uploading to more than one destination.
+		void WriteShareUrlsToFile(const FDestination& Destination) const;
 
 	private:
 		// References to completed zip tasks (used to read their zip file paths).
@@ -70,6 +183,9 @@ namespace PluginBuilder
 		// Resolved local file paths to upload.
 		TArray<FString> ZipFilePaths;
 
+		// The zip tasks whose zip files have already been added to ZipFilePaths or skipped because they failed.
+		TSet<const FZipUpPluginTask*> CollectedZipTasks;
+
 		// The PackagedPlugins directory path used to compute relative remote paths.
 		FString PackagedPluginsPath;
 
@@ -79,28 +195,47 @@ namespace PluginBuilder
 		// Whether to retrieve a share URL for each uploaded file.
 		bool bGetShareUrls;
 
+		// Whether the task label is prefixed with the plugin name.
+		bool bIncludePluginNameInTaskLabel;
+
 		// Current task state.
 		EState State;
 
 		// Whether any file upload or URL retrieval failed.
 		bool bHasAnyError;
 
-		// Whether an HTTP request is currently in flight.
-		bool bHttpRequestPending;
+		// Whether the current file is being processed by any destination.
+		bool bIsFileInProgress;
 
 		// Index of the file currently being processed.
 		int32 CurrentFileIndex;
 
-		// Upload byte progress for the current file, in [0, 1].
-		float CurrentFileProgress;
+		// The sizes of the files to upload in bytes, in the same order as ZipFilePaths.
+		TArray<int64> FileSizes;
+
+		// The total size of all files to upload in bytes.
+		int64 TotalBytes;
+
+		// The total size of the files that have already been processed in bytes.
+		int64 ProcessedBytes;
+
+		// The number of bytes actually sent to the providers averaged over the destinations, excluding skipped files.
+		int64 TransferredBytes;
+
+		// The total number of bytes uploaded to all destinations, and the number of uploads skipped because the remote file could be used as is.
+		int64 UploadedBytes;
+		int32 NumSkippedUploads;
+
+		// The time at which the first byte was sent, used to measure upload speed.
+		TOptional<double> TransferStartTime;
 
-		// Tracks local paths of files that were uploaded successfully.
-		TSet<FString> SuccessfulUploads;
+		// The seconds spent processing files so far, excluding the time spent waiting for zip tasks, used to record how long the task took.
+		double FileProcessingTime;
 
-		// Share URLs keyed by local zip path. Only populated when bGetShareUrls is true.
-		TMap<FString, FString> ShareUrlResults;
+		// The time at which processing of the current file started.
+		TOptional<double> FileProcessingStartTime;
 
-		// The cloud storage provider used for this task.
-		TSharedPtr<ICloudStorageProvider> Provider;
+		// The destinations that files are uploaded to.
+		TArray<FDestination> Destinations;
 	};
 }
@@ -1,10 +1,12 @@
 // Copyright 2022-2026 Naotsun. All Rights Reserved.
 
 #include "PluginBuilder/Tasks/ZipUpPluginTask.h"
+#include "PluginBuilder/Utilities/PackageTrace.h"
 #include "PluginBuilder/PluginBuilderGlobals.h"
 #include "HAL/PlatformFileManager.h"
 #include "HAL/PlatformFile.h"
 #include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 namespace PluginBuilder
 {
@@ -16,6 +18,8 @@ namespace PluginBuilder
 	)
 		: IUATBatchFileTask(InEngineVersion, InUATBatchFileParams, DependentTask)
 		, ZipUpPluginParams(InZipUpPluginParams)
+		, StagedBytes(0)
+		, ZippedBytes(0)
 	{
 	}
 	
@@ -30,7 +34,13 @@ namespace PluginBuilder
 			}
 		}
 		
+		TRACE_CPUPROFILER_EVENT_SCOPE(FZipUpPluginTask_Initialize);
+		
 		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		// Staging copies the whole build output on the game thread, so it is traced apart from the compression done by UAT.
+		FPackageTrace& Trace = FPackageTrace::Get();
+		const int32 StagingTraceEventId = Trace.BeginEvent(Trace.GetTrackId(GetTraceTrackName()), TEXT("Staging copy"), TEXT("Zip"));
 		
 		if (ZipUpPluginParams.bKeepUPluginProperties)
 		{
@@ -64,6 +74,20 @@ namespace PluginBuilder
 			const FString DirectoryPathToDelete = ZipTempDirectoryPath / DirectoryNameToDelete;
 			PlatformFile.DeleteDirectoryRecursively(*DirectoryPathToDelete);
 		}
+
+		StagedBytes = 0;
+		PlatformFile.IterateDirectoryStatRecursively(
+			*ZipTempDirectoryPath,
+			[this](const TCHAR* /* FilenameOrDirectory */, const FFileStatData& StatData) -> bool
+			{
+				if (!StatData.bIsDirectory && (StatData.FileSize > 0))
+				{
+					StagedBytes += StatData.FileSize;
+				}
+				return true;
+			}
+		);
+		Trace.EndEvent(StagingTraceEventId, { { TEXT("bytes"), static_cast<double>(StagedBytes) } });
 		
 		const FString PluginDisplayName = (
 			ZipUpPluginParams.bOutputAllZipFilesToSingleFolder ?
@@ -107,6 +131,8 @@ namespace PluginBuilder
 		{
 			UE_LOG(LogPluginBuilder, Warning, TEXT("When submitting to Fab, if the zip files for each engine version have the same name, the person in charge may ask you to resubmit it, saying, ``Please make sure that the engine version can be determined from the file name.''"));
 		}
+
+		OnZipStarted.ExecuteIfBound(ZipFilePath);
 		
 		IUATBatchFileTask::Initialize();
 	}
@@ -115,6 +141,12 @@ namespace PluginBuilder
 	{
 		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 		PlatformFile.DeleteDirectoryRecursively(*GetZipTempDirectoryPath());
+
+		if (!bHasAnyError && !ZipFilePath.IsEmpty())
+		{
+			ZippedBytes = FMath::Max<int64>(PlatformFile.FileSize(*ZipFilePath), 0);
+			OnZipCompleted.ExecuteIfBound(ZipFilePath);
+		}
 		
 		IUATBatchFileTask::Terminate();
 	}
@@ -134,6 +166,23 @@ namespace PluginBuilder
 		return GetPackagedPluginDestinationPath();
 	}
 
+	FString FZipUpPluginTask::GetTimingKey() const
+	{
+		return FString::Printf(TEXT("Zip|%s|%s"), *UATBatchFileParams.PluginName, *EngineVersion);
+	}
+
+	void FZipUpPluginTask::GetReportMetrics(TMap<FString, double>& OutMetrics) const
+	{
+		IUATBatchFileTask::GetReportMetrics(OutMetrics);
+
+		OutMetrics.Add(TEXT("stagedBytes"), StagedBytes);
+		OutMetrics.Add(TEXT("zippedBytes"), ZippedBytes);
+		if ((StagedBytes > 0) && (ZippedBytes > 0))
+		{
+			OutMetrics.Add(TEXT("compressionRatio"), static_cast<double>(ZippedBytes) / static_cast<double>(StagedBytes));
+		}
+	}
+
 	const FString& FZipUpPluginTask::GetZipFilePath() const
 	{
 		return ZipFilePath;
@@ -23,6 +23,8 @@ namespace PluginBuilder
 		
 		// IPluginBuilderTask interface.
 		virtual bool IsZipTask() const override { return true; }
+		virtual FString GetTimingKey() const override;
+		virtual void GetReportMetrics(TMap<FString, double>& OutMetrics) const override;
 		// End of IPluginBuilderTask interface.
 
 		// IUATBatchFileTask interface.
@@ -30,11 +32,20 @@ namespace PluginBuilder
 		virtual void Terminate() override;
 		virtual TArray<FString> GetUATArguments() const override;
 		virtual FString GetDestinationDirectoryPath() const override;
+		virtual ETaskPhase GetCurrentTaskPhase() const override { return ETaskPhase::Zip; }
 		// End of IUATBatchFileTask interface.
 
 		// Returns the path of the output zip file (valid after Initialize has been called).
 		const FString& GetZipFilePath() const;
 
+		// Called when the output zip file path has been decided and compression is about to start.
+		DECLARE_DELEGATE_OneParam(FOnZipStarted, const FString& /* ZipFilePath */);
+		FOnZipStarted OnZipStarted;
+
+		// Called when the output zip file has been written successfully.
+		DECLARE_DELEGATE_OneParam(FOnZipCompleted, const FString& /* ZipFilePath */);
+		FOnZipCompleted OnZipCompleted;
+
 	private:
 		// Returns the path of the working directory where files are removed for compression.
 		FString GetZipTempDirectoryPath() const;
@@ -50,5 +61,9 @@ namespace PluginBuilder
 
 		// The path of the output compressed file.
 		FString ZipFilePath;
+
+		// The total size of the files staged for compression, and the size of the output zip file, in bytes.
+		int64 StagedBytes;
+		int64 ZippedBytes;
 	};
 }
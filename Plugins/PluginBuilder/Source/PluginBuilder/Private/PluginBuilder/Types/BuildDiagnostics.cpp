@@ -0,0 +1,79 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Types/BuildDiagnostics.h"
+
+namespace PluginBuilder
+{
+	bool FBuildDiagnostic::IsError() const
+	{
+		return (Severity == EBuildDiagnosticSeverity::Error);
+	}
+
+	FString FBuildDiagnostic::ToString() const
+	{
+		FString Result;
+		if (!FilePath.IsEmpty())
+		{
+			Result += FilePath;
+			if (Line > 0)
+			{
+				Result += (Column > 0 ? FString::Printf(TEXT("(%d,%d)"), Line, Column) : FString::Printf(TEXT("(%d)"), Line));
+			}
+			Result += TEXT(": ");
+		}
+
+		Result += LexToString(Severity);
+		if (!Code.IsEmpty())
+		{
+			Result += TEXT(" ");
+			Result += Code;
+		}
+		Result += TEXT(": ");
+		Result += Message;
+
+		return Result;
+	}
+
+	int32 FBuildDiagnostics::GetNum(const EBuildDiagnosticSeverity Severity) const
+	{
+		int32 Num = 0;
+		for (const FBuildDiagnostic& Entry : Entries)
+		{
+			if (Entry.Severity == Severity)
+			{
+				Num++;
+			}
+		}
+		return Num;
+	}
+
+	const TCHAR* LexToString(const EBuildDiagnosticSeverity Value)
+	{
+		switch (Value)
+		{
+		case EBuildDiagnosticSeverity::Warning:
+			return TEXT("warning");
+
+		default:
+			return TEXT("error");
+		}
+	}
+
+	const TCHAR* LexToString(const EBuildDiagnosticSource Value)
+	{
+		switch (Value)
+		{
+		case EBuildDiagnosticSource::Linker:
+			return TEXT("Linker");
+
+		case EBuildDiagnosticSource::UnrealHeaderTool:
+			return TEXT("UnrealHeaderTool");
+
+		case EBuildDiagnosticSource::AutomationTool:
+			return TEXT("AutomationTool");
+
+		default:
+			return TEXT("Compiler");
+		}
+	}
+}
@@ -9,29 +9,31 @@
 
 namespace PluginBuilder
 {
-	FBuildTargets::FBuildTarget::FBuildTarget(const TSharedRef<IPlugin>& Plugin)
+	FBuildTargets::FBuildTarget::FBuildTarget(const IPlugin& Plugin)
 	{
-		const FPluginDescriptor& Descriptor = Plugin->GetDescriptor();
-		PluginName = Plugin->GetName();
+		const FPluginDescriptor& Descriptor = Plugin.GetDescriptor();
+		PluginName = Plugin.GetName();
 		PluginFriendlyName = Descriptor.FriendlyName;
 		PluginDescription = Descriptor.Description;
 		PluginCategory = Descriptor.Category;
 		PluginVersionName = Descriptor.VersionName;
 		bCanPluginContainContent = Descriptor.bCanContainContent;
-		UPluginFile = FPaths::ConvertRelativePathToFull(Plugin->GetDescriptorFileName());
+		UPluginFile = FPaths::ConvertRelativePathToFull(Plugin.GetDescriptorFileName());
+		bIsPluginEnabled = Plugin.IsEnabled();
+		bIsEnginePlugin = (Plugin.GetLoadedFrom() == EPluginLoadedFrom::Engine);
 	}
 
-	FString FBuildTargets::FBuildTarget::GetPluginName() const
+	const FString& FBuildTargets::FBuildTarget::GetPluginName() const
 	{
 		return PluginName;
 	}
 
-	FString FBuildTargets::FBuildTarget::GetPluginFriendlyName() const
+	const FString& FBuildTargets::FBuildTarget::GetPluginFriendlyName() const
 	{
 		return PluginFriendlyName;
 	}
 
-	FString FBuildTargets::FBuildTarget::GetPluginNameInSpecifiedFormat() const
+	const FString& FBuildTargets::FBuildTarget::GetPluginNameInSpecifiedFormat() const
 	{
 		const auto& Settings = GetSettings<UPluginBuilderEditorSettings>();
 		return (
@@ -41,25 +43,22 @@ namespace PluginBuilder
 		);
 	}
 
-	FString FBuildTargets::FBuildTarget::GetPluginDescription() const
+	const FString& FBuildTargets::FBuildTarget::GetPluginDescription() const
 	{
 		return PluginDescription;
 	}
 
-	FString FBuildTargets::FBuildTarget::GetPluginCategory() const
+	const FString& FBuildTargets::FBuildTarget::GetPluginCategory() const
 	{
 		return PluginCategory;
 	}
 
 	FSlateIcon FBuildTargets::FBuildTarget::GetPluginIcon() const
 	{
-		return FSlateIcon(
-			FPluginBuilderStyle::Get().GetStyleSetName(),
-			FPluginBuilderStyle::GetPropertyName(PluginName)
-		);
+		return FPluginBuilderStyle::GetPluginIcon(PluginName, FPaths::GetPath(UPluginFile));
 	}
 
-	FString FBuildTargets::FBuildTarget::GetPluginVersionName() const
+	const FString& FBuildTargets::FBuildTarget::GetPluginVersionName() const
 	{
 		return PluginVersionName;
 	}
@@ -69,43 +68,64 @@ namespace PluginBuilder
 		return bCanPluginContainContent;
 	}
 
-	FString FBuildTargets::FBuildTarget::GetUPluginFile() const
+	const FString& FBuildTargets::FBuildTarget::GetUPluginFile() const
 	{
 		return UPluginFile;
 	}
-	
-	TArray<FBuildTargets::FBuildTarget> FBuildTargets::GetFilteredBuildTargets()
+
+	void FBuildTargets::Register()
 	{
-		const auto& Settings = GetSettings<UPluginBuilderEditorSettings>();
-		
-		TArray<FBuildTarget> FilteredPlugins;
+		IPluginManager& PluginManager = IPluginManager::Get();
+		OnNewPluginMountedHandle = PluginManager.OnNewPluginMounted().AddStatic(&FBuildTargets::HandleOnPluginMounted);
+#if UE_5_01_OR_LATER
+		OnPluginEditedHandle = PluginManager.OnPluginEdited().AddStatic(&FBuildTargets::HandleOnPluginMounted);
+		OnPluginUnmountedHandle = PluginManager.OnPluginUnmounted().AddStatic(&FBuildTargets::HandleOnPluginUnmounted);
+#endif
+	}
+
+	void FBuildTargets::Unregister()
+	{
+		IPluginManager& PluginManager = IPluginManager::Get();
+		PluginManager.OnNewPluginMounted().Remove(OnNewPluginMountedHandle);
+#if UE_5_01_OR_LATER
+		PluginManager.OnPluginEdited().Remove(OnPluginEditedHandle);
+		PluginManager.OnPluginUnmounted().Remove(OnPluginUnmountedHandle);
+#endif
+
+		DiscoveredBuildTargets.Empty();
+		FilteredBuildTargets.Empty();
+		FilteredIndicesByName.Empty();
+		FilteredIndicesByFriendlyName.Empty();
+		bHasDiscoveredPlugins = false;
+		bIsFilteredListDirty = true;
+	}
 	
-		const TArray<TSharedRef<IPlugin>> Plugins = IPluginManager::Get().GetDiscoveredPlugins();
-		for (const auto& Plugin : Plugins)
+	const TArray<FBuildTargets::FBuildTarget>& FBuildTargets::GetFilteredBuildTargets()
+	{
+		UpdateFilteredBuildTargets();
+		return FilteredBuildTargets;
+	}
+
+	const FBuildTargets::FBuildTarget* FBuildTargets::FindBuildTargetByName(const FString& PluginName)
+	{
+		UpdateFilteredBuildTargets();
+		if (const int32* Index = FilteredIndicesByName.Find(PluginName))
 		{
-			if (Settings.bSearchOnlyEnabled && !Plugin->IsEnabled())
-			{
-				continue;
-			}
-			
-			const EPluginLoadedFrom LoadedFrom = Plugin->GetLoadedFrom();
-			if ((!Settings.bContainsProjectPlugins && LoadedFrom == EPluginLoadedFrom::Project) ||
-				(!Settings.bContainsEnginePlugins && LoadedFrom == EPluginLoadedFrom::Engine))
-			{
-				continue;
-			}
-			
-			FilteredPlugins.Add(FBuildTarget(Plugin));
+			return &FilteredBuildTargets[*Index];
 		}
 
-		FilteredPlugins.Sort(
-			[](const FBuildTarget& Lhs, const FBuildTarget& Rhs) -> bool
-			{
-				return (Lhs.GetPluginFriendlyName() < Rhs.GetPluginFriendlyName());
-			}
-		);
+		return nullptr;
+	}
+
+	const FBuildTargets::FBuildTarget* FBuildTargets::FindBuildTargetByFriendlyName(const FString& PluginFriendlyName)
+	{
+		UpdateFilteredBuildTargets();
+		if (const int32* Index = FilteredIndicesByFriendlyName.Find(PluginFriendlyName))
+		{
+			return &FilteredBuildTargets[*Index];
+		}
 
-		return FilteredPlugins;
+		return nullptr;
 	}
 	
 	TOptional<FBuildTargets::FBuildTarget> FBuildTargets::GetDefaultBuildTarget()
@@ -133,18 +153,7 @@ namespace PluginBuilder
 
 	TOptional<FBuildTargets::FBuildTarget> FBuildTargets::LoadBuildTarget(const FString& SelectedBuildTargetName)
 	{
-		const TArray<FBuildTarget>& BuildTargets = GetFilteredBuildTargets();
-		if (BuildTargets.Num() == 0)
-		{
-			return {};
-		}
-
-		const FBuildTarget* SelectedBuildTarget = BuildTargets.FindByPredicate(
-			[&](const FBuildTarget& BuildTarget) -> bool
-			{
-				return (BuildTarget.GetPluginFriendlyName() == SelectedBuildTargetName);
-			}
-		);
+		const FBuildTarget* SelectedBuildTarget = FindBuildTargetByFriendlyName(SelectedBuildTargetName);
 		if (SelectedBuildTarget == nullptr)
 		{
 			return {};
@@ -170,4 +179,124 @@ namespace PluginBuilder
 
 		return false;
 	}
+
+	void FBuildTargets::DiscoverPlugins()
+	{
+		check(IsInGameThread());
+
+		if (bHasDiscoveredPlugins)
+		{
+			return;
+		}
+
+		const TArray<TSharedRef<IPlugin>> Plugins = IPluginManager::Get().GetDiscoveredPlugins();
+		DiscoveredBuildTargets.Reset();
+		DiscoveredBuildTargets.Reserve(Plugins.Num());
+		for (const auto& Plugin : Plugins)
+		{
+			DiscoveredBuildTargets.Add(Plugin->GetName(), FBuildTarget(*Plugin));
+		}
+
+		bHasDiscoveredPlugins = true;
+		bIsFilteredListDirty = true;
+	}
+
+	void FBuildTargets::UpdateFilteredBuildTargets()
+	{
+		DiscoverPlugins();
+
+		const uint8 FilterFlags = GetFilterFlags();
+		if (!bIsFilteredListDirty && (FilterFlags == AppliedFilterFlags))
+		{
+			return;
+		}
+		
+		const auto& Settings = GetSettings<UPluginBuilderEditorSettings>();
+
+		FilteredBuildTargets.Reset(DiscoveredBuildTargets.Num());
+		for (const auto& Pair : DiscoveredBuildTargets)
+		{
+			const FBuildTarget& BuildTarget = Pair.Value;
+			if (Settings.bSearchOnlyEnabled && !BuildTarget.bIsPluginEnabled)
+			{
+				continue;
+			}
+			
+			if ((!Settings.bContainsProjectPlugins && !BuildTarget.bIsEnginePlugin) ||
+				(!Settings.bContainsEnginePlugins && BuildTarget.bIsEnginePlugin))
+			{
+				continue;
+			}
+			
+			FilteredBuildTargets.Add(BuildTarget);
+		}
+
+		FilteredBuildTargets.Sort(
+			[](const FBuildTarget& Lhs, const FBuildTarget& Rhs) -> bool
+			{
+				return (Lhs.GetPluginFriendlyName() < Rhs.GetPluginFriendlyName());
+			}
+		);
+
+		FilteredIndicesByName.Reset();
+		FilteredIndicesByFriendlyName.Reset();
+		for (int32 Index = 0; Index < FilteredBuildTargets.Num(); Index++)
+		{
+			const FBuildTarget& BuildTarget = FilteredBuildTargets[Index];
+			FilteredIndicesByName.Add(BuildTarget.GetPluginName(), Index);
+			if (!FilteredIndicesByFriendlyName.Contains(BuildTarget.GetPluginFriendlyName()))
+			{
+				FilteredIndicesByFriendlyName.Add(BuildTarget.GetPluginFriendlyName(), Index);
+			}
+		}
+
+		bIsFilteredListDirty = false;
+		AppliedFilterFlags = FilterFlags;
+	}
+
+	uint8 FBuildTargets::GetFilterFlags()
+	{
+		const auto& Settings = GetSettings<UPluginBuilderEditorSettings>();
+		return static_cast<uint8>(
+			(Settings.bSearchOnlyEnabled ? 1 << 0 : 0) |
+			(Settings.bContainsProjectPlugins ? 1 << 1 : 0) |
+			(Settings.bContainsEnginePlugins ? 1 << 2 : 0)
+		);
+	}
+
+	void FBuildTargets::HandleOnPluginMounted(IPlugin& Plugin)
+	{
+		// Until the registry is first needed, the plugin is picked up by the full discovery.
+		if (!bHasDiscoveredPlugins)
+		{
+			return;
+		}
+
+		DiscoveredBuildTargets.Add(Plugin.GetName(), FBuildTarget(Plugin));
+		bIsFilteredListDirty = true;
+	}
+
+	void FBuildTargets::HandleOnPluginUnmounted(IPlugin& Plugin)
+	{
+		if (!bHasDiscoveredPlugins)
+		{
+			return;
+		}
+
+		if (DiscoveredBuildTargets.Remove(Plugin.GetName()) > 0)
+		{
+			bIsFilteredListDirty = true;
+		}
+	}
+
+	TMap<FString, FBuildTargets::FBuildTarget> FBuildTargets::DiscoveredBuildTargets;
+	TArray<FBuildTargets::FBuildTarget> FBuildTargets::FilteredBuildTargets;
+	TMap<FString, int32> FBuildTargets::FilteredIndicesByName;
+	TMap<FString, int32> FBuildTargets::FilteredIndicesByFriendlyName;
+	bool FBuildTargets::bHasDiscoveredPlugins = false;
+	bool FBuildTargets::bIsFilteredListDirty = true;
+	uint8 FBuildTargets::AppliedFilterFlags = 0;
+	FDelegateHandle FBuildTargets::OnNewPluginMountedHandle;
+	FDelegateHandle FBuildTargets::OnPluginEditedHandle;
+	FDelegateHandle FBuildTargets::OnPluginUnmountedHandle;
 }
@@ -11,6 +11,9 @@ namespace PluginBuilder
 {
 	/**
 	 * A class that obtains the list of build target plugin information from the plugin manager.
+	 * The discovered plugins are kept in a registry keyed by plugin name, which is updated one plugin at a time when plugins
+	 * are mounted, edited or unmounted. The filtered and sorted list and its indices by name and friendly name are only
+	 * rebuilt when the registry or the filter settings change, so that menus and lookups never walk the plugin manager.
 	 */
 	class PLUGINBUILDER_API FBuildTargets
 	{
@@ -20,36 +23,38 @@ namespace PluginBuilder
 		{
 		public:
 			// Constructor.
-			explicit FBuildTarget(const TSharedRef<IPlugin>& Plugin);
+			explicit FBuildTarget(const IPlugin& Plugin);
 
 			// Returns the name of the plugin to build.
-			FString GetPluginName() const;
+			const FString& GetPluginName() const;
 
 			// Returns the friendly name of the plugin to build.
-			FString GetPluginFriendlyName() const;
+			const FString& GetPluginFriendlyName() const;
 
 			// Returns the plugin name formatted according to the bUseFriendlyName value specified in the editor preferences.
-			FString GetPluginNameInSpecifiedFormat() const;
+			const FString& GetPluginNameInSpecifiedFormat() const;
 			
 			// Returns the description of the plugin to build.
-			FString GetPluginDescription() const;
+			const FString& GetPluginDescription() const;
 
 			// Returns the category name of the plugin to build.
-			FString GetPluginCategory() const;
+			const FString& GetPluginCategory() const;
 
 			// Returns the icon of the plugin to build.
 			FSlateIcon GetPluginIcon() const;
 
 			// Returns the version name of the plugin to build.
-			FString GetPluginVersionName() const;
+			const FString& GetPluginVersionName() const;
 
 			// Returns whether the plugin to build uses the content folder.
 			bool CanPluginContainContent() const;
 
 			// Returns the path to the .uplugin file for the plugin you want to build.
-			FString GetUPluginFile() const;
+			const FString& GetUPluginFile() const;
 		
 		private:
+			friend class FBuildTargets;
+			
 			// The name of the plugin to build.
 			FString PluginName;
 
@@ -70,11 +75,23 @@ namespace PluginBuilder
 
 			// The path to the .uplugin file for the plugin you want to build.
 			FString UPluginFile;
+
+			// Whether the plugin is enabled and whether it is an engine plugin, used to filter the build targets.
+			bool bIsPluginEnabled;
+			bool bIsEnginePlugin;
 		};
 		
 	public:
-		// Returns a filtered list of plugins based on the settings to be built.
-		static TArray<FBuildTarget> GetFilteredBuildTargets();
+		// Registers-Unregisters the events that keep the registry up to date when plugins are mounted, edited or unmounted.
+		static void Register();
+		static void Unregister();
+
+		// Returns a filtered list of plugins based on the settings to be built, sorted by friendly name.
+		static const TArray<FBuildTarget>& GetFilteredBuildTargets();
+
+		// Returns the filtered build target with the specified name or friendly name, or nullptr if there is none.
+		static const FBuildTarget* FindBuildTargetByName(const FString& PluginName);
+		static const FBuildTarget* FindBuildTargetByFriendlyName(const FString& PluginFriendlyName);
 		
 		// Returns the default build target inferred from the project name.
 		static TOptional<FBuildTarget> GetDefaultBuildTarget();
@@ -87,5 +104,43 @@ namespace PluginBuilder
 
 		// Returns whether the specified build target is selected.
 		static bool GetBuildTargetState(const FBuildTarget BuildTarget);
+
+	private:
+		// Adds all discovered plugins to the registry if it has not been filled yet.
+		static void DiscoverPlugins();
+
+		// Rebuilds the filtered list and its indices if the registry or the filter settings have changed since it was last built.
+		static void UpdateFilteredBuildTargets();
+
+		// Returns the filter settings in the editor preferences packed into bits, to detect when they change.
+		static uint8 GetFilterFlags();
+
+		// Called when a plugin is mounted, edited or unmounted.
+		static void HandleOnPluginMounted(IPlugin& Plugin);
+		static void HandleOnPluginUnmounted(IPlugin& Plugin);
+
+	private:
+		// All discovered plugins keyed by plugin name.
+		static TMap<FString, FBuildTarget> DiscoveredBuildTargets;
+
+		// The discovered plugins that pass the filter settings, sorted by friendly name.
+		static TArray<FBuildTarget> FilteredBuildTargets;
+
+		// The indices in FilteredBuildTargets keyed by plugin name and by friendly name.
+		// When plugins share a friendly name, the first one in the sorted list is found, as before.
+		static TMap<FString, int32> FilteredIndicesByName;
+		static TMap<FString, int32> FilteredIndicesByFriendlyName;
+
+		// Whether the registry has been filled, and whether the filtered list needs to be rebuilt.
+		static bool bHasDiscoveredPlugins;
+		static bool bIsFilteredListDirty;
+
+		// The filter settings the filtered list was built with.
+		static uint8 AppliedFilterFlags;
+
+		// The handles of the events of the plugin manager.
+		static FDelegateHandle OnNewPluginMountedHandle;
+		static FDelegateHandle OnPluginEditedHandle;
+		static FDelegateHandle OnPluginUnmountedHandle;
 	};
 }
@@ -5,12 +5,24 @@
 #include "PluginBuilder/PluginBuilderGlobals.h"
 #include "Misc/Paths.h"
 
+#if PLATFORM_WINDOWS
 #include "Windows/AllowWindowsPlatformTypes.h"
+#include "Windows/WindowsHWrapper.h"
 #include <winreg.h>
-
+#elif PLATFORM_LINUX
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "Modules/ModuleManager.h"
+#endif
 
 namespace PluginBuilder
 {
+#if PLATFORM_WINDOWS
 	namespace WinReg
 	{
 		static constexpr int MaxKeyNameLength = 255;
@@ -132,8 +144,345 @@ namespace PluginBuilder
 			HKEY Key;
 			bool bIsValid;
 		};
+
+		// Signals an event when the registry key of the installed engines or any of its subkeys changes.
+		class FChangeNotification
+		{
+		public:
+			~FChangeNotification()
+			{
+				if (Key != nullptr)
+				{
+					RegCloseKey(Key);
+				}
+				if (Event != nullptr)
+				{
+					CloseHandle(Event);
+				}
+			}
+
+			// Starts watching for the next change. Returns false if changes cannot be watched, such as when the key does not exist.
+			bool Arm()
+			{
+				if (Key == nullptr)
+				{
+					if (RegOpenKeyExW(HKEY_LOCAL_MACHINE, *UnrealEngineKeyPath, 0, KEY_NOTIFY, &Key) != ERROR_SUCCESS)
+					{
+						Key = nullptr;
+						return false;
+					}
+				}
+				if (Event == nullptr)
+				{
+					Event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+					if (Event == nullptr)
+					{
+						return false;
+					}
+				}
+
+				// A notification only fires once, so it is registered again each time the registry is read.
+				ResetEvent(Event);
+				const LSTATUS Result = RegNotifyChangeKeyValue(
+					Key,
+					TRUE,
+					REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET,
+					Event,
+					TRUE
+				);
+				bIsArmed = (Result == ERROR_SUCCESS);
+				return bIsArmed;
+			}
+
+			// Returns whether changes are being watched.
+			bool IsArmed() const
+			{
+				return bIsArmed;
+			}
+
+			// Returns whether the key has changed since the last call to Arm. Does not access the registry.
+			bool HasChanged() const
+			{
+				return (bIsArmed && (WaitForSingleObject(Event, 0) == WAIT_OBJECT_0));
+			}
+
+		private:
+			HKEY Key = nullptr;
+			HANDLE Event = nullptr;
+			bool bIsArmed = false;
+		};
+
+		static FChangeNotification ChangeNotification;
 	}
 
+	namespace EngineLocator
+	{
+		// The batch files in the engine directory that run UAT and UBT.
+		static const TCHAR* UATBatchFilePath = TEXT("Engine/Build/BatchFiles/RunUAT.bat");
+		static const TCHAR* UBTBatchFilePath = TEXT("Engine/Build/BatchFiles/Build.bat");
+
+		static void WatchForChanges()
+		{
+			WinReg::ChangeNotification.Arm();
+		}
+
+		static bool IsWatching()
+		{
+			return WinReg::ChangeNotification.IsArmed();
+		}
+
+		static bool HasChanged()
+		{
+			return WinReg::ChangeNotification.HasChanged();
+		}
+	}
+#elif PLATFORM_LINUX
+	namespace LinuxInstallations
+	{
+		// Returns the path of Install.ini, where UnrealVersionSelector registers the source builds as Identifier=Directory.
+		static FString GetInstallIniFile()
+		{
+			return FPaths::Combine(FPlatformProcess::ApplicationSettingsDir(), TEXT("UnrealEngine"), TEXT("Install.ini"));
+		}
+
+		// Returns the path of the manifest where the launcher lists the binary installs.
+		static FString GetLauncherManifestFile()
+		{
+			return FPaths::Combine(FPlatformProcess::ApplicationSettingsDir(), TEXT("UnrealEngineLauncher"), TEXT("LauncherInstalled.dat"));
+		}
+
+		// Returns whether the string is a version name such as "5.4".
+		static bool IsVersionName(const FString& String)
+		{
+			FString MajorVersionString;
+			FString MinorVersionString;
+			return (
+				String.Split(TEXT("."), &MajorVersionString, &MinorVersionString) &&
+				!MajorVersionString.IsEmpty() && FCString::IsNumeric(*MajorVersionString) &&
+				!MinorVersionString.IsEmpty() && FCString::IsNumeric(*MinorVersionString)
+			);
+		}
+
+		// Reads the version name such as "5.4" from Engine/Build/Build.version of the engine.
+		static bool ReadVersionName(const FString& InstalledDirectory, FString& VersionName)
+		{
+			FString JsonString;
+			if (!FFileHelper::LoadFileToString(JsonString, *FPaths::Combine(InstalledDirectory, TEXT("Engine"), TEXT("Build"), TEXT("Build.version"))))
+			{
+				return false;
+			}
+
+			TSharedPtr<FJsonObject> JsonObject;
+			if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonObject) || !JsonObject.IsValid())
+			{
+				return false;
+			}
+
+			int32 MajorVersion = 0;
+			int32 MinorVersion = 0;
+			if (!JsonObject->TryGetNumberField(TEXT("MajorVersion"), MajorVersion) || !JsonObject->TryGetNumberField(TEXT("MinorVersion"), MinorVersion))
+			{
+				return false;
+			}
+
+			VersionName = FString::Printf(TEXT("%d.%d"), MajorVersion, MinorVersion);
+			return true;
+		}
+
+		// Adds the binary installs listed in the launcher manifest, whose app names are like "UE_5.4".
+		static void AddLauncherInstallations(TMap<FString, FString>& Installations)
+		{
+			FString JsonString;
+			if (!FFileHelper::LoadFileToString(JsonString, *GetLauncherManifestFile()))
+			{
+				return;
+			}
+
+			TSharedPtr<FJsonObject> JsonObject;
+			if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonObject) || !JsonObject.IsValid())
+			{
+				UE_LOG(LogPluginBuilder, Warning, TEXT("Failed to parse the launcher manifest: %s"), *GetLauncherManifestFile());
+				return;
+			}
+
+			const TArray<TSharedPtr<FJsonValue>>* InstallationList = nullptr;
+			if (!JsonObject->TryGetArrayField(TEXT("InstallationList"), InstallationList))
+			{
+				return;
+			}
+
+			for (const auto& InstallationValue : *InstallationList)
+			{
+				const TSharedPtr<FJsonObject>* Installation = nullptr;
+				if (!InstallationValue.IsValid() || !InstallationValue->TryGetObject(Installation))
+				{
+					continue;
+				}
+
+				FString AppName;
+				FString InstallLocation;
+				if (!(*Installation)->TryGetStringField(TEXT("AppName"), AppName) || !(*Installation)->TryGetStringField(TEXT("InstallLocation"), InstallLocation))
+				{
+					continue;
+				}
+
+				FString VersionName;
+				if (!AppName.Split(TEXT("UE_"), nullptr, &VersionName, ESearchCase::CaseSensitive) || !IsVersionName(VersionName))
+				{
+					continue;
+				}
+
+				Installations.Add(VersionName, InstallLocation);
+			}
+		}
+
+		// Adds the source builds registered in Install.ini. A build is named by its version unless a launcher install
+		// of the same version exists, in which case it keeps its identifier, which is usually a GUID.
+		static void AddRegisteredInstallations(TMap<FString, FString>& Installations)
+		{
+			FString IniString;
+			if (!FFileHelper::LoadFileToString(IniString, *GetInstallIniFile()))
+			{
+				return;
+			}
+
+			TArray<FString> Lines;
+			IniString.ParseIntoArrayLines(Lines);
+
+			bool bIsInInstallationsSection = false;
+			for (const auto& Line : Lines)
+			{
+				const FString TrimmedLine = Line.TrimStartAndEnd();
+				if (TrimmedLine.IsEmpty() || TrimmedLine.StartsWith(TEXT(";")))
+				{
+					continue;
+				}
+				if (TrimmedLine.StartsWith(TEXT("[")))
+				{
+					bIsInInstallationsSection = TrimmedLine.Equals(TEXT("[Installations]"), ESearchCase::IgnoreCase);
+					continue;
+				}
+
+				FString Identifier;
+				FString InstalledDirectory;
+				if (!bIsInInstallationsSection || !TrimmedLine.Split(TEXT("="), &Identifier, &InstalledDirectory))
+				{
+					continue;
+				}
+				Identifier.TrimStartAndEndInline();
+				InstalledDirectory.TrimStartAndEndInline();
+				InstalledDirectory.TrimQuotesInline();
+				if (Identifier.IsEmpty() || !FPaths::DirectoryExists(InstalledDirectory))
+				{
+					continue;
+				}
+
+				FString VersionName = Identifier;
+				if (!IsVersionName(VersionName))
+				{
+					FString BuildVersionName;
+					if (ReadVersionName(InstalledDirectory, BuildVersionName) && !Installations.Contains(BuildVersionName))
+					{
+						VersionName = BuildVersionName;
+					}
+				}
+
+				if (!Installations.Contains(VersionName))
+				{
+					Installations.Add(VersionName, InstalledDirectory);
+				}
+			}
+		}
+	}
+
+	namespace EngineLocator
+	{
+		// The scripts in the engine directory that run UAT and UBT.
+		static const TCHAR* UATBatchFilePath = TEXT("Engine/Build/BatchFiles/RunUAT.sh");
+		static const TCHAR* UBTBatchFilePath = TEXT("Engine/Build/BatchFiles/Linux/Build.sh");
+
+		// Whether Install.ini or the launcher manifest has changed since the last call to WatchForChanges.
+		static bool bHasChanged = false;
+
+		// The directories of Install.ini and the launcher manifest that a callback has been registered for.
+		static TSet<FString> WatchedDirectoryPaths;
+
+		// Whether the directories of Install.ini and the launcher manifest are both watched.
+		static bool bIsWatching = false;
+
+		static void HandleOnDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
+		{
+			for (const FFileChangeData& FileChange : FileChanges)
+			{
+				if (FPaths::IsSamePath(FileChange.Filename, LinuxInstallations::GetInstallIniFile()) ||
+					FPaths::IsSamePath(FileChange.Filename, LinuxInstallations::GetLauncherManifestFile()))
+				{
+					bHasChanged = true;
+				}
+			}
+		}
+
+		// Watches the directories of Install.ini and the launcher manifest, the counterpart of the registry notification on Windows.
+		// The directory watcher is only ticked by the editor, and a directory that does not exist cannot be watched,
+		// in which cases the engine versions are read again after UnwatchedRefreshInterval instead.
+		static void WatchForChanges()
+		{
+			bHasChanged = false;
+			if (bIsWatching || IsRunningCommandlet())
+			{
+				return;
+			}
+
+			FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+			IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get();
+			if (DirectoryWatcher == nullptr)
+			{
+				return;
+			}
+
+			const FString InstallIniDirectoryPath = FPaths::GetPath(LinuxInstallations::GetInstallIniFile());
+			const FString LauncherManifestDirectoryPath = FPaths::GetPath(LinuxInstallations::GetLauncherManifestFile());
+
+			// The directory of Install.ini also holds the saved configs of each engine version, so changes in subdirectories are ignored.
+			// A directory that is already watched is skipped, so that a retry after one of them failed does not register its callback twice.
+			bIsWatching = true;
+			for (const FString& DirectoryPath : { InstallIniDirectoryPath, LauncherManifestDirectoryPath })
+			{
+				if (WatchedDirectoryPaths.Contains(DirectoryPath))
+				{
+					continue;
+				}
+
+				FDelegateHandle DelegateHandle;
+				if (FPaths::DirectoryExists(DirectoryPath) &&
+					DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+						DirectoryPath,
+						IDirectoryWatcher::FDirectoryChanged::CreateStatic(&HandleOnDirectoryChanged),
+						DelegateHandle,
+						IDirectoryWatcher::WatchOptions::IgnoreChangesInSubtree
+					))
+				{
+					WatchedDirectoryPaths.Add(DirectoryPath);
+				}
+				else
+				{
+					bIsWatching = false;
+				}
+			}
+		}
+
+		static bool IsWatching()
+		{
+			return bIsWatching;
+		}
+
+		static bool HasChanged()
+		{
+			return bHasChanged;
+		}
+	}
+#endif
+
 	struct FCompareEngineVersionString
 	{
 		FORCEINLINE bool operator()(const FString& Lhs, const FString& Rhs) const
@@ -144,44 +493,44 @@ namespace PluginBuilder
 		}
 	};
 	
-	TArray<FEngineVersions::FEngineVersion> FEngineVersions::GetEngineVersions(const bool bWithRefresh /* = true */)
+	const TArray<FEngineVersions::FEngineVersion>& FEngineVersions::GetEngineVersions(const bool bWithRefresh /* = false */)
 	{
 		if (bWithRefresh)
 		{
 			RefreshEngineVersions();
 		}
+		else
+		{
+			RefreshEngineVersionsIfChanged();
+		}
 		
 		return EngineVersions;
 	}
 
 	void FEngineVersions::RefreshEngineVersions()
 	{
-		const TArray<FString>& VersionNames = GetVersionNames();
-		EngineVersions.Reset(VersionNames.Num());
-		for (const auto& VersionName : VersionNames)
+		check(IsInGameThread());
+
+		// Watched before reading, so that a change made while reading is not missed.
+		EngineLocator::WatchForChanges();
+		bHasReadEngineVersions = true;
+		LastReadTime = FPlatformTime::Seconds();
+
+		const TArray<TPair<FString, FString>>& InstalledEngines = EnumerateInstalledEngines();
+		EngineVersions.Reset(InstalledEngines.Num());
+		EngineVersionIndices.Reset();
+		VersionNames.Reset(InstalledEngines.Num());
+		MajorVersionNames.Reset();
+		for (const auto& InstalledEngine : InstalledEngines)
 		{
-			const FString InstalledDirectoryKeyPath = (WinReg::UnrealEngineKeyPath + TEXT('\\') + VersionName);
-			const WinReg::FScopedKey InstalledDirectoryKey(HKEY_LOCAL_MACHINE, *InstalledDirectoryKeyPath);
-			if (!InstalledDirectoryKey.IsValid())
-			{
-				continue;
-			}
-
-			FString InstalledDirectory;
-			if (!InstalledDirectoryKey.GetStringValue(TEXT("InstalledDirectory"), InstalledDirectory))
-			{
-				continue;
-			}
+			FString InstalledDirectory = InstalledEngine.Value;
 			InstalledDirectory.ReplaceInline(TEXT("\\"), TEXT("/"));
 
-			const FString UATBatchFile = FPaths::Combine(
-				*InstalledDirectory, TEXT("Engine"), TEXT("Build"), TEXT("BatchFiles"), TEXT("RunUAT.bat")
-			);
-
 			FEngineVersion EngineVersion;
-			EngineVersion.VersionName = VersionName;
+			EngineVersion.VersionName = InstalledEngine.Key;
 			EngineVersion.InstalledDirectory = InstalledDirectory;
-			EngineVersion.UATBatchFile = UATBatchFile;
+			EngineVersion.UATBatchFile = FPaths::Combine(InstalledDirectory, EngineLocator::UATBatchFilePath);
+			EngineVersion.UBTBatchFile = FPaths::Combine(InstalledDirectory, EngineLocator::UBTBatchFilePath);
 			EngineVersion.MajorVersionName = TEXT("Custom");
 			{
 				int32 MajorVersion = INDEX_NONE;
@@ -200,12 +549,35 @@ namespace PluginBuilder
 					EngineVersion.MajorVersionName = FString::Printf(TEXT("UE%d"), MajorVersion);
 				}
 			}
-			EngineVersions.Add(EngineVersion);
+			EngineVersionIndices.Add(EngineVersion.VersionName, EngineVersions.Add(EngineVersion));
+			VersionNames.Add(EngineVersion.VersionName);
+			MajorVersionNames.AddUnique(EngineVersion.MajorVersionName);
 		}
 	}
 
-	TArray<FString> FEngineVersions::GetVersionNames()
+	void FEngineVersions::RefreshEngineVersionsIfChanged()
 	{
+		if (!bHasReadEngineVersions || EngineLocator::HasChanged())
+		{
+			RefreshEngineVersions();
+		}
+		else if (!EngineLocator::IsWatching() && ((FPlatformTime::Seconds() - LastReadTime) >= UnwatchedRefreshInterval))
+		{
+			RefreshEngineVersions();
+		}
+	}
+
+	const TArray<FString>& FEngineVersions::GetVersionNames()
+	{
+		RefreshEngineVersionsIfChanged();
+		return VersionNames;
+	}
+
+	TArray<TPair<FString, FString>> FEngineVersions::EnumerateInstalledEngines()
+	{
+		TArray<TPair<FString, FString>> InstalledEngines;
+
+#if PLATFORM_WINDOWS
 		const WinReg::FScopedKey UnrealEngineKey(HKEY_LOCAL_MACHINE, *WinReg::UnrealEngineKeyPath);
 		if (!UnrealEngineKey.IsValid())
 		{
@@ -218,43 +590,81 @@ namespace PluginBuilder
 			return {};
 		}
 
-		TArray<FString> UnrealEngineVersions;
-		UnrealEngineVersions.Reserve(NumOfSubKeys);
+		InstalledEngines.Reserve(NumOfSubKeys);
 		for (DWORD Index = 0; Index < NumOfSubKeys; Index++)
 		{
 			FString SubKeyName;
-			if (UnrealEngineKey.GetSubKeyName(Index, SubKeyName))
+			if (!UnrealEngineKey.GetSubKeyName(Index, SubKeyName))
 			{
-				UnrealEngineVersions.Add(SubKeyName);
+				continue;
+			}
+
+			const FString InstalledDirectoryKeyPath = (WinReg::UnrealEngineKeyPath + TEXT('\\') + SubKeyName);
+			const WinReg::FScopedKey InstalledDirectoryKey(HKEY_LOCAL_MACHINE, *InstalledDirectoryKeyPath);
+			if (!InstalledDirectoryKey.IsValid())
+			{
+				continue;
+			}
+
+			FString InstalledDirectory;
+			if (InstalledDirectoryKey.GetStringValue(TEXT("InstalledDirectory"), InstalledDirectory))
+			{
+				InstalledEngines.Emplace(SubKeyName, InstalledDirectory);
 			}
 		}
+#elif PLATFORM_LINUX
+		// The launcher installs are added first, so that they keep the plain version names.
+		TMap<FString, FString> Installations;
+		LinuxInstallations::AddLauncherInstallations(Installations);
+		LinuxInstallations::AddRegisteredInstallations(Installations);
+
+		InstalledEngines.Reserve(Installations.Num());
+		for (const auto& Installation : Installations)
+		{
+			InstalledEngines.Emplace(Installation.Key, Installation.Value);
+		}
+#endif
 
-		UnrealEngineVersions.Sort(
-			[](const FString& Lhs, const FString& Rhs) -> bool
+		InstalledEngines.Sort(
+			[](const TPair<FString, FString>& Lhs, const TPair<FString, FString>& Rhs) -> bool
 			{
-				const float LhsValue = FCString::Atof(*Lhs);
-				const float RhsValue = FCString::Atof(*Rhs);
+				const float LhsValue = FCString::Atof(*Lhs.Key);
+				const float RhsValue = FCString::Atof(*Rhs.Key);
 				return (LhsValue < RhsValue);
 			}
 		);
 
-		return UnrealEngineVersions;
+		return InstalledEngines;
 	}
 
-	bool FEngineVersions::FindUATBatchFileByVersionName(const FString& VersionName, FString& UATBatchFile, const bool bWithRefresh /* = true */)
+	const FEngineVersions::FEngineVersion* FEngineVersions::FindEngineVersion(const FString& VersionName, const bool bWithRefresh /* = false */)
 	{
-		if (bWithRefresh)
+		const TArray<FEngineVersion>& CurrentEngineVersions = GetEngineVersions(bWithRefresh);
+		if (const int32* Index = EngineVersionIndices.Find(VersionName))
 		{
-			RefreshEngineVersions();
+			return &CurrentEngineVersions[*Index];
 		}
-		
-		for (const auto& EngineVersion : EngineVersions)
+
+		return nullptr;
+	}
+
+	bool FEngineVersions::FindUATBatchFileByVersionName(const FString& VersionName, FString& UATBatchFile, const bool bWithRefresh /* = false */)
+	{
+		if (const FEngineVersion* EngineVersion = FindEngineVersion(VersionName, bWithRefresh))
 		{
-			if (EngineVersion.VersionName.Equals(VersionName))
-			{
-				UATBatchFile = EngineVersion.UATBatchFile;
-				return true;
-			}
+			UATBatchFile = EngineVersion->UATBatchFile;
+			return true;
+		}
+
+		return false;
+	}
+
+	bool FEngineVersions::FindUBTBatchFileByVersionName(const FString& VersionName, FString& UBTBatchFile, const bool bWithRefresh /* = false */)
+	{
+		if (const FEngineVersion* EngineVersion = FindEngineVersion(VersionName, bWithRefresh))
+		{
+			UBTBatchFile = EngineVersion->UBTBatchFile;
+			return true;
 		}
 
 		return false;
@@ -271,24 +681,9 @@ namespace PluginBuilder
 		}
 	}
 
-	TArray<FString> FEngineVersions::GetMajorVersionNames(const bool bWithRefresh /* = true */)
+	const TArray<FString>& FEngineVersions::GetMajorVersionNames(const bool bWithRefresh /* = false */)
 	{
-		if (bWithRefresh)
-		{
-			RefreshEngineVersions();
-		}
-
-		TArray<FString> MajorVersionNames;
-		for (const auto& EngineVersion : EngineVersions)
-		{
-			if (MajorVersionNames.Contains(EngineVersion.MajorVersionName))
-			{
-				continue;
-			}
-
-			MajorVersionNames.Add(EngineVersion.MajorVersionName);
-		}
-
+		GetEngineVersions(bWithRefresh);
 		return MajorVersionNames;
 	}
 
@@ -353,7 +748,7 @@ namespace PluginBuilder
 		auto& Settings = GetSettings<UPluginBuilderPackagingSettings>();
 		Settings.EngineVersions.Empty();
 		const int32 NumOfEngineVersions = EngineVersions.Num();
-		for (int32 Index = NumOfEngineVersions - 3; Index < NumOfEngineVersions; Index++)
+		for (int32 Index = FMath::Max(NumOfEngineVersions - 3, 0); Index < NumOfEngineVersions; Index++)
 		{
 			Settings.EngineVersions.Add(EngineVersions[Index].VersionName);
 		}
@@ -362,6 +757,13 @@ namespace PluginBuilder
 	}
 
 	TArray<FEngineVersions::FEngineVersion> FEngineVersions::EngineVersions;
+	TMap<FString, int32> FEngineVersions::EngineVersionIndices;
+	TArray<FString> FEngineVersions::VersionNames;
+	TArray<FString> FEngineVersions::MajorVersionNames;
+	bool FEngineVersions::bHasReadEngineVersions = false;
+	double FEngineVersions::LastReadTime = 0.0;
 }
 
+#if PLATFORM_WINDOWS
 #include "Windows/HideWindowsPlatformTypes.h"
+#endif
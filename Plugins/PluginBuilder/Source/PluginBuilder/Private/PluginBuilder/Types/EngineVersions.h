@@ -7,12 +7,16 @@
 namespace PluginBuilder
 {
 	/**
-	 * A class that gets the installed engine version and directory path from the Windows registry.
+	 * A class that gets the installed engine version and directory path from the Windows registry,
+	 * or on Linux from the Install.ini of UnrealVersionSelector and the manifest of the launcher.
+	 * The engine versions are read once and kept in memory, indexed by version name, until the registry key
+	 * of the installed engines changes, so that queries from menus and tasks never touch the registry.
+	 * The Linux sources are not watched, so they are read again once they have been kept for a while.
 	 */
 	class PLUGINBUILDER_API FEngineVersions
 	{
 	public:
-		// Engine version information that can be obtained from the registry.
+		// Engine version information that can be obtained from the installed engines.
 		struct PLUGINBUILDER_API FEngineVersion
 		{
 		public:
@@ -22,31 +26,41 @@ namespace PluginBuilder
 			// The path to the root directory of the installed engine.
 			FString InstalledDirectory;
 			
-			// The RunUAT.bat file path for the installed engine.
+			// The RunUAT.bat (RunUAT.sh on Linux) file path for the installed engine.
 			FString UATBatchFile;
 
+			// The Build.bat (Linux/Build.sh on Linux) file path for the installed engine, which runs UnrealBuildTool.
+			FString UBTBatchFile;
+
 			// The category of like UE4 or UE5 or a custom version.
 			FString MajorVersionName;
 		};
 		
 	public:
 		// Returns a list of installed engine version information.
-		static TArray<FEngineVersion> GetEngineVersions(const bool bWithRefresh = true);
+		// The registry (Install.ini and the launcher manifest on Linux) is only read again if it has changed since it was last read, or if bWithRefresh is true.
+		static const TArray<FEngineVersion>& GetEngineVersions(const bool bWithRefresh = false);
 
-		// Collects engine version information from the Windows registry.
+		// Collects engine version information from the installed engines, and starts watching them for changes where possible.
 		static void RefreshEngineVersions();
 
 		// Returns a list of installed engine version names.
-		static TArray<FString> GetVersionNames();
+		static const TArray<FString>& GetVersionNames();
+
+		// Returns the information of the engine version with the specified name, or nullptr if it is not installed.
+		static const FEngineVersion* FindEngineVersion(const FString& VersionName, const bool bWithRefresh = false);
+
+		// Searches for the RunUAT.bat (RunUAT.sh on Linux) file path from the version name.
+		static bool FindUATBatchFileByVersionName(const FString& VersionName, FString& UATBatchFile, const bool bWithRefresh = false);
 
-		// Searches for the RunUAT.bat file path from the version name.
-		static bool FindUATBatchFileByVersionName(const FString& VersionName, FString& UATBatchFile, const bool bWithRefresh = true);
+		// Searches for the Build.bat (Linux/Build.sh on Linux) file path from the version name.
+		static bool FindUBTBatchFileByVersionName(const FString& VersionName, FString& UBTBatchFile, const bool bWithRefresh = false);
 
 		// Logs the installed engine versions.
 		static void LogInstalledEngineVersions();
 
 		// Returns a list of major version category names from engine version information.
-		static TArray<FString> GetMajorVersionNames(const bool bWithRefresh = true);
+		static const TArray<FString>& GetMajorVersionNames(const bool bWithRefresh = false);
 		
 		// Toggles selection state the specified engine version.
 		static void ToggleEngineVersion(const FEngineVersion EngineVersion);
@@ -67,7 +81,28 @@ namespace PluginBuilder
 		static void EnableLatest3EngineVersions();
 		
 	private:
-		// The list of installed engine version information.
+		// Reads the registry again if it has never been read or has changed since it was last read.
+		static void RefreshEngineVersionsIfChanged();
+
+		// Returns the version names and root directories of the installed engines, sorted by version.
+		static TArray<TPair<FString, FString>> EnumerateInstalledEngines();
+
+	private:
+		// The list of installed engine version information, sorted by version.
 		static TArray<FEngineVersion> EngineVersions;
+
+		// The indices in EngineVersions keyed by version name.
+		static TMap<FString, int32> EngineVersionIndices;
+
+		// The installed engine version names and major version category names, in the order of EngineVersions.
+		static TArray<FString> VersionNames;
+		static TArray<FString> MajorVersionNames;
+
+		// Whether the registry has been read at least once, and when it was last read.
+		static bool bHasReadEngineVersions;
+		static double LastReadTime;
+
+		// How long the engine versions are kept when changes to the installed engines cannot be watched, in seconds.
+		static constexpr double UnwatchedRefreshInterval = 30.0;
 	};
 }
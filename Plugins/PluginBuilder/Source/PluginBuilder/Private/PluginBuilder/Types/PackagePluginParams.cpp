@@ -24,9 +24,72 @@ namespace PluginBuilder
 		return (!bKeepBinariesFolder && !bKeepUPluginProperties);
 	}
 
+	namespace PackagePluginParams
+	{
+		// Fills in everything except the plugin to package from the values set in the editor preferences.
+		static void MakeDefaultExceptPlugin(FPackagePluginParams& Default)
+		{
+			const auto& EditorSettings = GetSettings<UPluginBuilderEditorSettings>();
+			const auto& BuildConfigurationSettings = GetSettings<UPluginBuilderPackagingSettings>();
+
+			FUATBatchFileParams UATBatchFileParams;
+			{
+				UATBatchFileParams.bUseFriendlyName = EditorSettings.bUseFriendlyName;
+				if (!EditorSettings.bSelectOutputDirectoryManually)
+				{
+					UATBatchFileParams.OutputDirectoryPath = EditorSettings.OutputDirectoryPath.Path;
+				}
+				UATBatchFileParams.bStopPackagingProcessImmediately = EditorSettings.bStopPackagingProcessImmediately;
+			}
+			
+			FBuildPluginParams BuildPluginParams;
+			{
+				BuildPluginParams.bNoHostPlatform = BuildConfigurationSettings.bNoHostPlatform;
+				BuildPluginParams.HostPlatforms = BuildConfigurationSettings.HostPlatforms;
+				BuildPluginParams.TargetPlatforms = BuildConfigurationSettings.TargetPlatforms;
+				BuildPluginParams.bRocket = BuildConfigurationSettings.bRocket;
+				BuildPluginParams.bCreateSubFolder = BuildConfigurationSettings.bCreateSubFolder;
+				BuildPluginParams.bStrictIncludes = BuildConfigurationSettings.bStrictIncludes;
+				BuildPluginParams.bUnversioned = BuildConfigurationSettings.bUnversioned;
+				BuildPluginParams.bStopOnFirstBuildError = BuildConfigurationSettings.bStopOnFirstBuildError;
+				BuildPluginParams.bBuildWithUBTDirectly = BuildConfigurationSettings.bBuildWithUBTDirectly;
+				BuildPluginParams.BuildWorkerAddresses = EditorSettings.BuildWorkerAddresses;
+				BuildPluginParams.BuildWorkerAccessToken = EditorSettings.BuildWorkerAccessToken;
+			}
+
+			FZipUpPluginParams ZipUpPluginParams;
+			{
+				ZipUpPluginParams.bOutputAllZipFilesToSingleFolder = BuildConfigurationSettings.bOutputAllZipFilesToSingleFolder;
+				ZipUpPluginParams.bKeepBinariesFolder = BuildConfigurationSettings.bKeepBinariesFolder;
+				ZipUpPluginParams.bKeepUPluginProperties = BuildConfigurationSettings.bKeepUPluginProperties;
+				ZipUpPluginParams.bAppendEngineVersionToZipFileName = BuildConfigurationSettings.bAppendEngineVersionToZipFileName;
+				ZipUpPluginParams.CompressionLevel = BuildConfigurationSettings.CompressionLevel;
+			}
+
+			Default.EngineVersions = BuildConfigurationSettings.EngineVersions;
+			Default.UATBatchFileParams = UATBatchFileParams;
+			Default.BuildPluginParams = BuildPluginParams;
+			if (BuildConfigurationSettings.bZipUp)
+			{
+				Default.ZipUpPluginParams = ZipUpPluginParams;
+			}
+			if (BuildConfigurationSettings.bAutoUploadAfterZip)
+			{
+				FCloudStorageParams CloudStorageParams;
+				CloudStorageParams.bGetShareUrls = BuildConfigurationSettings.bGetShareUrls;
+				Default.CloudStorageParams = CloudStorageParams;
+			}
+			Default.MaxConcurrentUATTasks = EditorSettings.MaxConcurrentUATTasks;
+			Default.bExportPackageTrace = EditorSettings.bExportPackageTrace;
+			Default.RegressionThresholdPercent = EditorSettings.RegressionThresholdPercent;
+#if UE_5_00_OR_LATER
+			Default.bShowOnlyLogsFromThisPluginWhenPackageProcessStarts = EditorSettings.bShowOnlyLogsFromThisPluginWhenPackageProcessStarts;
+#endif
+		}
+	}
+
 	bool FPackagePluginParams::MakeDefault(FPackagePluginParams& Default)
 	{
-		const auto& EditorSettings = GetSettings<UPluginBuilderEditorSettings>();
 		const auto& BuildConfigurationSettings = GetSettings<UPluginBuilderPackagingSettings>();
 		if (!BuildConfigurationSettings.IsReadyToStartPackagePluginTask())
 		{
@@ -34,71 +97,41 @@ namespace PluginBuilder
 		}
 
 		const FBuildTargets::FBuildTarget& BuildTarget = BuildConfigurationSettings.SelectedBuildTarget.GetValue();
-		
-		FUATBatchFileParams UATBatchFileParams;
-		{
-			UATBatchFileParams.PluginName = BuildTarget.GetPluginName();
-			UATBatchFileParams.PluginFriendlyName = BuildTarget.GetPluginFriendlyName();
-			UATBatchFileParams.bUseFriendlyName = EditorSettings.bUseFriendlyName;
-			UATBatchFileParams.PluginVersionName = BuildTarget.GetPluginVersionName();
-			UATBatchFileParams.UPluginFile = BuildTarget.GetUPluginFile();
-			if (!EditorSettings.bSelectOutputDirectoryManually)
-			{
-				UATBatchFileParams.OutputDirectoryPath = EditorSettings.OutputDirectoryPath.Path;
-			}
-			UATBatchFileParams.bStopPackagingProcessImmediately = EditorSettings.bStopPackagingProcessImmediately;
-		}
-		
-		FBuildPluginParams BuildPluginParams;
-		{
-			BuildPluginParams.bNoHostPlatform = BuildConfigurationSettings.bNoHostPlatform;
-			BuildPluginParams.HostPlatforms = BuildConfigurationSettings.HostPlatforms;
-			BuildPluginParams.TargetPlatforms = BuildConfigurationSettings.TargetPlatforms;
-			BuildPluginParams.bRocket = BuildConfigurationSettings.bRocket;
-			BuildPluginParams.bCreateSubFolder = BuildConfigurationSettings.bCreateSubFolder;
-			BuildPluginParams.bStrictIncludes = BuildConfigurationSettings.bStrictIncludes;
-			BuildPluginParams.bUnversioned = BuildConfigurationSettings.bUnversioned;
-		}
 
-		FZipUpPluginParams ZipUpPluginParams;
+		PackagePluginParams::MakeDefaultExceptPlugin(Default);
+		Default.UATBatchFileParams.PluginName = BuildTarget.GetPluginName();
+		Default.UATBatchFileParams.PluginFriendlyName = BuildTarget.GetPluginFriendlyName();
+		Default.UATBatchFileParams.PluginVersionName = BuildTarget.GetPluginVersionName();
+		Default.UATBatchFileParams.UPluginFile = BuildTarget.GetUPluginFile();
+		if (Default.ZipUpPluginParams.IsSet())
 		{
-			ZipUpPluginParams.bCanPluginContainContent = BuildTarget.CanPluginContainContent();
-			ZipUpPluginParams.bOutputAllZipFilesToSingleFolder = BuildConfigurationSettings.bOutputAllZipFilesToSingleFolder;
-			ZipUpPluginParams.bKeepBinariesFolder = BuildConfigurationSettings.bKeepBinariesFolder;
-			ZipUpPluginParams.bKeepUPluginProperties = BuildConfigurationSettings.bKeepUPluginProperties;
-			ZipUpPluginParams.bAppendEngineVersionToZipFileName = BuildConfigurationSettings.bAppendEngineVersionToZipFileName;
-			ZipUpPluginParams.CompressionLevel = BuildConfigurationSettings.CompressionLevel;
+			Default.ZipUpPluginParams->bCanPluginContainContent = BuildTarget.CanPluginContainContent();
 		}
 
-		Default.EngineVersions = BuildConfigurationSettings.EngineVersions;
-		Default.UATBatchFileParams = UATBatchFileParams;
-		Default.BuildPluginParams = BuildPluginParams;
-		if (BuildConfigurationSettings.bZipUp)
-		{
-			Default.ZipUpPluginParams = ZipUpPluginParams;
-		}
-		if (BuildConfigurationSettings.bAutoUploadAfterZip)
+		return true;
+	}
+
+	bool FPackagePluginParams::MakeBatchFromPluginFriendlyNames(const TArray<FName>& PluginFriendlyNames, TArray<FPackagePluginParams>& ParamsList)
+	{
+		ParamsList.Reset(PluginFriendlyNames.Num());
+		for (const FName& PluginFriendlyName : PluginFriendlyNames)
 		{
-			FCloudStorageParams CloudStorageParams;
-			CloudStorageParams.bGetShareUrls = BuildConfigurationSettings.bGetShareUrls;
-			Default.CloudStorageParams = CloudStorageParams;
+			FPackagePluginParams& Params = ParamsList.AddDefaulted_GetRef();
+			PackagePluginParams::MakeDefaultExceptPlugin(Params);
+			if (!MakeFromPluginFriendlyName(PluginFriendlyName, Params))
+			{
+				UE_LOG(LogPluginBuilder, Warning, TEXT("No plugin named %s was found."), *PluginFriendlyName.ToString());
+				ParamsList.Reset();
+				return false;
+			}
 		}
-#if UE_5_00_OR_LATER
-		Default.bShowOnlyLogsFromThisPluginWhenPackageProcessStarts = EditorSettings.bShowOnlyLogsFromThisPluginWhenPackageProcessStarts;
-#endif
 
-		return true;
+		return ((ParamsList.Num() > 0) && (ParamsList[0].EngineVersions.Num() > 0));
 	}
 
 	bool FPackagePluginParams::MakeFromPluginFriendlyName(const FName& PluginFriendlyName, FPackagePluginParams& Params)
 	{
-		const TArray<FBuildTargets::FBuildTarget>& BuildTargets = FBuildTargets::GetFilteredBuildTargets();
-		const FBuildTargets::FBuildTarget* FoundBuildTarget = BuildTargets.FindByPredicate(
-			[&PluginFriendlyName](const FBuildTargets::FBuildTarget& BuildTarget) -> bool
-			{
-				return PluginFriendlyName.IsEqual(*BuildTarget.GetPluginFriendlyName());
-			}
-		);
+		const FBuildTargets::FBuildTarget* FoundBuildTarget = FBuildTargets::FindBuildTargetByFriendlyName(PluginFriendlyName.ToString());
 		if (FoundBuildTarget == nullptr)
 		{
 			return false;
@@ -120,28 +153,16 @@ namespace PluginBuilder
 	{
 		// Whether the plugin exists.
 		{
-			auto Predicate = [&](const FBuildTargets::FBuildTarget& BuildTarget) -> bool
-			{
-				return UATBatchFileParams.PluginFriendlyName.Equals(BuildTarget.GetPluginFriendlyName());
-			};
-		
-			const TArray<FBuildTargets::FBuildTarget>& BuildTargets = FBuildTargets::GetFilteredBuildTargets();
-			if (!BuildTargets.ContainsByPredicate(Predicate))
+			if (FBuildTargets::FindBuildTargetByFriendlyName(UATBatchFileParams.PluginFriendlyName) == nullptr)
 			{
 				return false;
 			}
 		}
 		// Whether a valid engine versions are specified.
 		{
-			const TArray<FString>& InstalledVersionNames = FEngineVersions::GetVersionNames();
 			for (const auto& EngineVersion : EngineVersions)
 			{
-				auto Predicate = [&EngineVersion](const FString& InstalledVersionName) -> bool
-				{
-					return EngineVersion.Equals(InstalledVersionName);
-				};
-
-				if (!InstalledVersionNames.ContainsByPredicate(Predicate))
+				if (FEngineVersions::FindEngineVersion(EngineVersion) == nullptr)
 				{
 					return false;
 				}
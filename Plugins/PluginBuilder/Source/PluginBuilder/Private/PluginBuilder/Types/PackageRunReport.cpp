@@ -0,0 +1,21 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Types/PackageRunReport.h"
+
+namespace PluginBuilder
+{
+	const FTaskRunReport* FPackageRunReport::FindTask(const FString& TimingKey) const
+	{
+		if (TimingKey.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		return Tasks.FindByPredicate(
+			[&TimingKey](const FTaskRunReport& Task) -> bool
+			{
+				return (Task.TimingKey == TimingKey);
+			}
+		);
+	}
+}
@@ -1,6 +1,7 @@
 // Copyright 2022-2026 Naotsun. All Rights Reserved.
 
 #include "PluginBuilder/Types/PlatformsBase.h"
+#include "PluginBuilder/Utilities/PlatformSdkStatusCache.h"
 #include "PluginBuilder/PluginBuilderGlobals.h"
 #include "Interfaces/ITargetPlatformManagerModule.h"
 #include "Interfaces/ITargetPlatform.h"
@@ -8,7 +9,6 @@
 #include "Misc/CoreMisc.h"
 #if UE_5_00_OR_LATER
 #include "Misc/DataDrivenPlatformInfoRegistry.h"
-#include "Interfaces/ITurnkeySupportModule.h"
 #else
 #include "PlatformInfo.h"
 #endif
@@ -67,23 +67,27 @@ namespace PluginBuilder
 				Platform.UBTPlatformName = PlatformInfo.UBTPlatformString;
 				Platform.IniPlatformName = PlatformInfo.IniPlatformName.ToString();
 
-				auto Test = ITurnkeySupportModule::Get().GetSdkInfo(*Platform.IniPlatformName, false);
-				const ETurnkeyPlatformSdkStatus Status = ITurnkeySupportModule::Get().GetSdkInfo(*Platform.IniPlatformName, false).Status;
+				// The status comes from the cache, which queries Turnkey in the background, so that menus open without waiting for it.
+				const FPlatformSdkStatusCache::ESdkStatus Status = FPlatformSdkStatusCache::GetSdkStatus(Platform.IniPlatformName);
 				switch (Status)
 				{
-				case ETurnkeyPlatformSdkStatus::OutOfDate:
-				case ETurnkeyPlatformSdkStatus::NoSdk:
+				case FPlatformSdkStatusCache::ESdkStatus::OutOfDate:
+				case FPlatformSdkStatusCache::ESdkStatus::NoSdk:
 					Platform.IconStyleName = TEXT("Icons.Warning");
 					break;
 
-				case ETurnkeyPlatformSdkStatus::Error:
+				case FPlatformSdkStatusCache::ESdkStatus::Error:
 					Platform.IconStyleName = TEXT("Icons.Error");
 					break;
 
-				case ETurnkeyPlatformSdkStatus::Unknown:
+				case FPlatformSdkStatusCache::ESdkStatus::Unknown:
 					Platform.IconStyleName = TEXT("Icons.Help");
 					break;
 
+				// A platform whose status has not arrived yet is treated as available, as it was while Turnkey was querying,
+				// so that its selection is kept until the status is known.
+				case FPlatformSdkStatusCache::ESdkStatus::Pending:
+				case FPlatformSdkStatusCache::ESdkStatus::Valid:
 				default:
 					Platform.IconStyleName = PlatformInfo.GetIconStyleName(EPlatformIconSize::Normal);
 					Platform.bIsAvailable = true;
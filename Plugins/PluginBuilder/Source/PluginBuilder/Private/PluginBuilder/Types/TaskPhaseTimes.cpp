@@ -0,0 +1,73 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Types/TaskPhaseTimes.h"
+
+namespace PluginBuilder
+{
+	const TCHAR* LexToString(const ETaskPhase Value)
+	{
+		switch (Value)
+		{
+		case ETaskPhase::Startup:
+			return TEXT("Startup");
+
+		case ETaskPhase::Compile:
+			return TEXT("Compile");
+
+		case ETaskPhase::Link:
+			return TEXT("Link");
+
+		case ETaskPhase::Zip:
+			return TEXT("Zip");
+
+		case ETaskPhase::Upload:
+			return TEXT("Upload");
+
+		default:
+			return TEXT("None");
+		}
+	}
+
+	bool LexTryParseString(ETaskPhase& OutValue, const TCHAR* Buffer)
+	{
+		for (int32 Index = 0; Index < static_cast<int32>(ETaskPhase::Num); Index++)
+		{
+			const ETaskPhase Phase = static_cast<ETaskPhase>(Index);
+			if (FCString::Stricmp(Buffer, LexToString(Phase)) == 0)
+			{
+				OutValue = Phase;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void FTaskPhaseTimes::Add(const ETaskPhase Phase, const double InSeconds)
+	{
+		check(Phase < ETaskPhase::Num);
+		Seconds[static_cast<int32>(Phase)] += InSeconds;
+	}
+
+	double FTaskPhaseTimes::Get(const ETaskPhase Phase) const
+	{
+		check(Phase < ETaskPhase::Num);
+		return Seconds[static_cast<int32>(Phase)];
+	}
+
+	void FTaskPhaseTimes::Set(const ETaskPhase Phase, const double InSeconds)
+	{
+		check(Phase < ETaskPhase::Num);
+		Seconds[static_cast<int32>(Phase)] = InSeconds;
+	}
+
+	double FTaskPhaseTimes::GetTotal() const
+	{
+		double Total = 0.0;
+		for (const double PhaseSeconds : Seconds)
+		{
+			Total += PhaseSeconds;
+		}
+		return Total;
+	}
+}
@@ -0,0 +1,60 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * The phases that the time spent on a task is divided into.
+	 */
+	enum class ETaskPhase : uint8
+	{
+		// From starting UAT until UBT starts running actions, including UnrealHeaderTool.
+		Startup,
+
+		// Running compile actions.
+		Compile,
+
+		// Running link actions and the rest of the build after them.
+		Link,
+
+		// Zipping up the plugin.
+		Zip,
+
+		// Uploading to cloud storage.
+		Upload,
+
+		Num,
+	};
+
+	// Converts the enum to a string used in the timing database, such as "Compile".
+	const TCHAR* LexToString(ETaskPhase Value);
+
+	// Converts a string from the timing database to the enum. Returns false if the string is not a phase.
+	bool LexTryParseString(ETaskPhase& OutValue, const TCHAR* Buffer);
+
+	/**
+	 * The seconds spent in each phase of a task.
+	 */
+	struct FTaskPhaseTimes
+	{
+	public:
+		// Adds seconds to the specified phase.
+		void Add(ETaskPhase Phase, double Seconds);
+
+		// Returns the seconds spent in the specified phase.
+		double Get(ETaskPhase Phase) const;
+
+		// Overwrites the seconds spent in the specified phase.
+		void Set(ETaskPhase Phase, double Seconds);
+
+		// Returns the seconds spent in all phases.
+		double GetTotal() const;
+
+	private:
+		// The seconds indexed by phase.
+		double Seconds[static_cast<int32>(ETaskPhase::Num)] = {};
+	};
+}
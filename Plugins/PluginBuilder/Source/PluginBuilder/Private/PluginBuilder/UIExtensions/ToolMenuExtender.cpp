@@ -7,6 +7,7 @@
 #include "PluginBuilder/Types/EngineVersions.h"
 #include "PluginBuilder/Types/HostPlatforms.h"
 #include "PluginBuilder/Types/TargetPlatforms.h"
+#include "PluginBuilder/Utilities/PlatformSdkStatusCache.h"
 #include "PluginBuilder/PluginBuilderGlobals.h"
 #include "ToolMenus.h"
 #if UE_5_00_OR_LATER
@@ -37,8 +38,12 @@ namespace PluginBuilder
 	const FName FToolMenuExtender::IndividualStepsSubMenuName			= TEXT("PluginBuilder.PackagePlugin.IndividualSteps");
 	const FName FToolMenuExtender::EngineVersionPresetSectionName		= TEXT("EngineVersionPreset");
 
+	FDelegateHandle FToolMenuExtender::OnSdkStatusUpdatedHandle;
+
 	void FToolMenuExtender::Register()
 	{
+		OnSdkStatusUpdatedHandle = FPlatformSdkStatusCache::OnSdkStatusUpdated().AddStatic(&FToolMenuExtender::HandleOnSdkStatusUpdated);
+
 		UToolMenu* MenuExtensionPoint = GetMenuExtensionPoint();
 		if (!IsValid(MenuExtensionPoint))
 		{
@@ -73,6 +78,8 @@ namespace PluginBuilder
 
 	void FToolMenuExtender::Unregister()
 	{
+		FPlatformSdkStatusCache::OnSdkStatusUpdated().Remove(OnSdkStatusUpdatedHandle);
+
 		UToolMenu* MainFrameFileMenu = GetMenuExtensionPoint();
 		if (!IsValid(MainFrameFileMenu))
 		{
@@ -82,6 +89,19 @@ namespace PluginBuilder
 		MainFrameFileMenu->RemoveSection(FilePluginSectionName);
 	}
 
+	void FToolMenuExtender::HandleOnSdkStatusUpdated()
+	{
+		// The platform lists are rebuilt from the cache, which is cheap, and the menus that show them are refreshed.
+		FHostPlatforms::RefreshHostPlatformNames();
+		FTargetPlatforms::RefreshTargetPlatformNames();
+
+		UToolMenus* ToolMenus = UToolMenus::Get();
+		if (IsValid(ToolMenus))
+		{
+			ToolMenus->RefreshAllWidgets();
+		}
+	}
+
 	UToolMenu* FToolMenuExtender::GetMenuExtensionPoint()
 	{
 		UToolMenus* ToolMenus = UToolMenus::Get();
@@ -165,6 +185,7 @@ namespace PluginBuilder
 
 		Section.AddSeparator(TEXT("EndChildSubMenus"));
 
+		Section.AddMenuEntry(FPluginBuilderCommands::Get().OpenBuildMonitor);
 		Section.AddMenuEntry(FPluginBuilderCommands::Get().OpenBuildSettings);
 		Section.AddMenuEntry(FPluginBuilderCommands::Get().OpenCloudStorageSettings);
 	}
@@ -222,6 +243,8 @@ namespace PluginBuilder
 		BuildOptionsSection.AddMenuEntry(FPluginBuilderCommands::Get().CreateSubFolder);
 		BuildOptionsSection.AddMenuEntry(FPluginBuilderCommands::Get().StrictIncludes);
 		BuildOptionsSection.AddMenuEntry(FPluginBuilderCommands::Get().Unversioned);
+		BuildOptionsSection.AddMenuEntry(FPluginBuilderCommands::Get().StopOnFirstBuildError);
+		BuildOptionsSection.AddMenuEntry(FPluginBuilderCommands::Get().BuildWithUBTDirectly);
 	}
 
 	void FToolMenuExtender::OnExtendBuildTargetSubMenu(UToolMenu* ToolMenu)
@@ -234,7 +257,7 @@ namespace PluginBuilder
 		const TArray<FBuildTargets::FBuildTarget>& BuildTargets = FBuildTargets::GetFilteredBuildTargets();
 		for (const auto& BuildTarget : BuildTargets)
 		{
-			const FString PluginCategory = BuildTarget.GetPluginCategory();
+			const FString& PluginCategory = BuildTarget.GetPluginCategory();
 			FToolMenuSection& Section = ToolMenu->FindOrAddSection(*PluginCategory);
 			Section.Label = FText::FromString(PluginCategory);
 
@@ -291,6 +314,7 @@ namespace PluginBuilder
 
 		CloudStorageOptionsSection.AddMenuEntry(FPluginBuilderCommands::Get().AutoUploadZipFiles);
 		CloudStorageOptionsSection.AddMenuEntry(FPluginBuilderCommands::Get().GetShareUrls);
+		CloudStorageOptionsSection.AddMenuEntry(FPluginBuilderCommands::Get().SkipIdenticalUploads);
 
 		CloudStorageOptionsSection.AddSubMenu(
 			ConflictBehaviorSubMenuName,
@@ -54,5 +54,12 @@ namespace PluginBuilder
 		static void OnExtendEngineVersionsSubMenu(UToolMenu* ToolMenu);
 		static void OnExtendHostPlatformsSubMenu(UToolMenu* ToolMenu);
 		static void OnExtendTargetPlatformsSubMenu(UToolMenu* ToolMenu);
+
+		// Called when fresh SDK statuses of the platforms arrive, to update the platform icons.
+		static void HandleOnSdkStatusUpdated();
+
+	private:
+		// The handle of the event called when fresh SDK statuses arrive.
+		static FDelegateHandle OnSdkStatusUpdatedHandle;
 	};
 }
@@ -0,0 +1,97 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/AutomationScriptsState.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace PluginBuilder
+{
+	bool FAutomationScriptsState::AreScriptsUpToDate(const FString& EngineVersion, const FString& UATBatchFile)
+	{
+		check(IsInGameThread());
+
+		const FDateTime* CompiledTimestamp = CompiledAssemblyTimestamps.Find(EngineVersion);
+		if (CompiledTimestamp == nullptr)
+		{
+			return false;
+		}
+
+		// A different timestamp means the engine has been updated or the scripts have been rebuilt outside this editor.
+		const FDateTime CurrentTimestamp = IFileManager::Get().GetTimeStamp(*GetAutomationToolAssemblyFile(EngineVersion, UATBatchFile));
+		if ((CurrentTimestamp == FDateTime::MinValue()) || (CurrentTimestamp != *CompiledTimestamp))
+		{
+			CompiledAssemblyTimestamps.Remove(EngineVersion);
+			return false;
+		}
+
+		return true;
+	}
+
+	void FAutomationScriptsState::BeginCompile(const FString& EngineVersion)
+	{
+		check(IsInGameThread());
+
+		CompilingEngineVersions.Add(EngineVersion);
+	}
+
+	bool FAutomationScriptsState::IsCompiling(const FString& EngineVersion)
+	{
+		check(IsInGameThread());
+
+		return CompilingEngineVersions.Contains(EngineVersion);
+	}
+
+	void FAutomationScriptsState::MarkScriptsCompiled(const FString& EngineVersion, const FString& UATBatchFile)
+	{
+		check(IsInGameThread());
+
+		CompilingEngineVersions.Remove(EngineVersion);
+
+		const FDateTime Timestamp = IFileManager::Get().GetTimeStamp(*GetAutomationToolAssemblyFile(EngineVersion, UATBatchFile));
+		if (Timestamp == FDateTime::MinValue())
+		{
+			UE_LOG(LogPluginBuilder, Verbose, TEXT("Could not find the AutomationTool assembly of %s, so automation scripts are compiled every time."), *EngineVersion);
+			return;
+		}
+
+		CompiledAssemblyTimestamps.Add(EngineVersion, Timestamp);
+	}
+
+	void FAutomationScriptsState::Invalidate(const FString& EngineVersion)
+	{
+		check(IsInGameThread());
+
+		CompiledAssemblyTimestamps.Remove(EngineVersion);
+		CompilingEngineVersions.Remove(EngineVersion);
+	}
+
+	TArray<FString> FAutomationScriptsState::GetNoCompileArguments(const FString& EngineVersion)
+	{
+		// UE5's RunUAT builds AutomationTool itself unless -NoCompileUAT is passed, while -NoCompile skips the script modules.
+		// UE4's RunUAT handles both with -NoCompile.
+		if (FCString::Atoi(*EngineVersion) >= 5)
+		{
+			return { TEXT("-NoCompileUAT"), TEXT("-NoCompile") };
+		}
+
+		return { TEXT("-NoCompile") };
+	}
+
+	FString FAutomationScriptsState::GetAutomationToolAssemblyFile(const FString& EngineVersion, const FString& UATBatchFile)
+	{
+		// RunUAT.bat and RunUAT.sh are in Engine/Build/BatchFiles.
+		FString DotNetDirectoryPath = (FPaths::GetPath(UATBatchFile) / TEXT("..") / TEXT("..") / TEXT("Binaries") / TEXT("DotNET"));
+		FPaths::CollapseRelativeDirectories(DotNetDirectoryPath);
+
+		if (FCString::Atoi(*EngineVersion) >= 5)
+		{
+			return (DotNetDirectoryPath / TEXT("AutomationTool") / TEXT("AutomationTool.dll"));
+		}
+
+		return (DotNetDirectoryPath / TEXT("AutomationTool.exe"));
+	}
+
+	TMap<FString, FDateTime> FAutomationScriptsState::CompiledAssemblyTimestamps;
+	TSet<FString> FAutomationScriptsState::CompilingEngineVersions;
+}
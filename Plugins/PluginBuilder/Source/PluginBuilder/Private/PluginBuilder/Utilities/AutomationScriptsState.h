@@ -0,0 +1,50 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * Tracks for each engine version whether its automation scripts have been compiled in this editor session.
+	 * Without flags RunUAT checks and compiles AutomationTool and its script assemblies on every run, which takes
+	 * most of the startup of a UAT task. Once a UAT task of an engine version has succeeded, later tasks of the same
+	 * engine version can pass the no-compile switches, as long as the AutomationTool assembly has not been replaced since.
+	 * Only one UAT task of an engine version compiles the scripts at a time, since the tasks would overwrite the same assemblies,
+	 * and the other tasks of the engine version wait for it so that they can start without compiling.
+	 */
+	class FAutomationScriptsState
+	{
+	public:
+		// Returns whether the automation scripts of the engine version have been compiled in this session and are still up to date.
+		static bool AreScriptsUpToDate(const FString& EngineVersion, const FString& UATBatchFile);
+
+		// Records that a UAT process of the engine version has started compiling the automation scripts.
+		static void BeginCompile(const FString& EngineVersion);
+
+		// Returns whether a UAT process of the engine version is compiling the automation scripts.
+		static bool IsCompiling(const FString& EngineVersion);
+
+		// Records that a UAT process of the engine version that compiled the automation scripts has succeeded.
+		static void MarkScriptsCompiled(const FString& EngineVersion, const FString& UATBatchFile);
+
+		// Makes the next UAT process of the engine version compile the automation scripts again, such as after a run without compiling failed.
+		// Also ends the compile of a UAT process that failed or was canceled.
+		static void Invalidate(const FString& EngineVersion);
+
+		// Returns the arguments that make RunUAT use the automation scripts as they are.
+		static TArray<FString> GetNoCompileArguments(const FString& EngineVersion);
+
+	private:
+		// Returns the path of the AutomationTool assembly, whose timestamp changes when the engine is updated or the scripts are rebuilt.
+		static FString GetAutomationToolAssemblyFile(const FString& EngineVersion, const FString& UATBatchFile);
+
+	private:
+		// The timestamps of the AutomationTool assembly when the scripts were last compiled, keyed by engine version.
+		static TMap<FString, FDateTime> CompiledAssemblyTimestamps;
+
+		// The engine versions whose automation scripts a UAT process is compiling.
+		static TSet<FString> CompilingEngineVersions;
+	};
+}
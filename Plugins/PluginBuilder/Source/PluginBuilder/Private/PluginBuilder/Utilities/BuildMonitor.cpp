@@ -0,0 +1,224 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/BuildMonitor.h"
+#include "PluginBuilder/Tasks/IPluginBuilderTask.h"
+#include "PluginBuilder/Utilities/TaskOutputLog.h"
+
+namespace PluginBuilder
+{
+	float FBuildMonitorTask::GetProgress() const
+	{
+		if (const TSharedPtr<IPluginBuilderTask> PinnedTask = Task.Pin())
+		{
+			if (State == EBuildMonitorTaskState::Running)
+			{
+				return PinnedTask->GetProgress();
+			}
+		}
+
+		return ((State == EBuildMonitorTaskState::Succeeded) ? 1.f : LastProgress);
+	}
+
+	FString FBuildMonitorTask::GetProgressText() const
+	{
+		if (const TSharedPtr<IPluginBuilderTask> PinnedTask = Task.Pin())
+		{
+			if (State == EBuildMonitorTaskState::Running)
+			{
+				return PinnedTask->GetProgressText();
+			}
+		}
+
+		return LastProgressText;
+	}
+
+	FString FBuildMonitorTask::GetThroughputText() const
+	{
+		if (const TSharedPtr<IPluginBuilderTask> PinnedTask = Task.Pin())
+		{
+			if (State == EBuildMonitorTaskState::Running)
+			{
+				return PinnedTask->GetThroughputText();
+			}
+		}
+
+		return LastThroughputText;
+	}
+
+	double FBuildMonitorTask::GetElapsedSeconds() const
+	{
+		if (StartTime <= 0.0)
+		{
+			return -1.0;
+		}
+
+		return ((IsFinished() ? EndTime : FPlatformTime::Seconds()) - StartTime);
+	}
+
+	double FBuildMonitorTask::GetRemainingSeconds() const
+	{
+		if (IsFinished() || (ExpectedSeconds < 0.0))
+		{
+			return -1.0;
+		}
+
+		if (State == EBuildMonitorTaskState::Pending)
+		{
+			return ExpectedSeconds;
+		}
+
+		// A task that takes longer than usual is expected to finish soon rather than at an unknown time.
+		return FMath::Max(ExpectedSeconds - GetElapsedSeconds(), 0.0);
+	}
+
+	bool FBuildMonitorTask::IsFinished() const
+	{
+		return ((State != EBuildMonitorTaskState::Pending) && (State != EBuildMonitorTaskState::Running));
+	}
+
+	void FBuildMonitor::BeginRun(
+		const FString& InRunName,
+		const TArray<TSharedRef<IPluginBuilderTask>>& InTasks,
+		const TMap<const IPluginBuilderTask*, double>& InExpectedTaskTimes
+	)
+	{
+		check(IsInGameThread());
+
+		RunName = InRunName;
+		bIsRunning = true;
+		Tasks.Reset(InTasks.Num());
+		TasksByPointer.Reset();
+
+		for (const TSharedRef<IPluginBuilderTask>& Task : InTasks)
+		{
+			const TSharedRef<FBuildMonitorTask> MonitorTask = MakeShared<FBuildMonitorTask>();
+			MonitorTask->Name = Task->GetTraceTrackName();
+			MonitorTask->Task = Task;
+			MonitorTask->OutputLog = Task->GetOutputLog();
+			if (const double* ExpectedTime = InExpectedTaskTimes.Find(&Task.Get()))
+			{
+				MonitorTask->ExpectedSeconds = *ExpectedTime;
+			}
+
+			Tasks.Add(MonitorTask);
+			TasksByPointer.Add(&Task.Get(), MonitorTask);
+		}
+
+		Revision++;
+	}
+
+	void FBuildMonitor::NotifyTaskStarted(const TSharedRef<IPluginBuilderTask>& Task)
+	{
+		check(IsInGameThread());
+
+		if (FBuildMonitorTask* MonitorTask = FindTask(Task))
+		{
+			MonitorTask->State = EBuildMonitorTaskState::Running;
+			MonitorTask->StartTime = FPlatformTime::Seconds();
+			Revision++;
+		}
+	}
+
+	void FBuildMonitor::NotifyTaskFinished(const TSharedRef<IPluginBuilderTask>& Task, const EBuildMonitorTaskState FinalState)
+	{
+		check(IsInGameThread());
+
+		FBuildMonitorTask* MonitorTask = FindTask(Task);
+		if (MonitorTask == nullptr)
+		{
+			return;
+		}
+
+		MonitorTask->LastProgress = Task->GetProgress();
+		MonitorTask->LastProgressText = Task->GetProgressText();
+		MonitorTask->LastThroughputText = Task->GetThroughputText();
+		MonitorTask->State = FinalState;
+		MonitorTask->EndTime = FPlatformTime::Seconds();
+		MonitorTask->Task.Reset();
+
+		// The task may be destroyed right after this, and another task could be allocated at the same address.
+		TasksByPointer.Remove(&Task.Get());
+		Revision++;
+	}
+
+	void FBuildMonitor::EndRun()
+	{
+		check(IsInGameThread());
+
+		bIsRunning = false;
+		TasksByPointer.Reset();
+		Revision++;
+	}
+
+	const FString& FBuildMonitor::GetRunName()
+	{
+		return RunName;
+	}
+
+	bool FBuildMonitor::IsRunning()
+	{
+		return bIsRunning;
+	}
+
+	const TArray<TSharedRef<FBuildMonitorTask>>& FBuildMonitor::GetTasks()
+	{
+		return Tasks;
+	}
+
+	uint32 FBuildMonitor::GetRevision()
+	{
+		return Revision;
+	}
+
+	void FBuildMonitor::CleanupStatics()
+	{
+		RunName.Empty();
+		bIsRunning = false;
+		Tasks.Empty();
+		TasksByPointer.Empty();
+	}
+
+	FBuildMonitorTask* FBuildMonitor::FindTask(const TSharedRef<IPluginBuilderTask>& Task)
+	{
+		if (TSharedRef<FBuildMonitorTask>* MonitorTask = TasksByPointer.Find(&Task.Get()))
+		{
+			return &MonitorTask->Get();
+		}
+
+		return nullptr;
+	}
+
+	const TCHAR* LexToString(const EBuildMonitorTaskState Value)
+	{
+		switch (Value)
+		{
+		case EBuildMonitorTaskState::Pending:
+			return TEXT("Pending");
+
+		case EBuildMonitorTaskState::Running:
+			return TEXT("Running");
+
+		case EBuildMonitorTaskState::Succeeded:
+			return TEXT("Succeeded");
+
+		case EBuildMonitorTaskState::Failed:
+			return TEXT("Failed");
+
+		case EBuildMonitorTaskState::Canceled:
+			return TEXT("Canceled");
+
+		case EBuildMonitorTaskState::Skipped:
+			return TEXT("Skipped");
+
+		default:
+			checkNoEntry();
+			return TEXT("Unknown");
+		}
+	}
+
+	FString FBuildMonitor::RunName;
+	bool FBuildMonitor::bIsRunning = false;
+	TArray<TSharedRef<FBuildMonitorTask>> FBuildMonitor::Tasks;
+	TMap<const IPluginBuilderTask*, TSharedRef<FBuildMonitorTask>> FBuildMonitor::TasksByPointer;
+	uint32 FBuildMonitor::Revision = 0;
+}
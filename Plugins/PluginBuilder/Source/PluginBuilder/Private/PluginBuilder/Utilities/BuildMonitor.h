@@ -0,0 +1,149 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	class IPluginBuilderTask;
+	class FTaskOutputLog;
+
+	/**
+	 * The state of a task shown in the build monitor.
+	 */
+	enum class EBuildMonitorTaskState : uint8
+	{
+		// Scheduled and waiting to start.
+		Pending,
+
+		// Being processed.
+		Running,
+
+		// Finished without errors.
+		Succeeded,
+
+		// Finished with errors.
+		Failed,
+
+		// Stopped because packaging was canceled.
+		Canceled,
+
+		// Not started because an earlier task failed.
+		Skipped,
+	};
+
+	/**
+	 * A task of the packaging process as shown in the build monitor.
+	 * While the task is being processed its values are read from the task itself,
+	 * and once it has finished the last values are kept since the task is destroyed soon after.
+	 */
+	struct FBuildMonitorTask
+	{
+	public:
+		// The name of the task, such as "Build UnrealEngine (5.4)".
+		FString Name;
+
+		// The state of the task.
+		EBuildMonitorTaskState State = EBuildMonitorTaskState::Pending;
+
+		// The task while it is scheduled.
+		TWeakPtr<IPluginBuilderTask> Task;
+
+		// The output of the task, which is kept after the task has been destroyed.
+		TSharedPtr<const FTaskOutputLog> OutputLog;
+
+		// The time at which the task started and finished.
+		double StartTime = 0.0;
+		double EndTime = 0.0;
+
+		// The seconds the task is expected to take, or a negative value if it has never been recorded.
+		double ExpectedSeconds = -1.0;
+
+		// The values of the task when it finished.
+		float LastProgress = -1.f;
+		FString LastProgressText;
+		FString LastThroughputText;
+
+	public:
+		// Returns the progress in [0, 1], or a negative value if unknown.
+		float GetProgress() const;
+
+		// Returns a short progress detail string, such as "[35/200]".
+		FString GetProgressText() const;
+
+		// Returns how fast the task is processing, such as "3.2 actions/s".
+		FString GetThroughputText() const;
+
+		// Returns the seconds since the task started, or a negative value if it has not started.
+		double GetElapsedSeconds() const;
+
+		// Returns the expected seconds until the task completes, or a negative value if unknown or finished.
+		double GetRemainingSeconds() const;
+
+		// Returns whether the task has finished, successfully or not.
+		bool IsFinished() const;
+	};
+
+	/**
+	 * Keeps the tasks of the last packaging process for the build monitor tab.
+	 * The packager reports when tasks are scheduled, started and finished, and the tab reads the tasks when it is open.
+	 */
+	class FBuildMonitor
+	{
+	public:
+		// Starts monitoring a packaging process with the scheduled tasks and the seconds they are expected to take.
+		static void BeginRun(
+			const FString& InRunName,
+			const TArray<TSharedRef<IPluginBuilderTask>>& InTasks,
+			const TMap<const IPluginBuilderTask*, double>& InExpectedTaskTimes
+		);
+
+		// Called when a task has been initialized.
+		static void NotifyTaskStarted(const TSharedRef<IPluginBuilderTask>& Task);
+
+		// Called when a task has been terminated or will no longer be started.
+		static void NotifyTaskFinished(const TSharedRef<IPluginBuilderTask>& Task, EBuildMonitorTaskState FinalState);
+
+		// Stops monitoring the packaging process. The tasks are kept until the next process begins.
+		static void EndRun();
+
+		// Returns the name of the packaging process, such as "MyPlugin (1.0)".
+		static const FString& GetRunName();
+
+		// Returns whether a packaging process is being monitored.
+		static bool IsRunning();
+
+		// Returns the tasks of the last packaging process in the order they were scheduled.
+		static const TArray<TSharedRef<FBuildMonitorTask>>& GetTasks();
+
+		// Returns a number that changes whenever a task is added or changes state, so that views only rebuild when needed.
+		static uint32 GetRevision();
+
+		// Releases all static state. Must be called before Slate is torn down (e.g., from ShutdownModule).
+		static void CleanupStatics();
+
+	private:
+		// Returns the monitored task of the specified task, or null if it is not being monitored.
+		static FBuildMonitorTask* FindTask(const TSharedRef<IPluginBuilderTask>& Task);
+
+	private:
+		// The name of the packaging process.
+		static FString RunName;
+
+		// Whether a packaging process is being monitored.
+		static bool bIsRunning;
+
+		// The tasks of the packaging process.
+		static TArray<TSharedRef<FBuildMonitorTask>> Tasks;
+
+		// The monitored tasks keyed by the tasks while they are scheduled.
+		static TMap<const IPluginBuilderTask*, TSharedRef<FBuildMonitorTask>> TasksByPointer;
+
+		// A number that changes whenever a task is added or changes state.
+		static uint32 Revision;
+	};
+
+	// Converts the enum to a string for the build monitor, such as "Running".
+	const TCHAR* LexToString(EBuildMonitorTaskState Value);
+}
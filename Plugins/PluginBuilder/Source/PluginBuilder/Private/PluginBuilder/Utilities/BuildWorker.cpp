@@ -0,0 +1,562 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/BuildWorker.h"
+#include "PluginBuilder/Utilities/RemoteBuildConnection.h"
+#include "PluginBuilder/Utilities/TaskOutputLog.h"
+#include "PluginBuilder/Tasks/BuildPluginTask.h"
+#include "PluginBuilder/Tasks/DirectBuildPluginTask.h"
+#include "PluginBuilder/Types/EngineVersions.h"
+#include "PluginBuilder/Types/HostPlatforms.h"
+#include "PluginBuilder/Types/TargetPlatforms.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformFile.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Async/Async.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+namespace PluginBuilder
+{
+	namespace BuildWorker
+	{
+		// How long each wait for a connection lasts before checking whether the worker is shutting down.
+		static const FTimespan PollInterval = FTimespan::FromMilliseconds(100);
+
+		// Returns whether a name received from a packager can be used as a file or directory name, and within a quoted command line argument.
+		static bool IsValidFileName(const FString& FileName)
+		{
+			return (
+				!FileName.IsEmpty() && (FileName != TEXT(".")) && (FileName != TEXT("..")) &&
+				!FileName.Contains(TEXT("/")) && !FileName.Contains(TEXT("\\")) && !FileName.Contains(TEXT(":")) && !FileName.Contains(TEXT("\""))
+			);
+		}
+
+		// Compares the access tokens in a time that does not depend on where they differ, so that the token cannot be guessed one character at a time.
+		static bool AreAccessTokensEqual(const FString& TokenA, const FString& TokenB)
+		{
+			uint32 Difference = static_cast<uint32>(TokenA.Len() ^ TokenB.Len());
+			const int32 Length = FMath::Max(TokenA.Len(), TokenB.Len());
+			for (int32 Index = 0; Index < Length; Index++)
+			{
+				const TCHAR CharA = (TokenA.IsValidIndex(Index) ? TokenA[Index] : 0);
+				const TCHAR CharB = (TokenB.IsValidIndex(Index) ? TokenB[Index] : 0);
+				Difference |= static_cast<uint32>(CharA ^ CharB);
+			}
+			return (Difference == 0);
+		}
+	}
+
+	FBuildWorker::FBuildWorker(const FString& InWorkingDirectoryPath, const int32 InMaxConcurrentJobs, const FString& InAccessToken)
+		: WorkingDirectoryPath(FPaths::ConvertRelativePathToFull(InWorkingDirectoryPath))
+		, MaxConcurrentJobs(FMath::Max(InMaxConcurrentJobs, 1))
+		, AccessToken(InAccessToken)
+		, ListenSocket(nullptr)
+		, Thread(nullptr)
+		, PortNo(0)
+		, bShouldStop(false)
+	{
+	}
+
+	FBuildWorker::~FBuildWorker()
+	{
+		Shutdown();
+	}
+
+	bool FBuildWorker::Start(const FString& InBindAddress, const int32 InPortNo)
+	{
+		check(ListenSocket == nullptr);
+
+		if (AccessToken.IsEmpty())
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: An access token is required, since anyone who can connect to the worker can run build scripts on it."));
+			return false;
+		}
+
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		if (SocketSubsystem == nullptr)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to get socket subsystem."));
+			return false;
+		}
+
+		bool bIsValidAddress = false;
+		const TSharedRef<FInternetAddr> InternetAddress = SocketSubsystem->CreateInternetAddr();
+		InternetAddress->SetIp(*InBindAddress, bIsValidAddress);
+		if (!bIsValidAddress)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: %s is not a valid address to listen on."), *InBindAddress);
+			return false;
+		}
+		InternetAddress->SetPort(InPortNo);
+
+		ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("BuildWorkerListener"), false);
+		if (ListenSocket == nullptr)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to create listener socket."));
+			return false;
+		}
+
+		ListenSocket->SetReuseAddr(true);
+		if (!ListenSocket->Bind(*InternetAddress) || !ListenSocket->Listen(16))
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to bind/listen on %s:%d."), *InBindAddress, InPortNo);
+			SocketSubsystem->DestroySocket(ListenSocket);
+			ListenSocket = nullptr;
+			return false;
+		}
+
+		// The requests are checked against the platforms that can be built on this machine, which are collected here on the game thread.
+		FEngineVersions::LogInstalledEngineVersions();
+		FHostPlatforms::LogAvailableHostPlatformNames();
+		FTargetPlatforms::LogAvailableTargetPlatformNames();
+
+		PortNo = ListenSocket->GetPortNo();
+		bShouldStop = false;
+		Thread = FRunnableThread::Create(this, TEXT("BuildWorkerThread"), 0, TPri_Normal);
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("Build worker: Listening on %s:%d. (Working Directory = %s, Max Concurrent Jobs = %d)"), *InBindAddress, PortNo, *WorkingDirectoryPath, MaxConcurrentJobs);
+		return true;
+	}
+
+	void FBuildWorker::Shutdown()
+	{
+		if (ListenSocket == nullptr)
+		{
+			return;
+		}
+
+		bShouldStop = true;
+		if (Thread != nullptr)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+			Thread = nullptr;
+		}
+
+		// The threads of the connections tell the packagers of the canceled and waiting builds that they failed, then close the connections.
+		for (const TSharedRef<FJob>& Job : RunningJobs)
+		{
+			Job->Task->RequestCancel();
+			if (Job->Task->GetState() != IPluginBuilderTask::EState::Terminated)
+			{
+				Job->Task->Terminate();
+			}
+		}
+		RunningJobs.Reset();
+
+		// The accept loop has ended, so no more connections are added.
+		TArray<TFuture<void>> FuturesToWait;
+		{
+			FScopeLock Lock(&CriticalSection);
+			FuturesToWait = MoveTemp(ConnectionFutures);
+			PendingJobs.Reset();
+		}
+		for (const TFuture<void>& ConnectionFuture : FuturesToWait)
+		{
+			ConnectionFuture.Wait();
+		}
+
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+		ListenSocket = nullptr;
+	}
+
+	int32 FBuildWorker::GetPortNo() const
+	{
+		return PortNo;
+	}
+
+	void FBuildWorker::Tick(float DeltaTime)
+	{
+		// The threads of the finished connections are released here, as a long-running worker would otherwise keep one per build.
+		{
+			FScopeLock Lock(&CriticalSection);
+			ConnectionFutures.RemoveAll(
+				[](const TFuture<void>& ConnectionFuture) -> bool
+				{
+					return ConnectionFuture.IsReady();
+				}
+			);
+		}
+
+		// A job whose task cannot start yet, such as while another build of the same engine version compiles the automation scripts,
+		// stays pending and the jobs behind it are started instead.
+		int32 PendingJobIndex = 0;
+		while (RunningJobs.Num() < MaxConcurrentJobs)
+		{
+			TSharedPtr<FJob> Job;
+			{
+				FScopeLock Lock(&CriticalSection);
+				if (!PendingJobs.IsValidIndex(PendingJobIndex))
+				{
+					break;
+				}
+				Job = PendingJobs[PendingJobIndex];
+			}
+
+			if (!Job->Task.IsValid())
+			{
+				CreateJobTask(*Job);
+			}
+			if (Job->Task.IsValid() && !Job->Task->CanStart())
+			{
+				PendingJobIndex++;
+				continue;
+			}
+
+			{
+				FScopeLock Lock(&CriticalSection);
+				PendingJobs.RemoveSingle(Job.ToSharedRef());
+			}
+			if (Job->Task.IsValid())
+			{
+				UE_LOG(LogPluginBuilder, Log, TEXT("Build worker: Starting the build of %s."), *Job->Name);
+				Job->Task->Initialize();
+				RunningJobs.Add(Job.ToSharedRef());
+			}
+			else
+			{
+				FinishJob(Job.ToSharedRef());
+			}
+		}
+
+		TArray<TSharedRef<FJob>> FinishedJobs;
+		for (const TSharedRef<FJob>& Job : RunningJobs)
+		{
+			IPluginBuilderTask& Task = *Job->Task;
+			if (Task.GetState() == IPluginBuilderTask::EState::Processing)
+			{
+				Task.Tick(DeltaTime);
+			}
+			if (Task.GetState() == IPluginBuilderTask::EState::PreTerminate)
+			{
+				Task.Terminate();
+			}
+
+			// The build is canceled when the packager has gone away, since there is no one to send the result to.
+			QueueNewOutput(*Job);
+			if (Job->bIsDisconnected && (Task.GetState() != IPluginBuilderTask::EState::Terminated))
+			{
+				UE_LOG(LogPluginBuilder, Warning, TEXT("Build worker: The packager of %s has disconnected, so the build is canceled."), *Job->Name);
+				Task.RequestCancel();
+			}
+
+			if (Task.GetState() == IPluginBuilderTask::EState::Terminated)
+			{
+				FinishedJobs.Add(Job);
+			}
+		}
+		for (const TSharedRef<FJob>& Job : FinishedJobs)
+		{
+			RunningJobs.RemoveSingle(Job);
+			FinishJob(Job);
+		}
+	}
+
+	uint32 FBuildWorker::Run()
+	{
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		while (!bShouldStop)
+		{
+			bool bHasPendingConnection = false;
+			if (!ListenSocket->WaitForPendingConnection(bHasPendingConnection, BuildWorker::PollInterval) || !bHasPendingConnection)
+			{
+				continue;
+			}
+
+			const TSharedRef<FInternetAddr> ClientAddr = SocketSubsystem->CreateInternetAddr();
+			FSocket* ClientSocket = ListenSocket->Accept(*ClientAddr, TEXT("BuildWorkerConnection"));
+			if (ClientSocket == nullptr)
+			{
+				continue;
+			}
+
+			UE_LOG(LogPluginBuilder, Log, TEXT("Build worker: Accepted a connection from %s."), *ClientAddr->ToString(true));
+
+			// Each connection receives the plugin source on its own thread so that a large plugin does not hold up the other connections.
+			const TSharedRef<FRemoteBuildConnection> Connection = MakeShared<FRemoteBuildConnection>(ClientSocket);
+			FScopeLock Lock(&CriticalSection);
+			ConnectionFutures.Add(
+				Async(EAsyncExecution::Thread, [this, Connection]()
+				{
+					HandleConnection(Connection);
+				})
+			);
+		}
+
+		return 0;
+	}
+
+	void FBuildWorker::Stop()
+	{
+		bShouldStop = true;
+	}
+
+	void FBuildWorker::HandleConnection(const TSharedRef<FRemoteBuildConnection>& Connection)
+	{
+		const TSharedRef<FJob> Job = MakeShared<FJob>();
+		Job->Connection = Connection;
+
+		FRemoteBuildMessage Message;
+		if (!Connection->Receive(Message, bShouldStop) || (Message.Type != FRemoteBuildMessage::Build))
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Build worker: The connection did not start with a build request."));
+			return;
+		}
+
+		// Nothing else of the request is looked at until the packager has shown that it knows the token.
+		FString ReceivedAccessToken;
+		if (!Message.Fields->TryGetStringField(TEXT("AccessToken"), ReceivedAccessToken) || !BuildWorker::AreAccessTokensEqual(ReceivedAccessToken, AccessToken))
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Build worker: Refused a build request with a wrong access token."));
+			Connection->Send(FRemoteBuildMessage::MakeResult(false, TEXT("The access token does not match the one the build worker was started with.")));
+			return;
+		}
+
+		if (!Message.ParseBuild(Job->EngineVersion, Job->UATBatchFileParams, Job->BuildPluginParams))
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Build worker: The build request is missing some fields."));
+			Connection->Send(FRemoteBuildMessage::MakeResult(false, TEXT("The build request is missing some fields.")));
+			return;
+		}
+
+		const FString UPluginFileName = Job->UATBatchFileParams.UPluginFile;
+		const FString PluginDirectoryName = FPaths::GetBaseFilename(UPluginFileName);
+		const bool bHasValidNames = (
+			BuildWorker::IsValidFileName(UPluginFileName) && FPaths::GetExtension(UPluginFileName).Equals(TEXT("uplugin"), ESearchCase::IgnoreCase) &&
+			BuildWorker::IsValidFileName(Job->EngineVersion) &&
+			BuildWorker::IsValidFileName(Job->UATBatchFileParams.GetPluginNameInSpecifiedFormat())
+		);
+		if (!bHasValidNames)
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Build worker: The build request has an invalid plugin name or engine version."));
+			Connection->Send(FRemoteBuildMessage::MakeResult(false, TEXT("The build request has an invalid plugin name or engine version.")));
+			return;
+		}
+		Job->Name = FString::Printf(TEXT("%s_%s"), *PluginDirectoryName, *Job->EngineVersion);
+
+		{
+			FScopeLock Lock(&CriticalSection);
+			bool bIsAlreadyInSet = false;
+			ActiveJobNames.Add(Job->Name, &bIsAlreadyInSet);
+			if (bIsAlreadyInSet)
+			{
+				Job->Error = FString::Printf(TEXT("%s is already being built on this worker."), *Job->Name);
+			}
+		}
+		if (!Job->Error.IsEmpty())
+		{
+			// The job is not registered, so its name stays reserved for the build that is running.
+			Connection->Send(FRemoteBuildMessage::MakeResult(false, Job->Error));
+			return;
+		}
+
+		FRemoteBuildMessage AcceptedMessage;
+		AcceptedMessage.Type = FRemoteBuildMessage::Accepted;
+		if (!Connection->Send(AcceptedMessage))
+		{
+			FScopeLock Lock(&CriticalSection);
+			ActiveJobNames.Remove(Job->Name);
+			return;
+		}
+
+		// The source is kept from the previous build of the same plugin and engine version, and only the files that changed are replaced.
+		const FString SourceDirectoryPath = (GetSourceDirectoryPath(Job->Name) / PluginDirectoryName);
+		UE_LOG(LogPluginBuilder, Log, TEXT("Build worker: Receiving the source of %s."), *Job->Name);
+		if (!Connection->ReceiveDirectory(SourceDirectoryPath, true, bShouldStop))
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Build worker: Failed to receive the source of %s."), *Job->Name);
+			FScopeLock Lock(&CriticalSection);
+			ActiveJobNames.Remove(Job->Name);
+			return;
+		}
+
+		Job->UATBatchFileParams.UPluginFile = (SourceDirectoryPath / UPluginFileName);
+		Job->UATBatchFileParams.OutputDirectoryPath = GetOutputDirectoryPath(Job->Name);
+		// The process is killed as soon as the packager cancels, since nobody waits for the result.
+		Job->UATBatchFileParams.bStopPackagingProcessImmediately = true;
+		Job->BuildPluginParams.BuildWorkerAddresses.Reset();
+
+		{
+			FScopeLock Lock(&CriticalSection);
+			PendingJobs.Add(Job);
+		}
+
+		SendJobUpdates(Job);
+	}
+
+	void FBuildWorker::SendJobUpdates(const TSharedRef<FJob>& Job)
+	{
+		// The output is sent here rather than on the game thread, so that a packager that stops reading only holds up its own build.
+		bool bIsConnected = true;
+		while (!bShouldStop)
+		{
+			// Read before the output is taken, so that all the output of a finished job is sent before its result.
+			const bool bHasFinished = Job->bHasFinished;
+
+			TArray<uint8> Output;
+			{
+				FScopeLock Lock(&CriticalSection);
+				Output = MoveTemp(Job->PendingOutput);
+			}
+			for (int32 Offset = 0; bIsConnected && (Offset < Output.Num()); Offset += MaxOutputMessageSize)
+			{
+				FRemoteBuildMessage Message;
+				Message.Type = FRemoteBuildMessage::Output;
+				Message.Payload.Append(Output.GetData() + Offset, FMath::Min(Output.Num() - Offset, MaxOutputMessageSize));
+				if (!Job->Connection->Send(Message))
+				{
+					// The name of the job stays reserved until the canceled build has finished.
+					Job->bIsDisconnected = true;
+					bIsConnected = false;
+				}
+			}
+
+			if (bHasFinished)
+			{
+				break;
+			}
+			FPlatformProcess::Sleep(BuildWorker::PollInterval.GetTotalSeconds());
+		}
+
+		// A job that has not finished when the worker shuts down, whether it was waiting or running, is reported as failed.
+		if (bIsConnected)
+		{
+			const bool bHasSucceeded = (Job->bHasFinished && Job->bHasSucceeded);
+			const FString Error = (Job->bHasFinished ? Job->Error : TEXT("The build worker is shutting down."));
+			if (Job->Connection->Send(FRemoteBuildMessage::MakeResult(bHasSucceeded, Error)))
+			{
+				// The transfer is abandoned when the worker shuts down, so that a large or stalled transfer does not hold up the shutdown.
+				if (bHasSucceeded)
+				{
+					Job->Connection->SendDirectory(
+						GetOutputDirectoryPath(Job->Name) / TEXT("BuiltPlugins"),
+						[](const FString& RelativePath) -> bool
+						{
+							return true;
+						},
+						bShouldStop
+					);
+				}
+				else
+				{
+					FRemoteBuildMessage EndMessage;
+					EndMessage.Type = FRemoteBuildMessage::EndOfFiles;
+					Job->Connection->Send(EndMessage);
+				}
+			}
+		}
+		Job->Connection->Close();
+
+		FScopeLock Lock(&CriticalSection);
+		ActiveJobNames.Remove(Job->Name);
+	}
+
+	FString FBuildWorker::ValidateBuildRequest(const FJob& Job)
+	{
+		// The platform names are passed on to the command lines of UAT and UBT, so only the names known on this machine are accepted.
+		for (const FString& HostPlatform : Job.BuildPluginParams.HostPlatforms)
+		{
+			if (!FHostPlatforms::IsAvailableHostPlatform(HostPlatform))
+			{
+				return FString::Printf(TEXT("%s is not an available host platform on the build worker."), *HostPlatform);
+			}
+		}
+		for (const FString& TargetPlatform : Job.BuildPluginParams.TargetPlatforms)
+		{
+			if (!FTargetPlatforms::IsAvailableTargetPlatform(TargetPlatform))
+			{
+				return FString::Printf(TEXT("%s is not an available target platform on the build worker."), *TargetPlatform);
+			}
+		}
+
+		return FString();
+	}
+
+	void FBuildWorker::CreateJobTask(FJob& Job)
+	{
+		Job.Error = ValidateBuildRequest(Job);
+		if (!Job.Error.IsEmpty())
+		{
+			return;
+		}
+
+		FString UATBatchFile;
+		if (!FEngineVersions::FindUATBatchFileByVersionName(Job.EngineVersion, UATBatchFile))
+		{
+			Job.Error = FString::Printf(TEXT("Unreal Engine %s is not installed on the build worker."), *Job.EngineVersion);
+			return;
+		}
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.DeleteDirectoryRecursively(*GetOutputDirectoryPath(Job.Name));
+
+		if (Job.BuildPluginParams.bBuildWithUBTDirectly)
+		{
+			Job.Task = MakeShared<FDirectBuildPluginTask>(Job.EngineVersion, Job.UATBatchFileParams, Job.BuildPluginParams);
+		}
+		else
+		{
+			Job.Task = MakeShared<FBuildPluginTask>(Job.EngineVersion, Job.UATBatchFileParams, Job.BuildPluginParams);
+		}
+	}
+
+	void FBuildWorker::QueueNewOutput(FJob& Job)
+	{
+		const TSharedPtr<const FTaskOutputLog> OutputLog = Job.Task->GetOutputLog();
+		if (!OutputLog.IsValid())
+		{
+			return;
+		}
+
+		// Lines that have already been overwritten in the ring buffer are lost, which only happens when the worker falls far behind.
+		const uint64 NumNewLines = (OutputLog->GetNumAddedLines() - Job.NumQueuedLines);
+		const int32 NumLines = OutputLog->GetNumLines();
+		const int32 NumAvailableLines = static_cast<int32>(FMath::Min<uint64>(NumNewLines, NumLines));
+		Job.NumQueuedLines = OutputLog->GetNumAddedLines();
+		if (NumAvailableLines == 0)
+		{
+			return;
+		}
+
+		TArray<uint8> NewOutput;
+		for (int32 LineIndex = (NumLines - NumAvailableLines); LineIndex < NumLines; LineIndex++)
+		{
+			const FTCHARToUTF8 LineUtf8(*(OutputLog->GetLine(LineIndex) + TEXT("\n")));
+			NewOutput.Append(reinterpret_cast<const uint8*>(LineUtf8.Get()), LineUtf8.Length());
+		}
+
+		FScopeLock Lock(&CriticalSection);
+		Job.PendingOutput.Append(NewOutput);
+	}
+
+	void FBuildWorker::FinishJob(const TSharedRef<FJob>& Job)
+	{
+		const bool bHasSucceeded = (Job->Error.IsEmpty() && Job->Task.IsValid() && !Job->Task->HasAnyError());
+		if (!Job->Error.IsEmpty())
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: %s"), *Job->Error);
+		}
+		UE_LOG(LogPluginBuilder, Log, TEXT("Build worker: The build of %s has %s."), *Job->Name, bHasSucceeded ? TEXT("succeeded") : TEXT("failed"));
+
+		// The task is released here, since a task must only be used on the game thread.
+		// Sending the built plugin can take a while, so it is left to the thread of the connection, which does not hold up the other running builds.
+		Job->Task.Reset();
+		Job->bHasSucceeded = bHasSucceeded;
+		Job->bHasFinished = true;
+	}
+
+	FString FBuildWorker::GetSourceDirectoryPath(const FString& JobName) const
+	{
+		return (WorkingDirectoryPath / TEXT("Sources") / JobName);
+	}
+
+	FString FBuildWorker::GetOutputDirectoryPath(const FString& JobName) const
+	{
+		return (WorkingDirectoryPath / TEXT("Outputs") / JobName);
+	}
+}
@@ -0,0 +1,157 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Async/Future.h"
+#include "PluginBuilder/Types/PackagePluginParams.h"
+
+class FSocket;
+class FRunnableThread;
+
+namespace PluginBuilder
+{
+	class IPluginBuilderTask;
+	class FRemoteBuildConnection;
+
+	/**
+	 * A build node that builds plugins for the packagers that connect to it, using the engine versions installed on this machine.
+	 * Each connection is one build of a plugin for one engine version. The plugin source is received on a thread of its own,
+	 * then the same build task as a local build is run, its output is streamed back and the built plugin is sent back when it has finished.
+	 * Only the thread of each connection sends to its packager, so a packager that stops reading cannot hold up the other builds.
+	 * The sources and host projects are kept per plugin and engine version, so a build that is sent again only rebuilds what has changed.
+	 * Building a plugin runs its build scripts, so only packagers that send the access token of the worker are accepted.
+	 * Run by the PluginBuilderWorker commandlet, and several workers can run on one machine with different ports and working directories.
+	 */
+	class FBuildWorker : public FRunnable
+	{
+	public:
+		// Constructor.
+		FBuildWorker(const FString& InWorkingDirectoryPath, int32 InMaxConcurrentJobs, const FString& InAccessToken);
+
+		// Destructor.
+		virtual ~FBuildWorker() override;
+
+		// Starts listening on the specified address and port, such as "127.0.0.1" or "0.0.0.0" for all network interfaces.
+		// Returns whether the worker started.
+		bool Start(const FString& InBindAddress, int32 InPortNo);
+
+		// Stops listening, cancels the running builds and waits for all connections to close.
+		void Shutdown();
+
+		// Returns the port the worker listens on.
+		int32 GetPortNo() const;
+
+		// Starts the builds that have been received and processes the running ones. Called from the game thread.
+		void Tick(float DeltaTime);
+
+		// FRunnable interface.
+		virtual uint32 Run() override;
+		virtual void Stop() override;
+		// End of FRunnable interface.
+
+	private:
+		// A build requested by a packager.
+		struct FJob
+		{
+		public:
+			// The connection to the packager that requested the build.
+			TSharedPtr<FRemoteBuildConnection> Connection;
+
+			// The name of the job, which is the plugin name and the engine version, such as "MyPlugin_5.4".
+			FString Name;
+
+			// The engine version to build for.
+			FString EngineVersion;
+
+			// The parameters of the build, with the paths on this machine.
+			FUATBatchFileParams UATBatchFileParams;
+			FBuildPluginParams BuildPluginParams;
+
+			// The build task, which is created when the job is about to start.
+			TSharedPtr<IPluginBuilderTask> Task;
+
+			// The number of output lines of the task that have been queued to be sent.
+			uint64 NumQueuedLines = 0;
+
+			// The output that the thread of the connection has not sent yet. Guarded by the critical section of the worker.
+			TArray<uint8> PendingOutput;
+
+			// Set when the build could not be started, such as when the engine version is not installed.
+			FString Error;
+
+			// Whether the build has succeeded. Set before bHasFinished.
+			bool bHasSucceeded = false;
+
+			// Set by the game thread when the build has finished or could not be started.
+			FThreadSafeBool bHasFinished;
+
+			// Set by the thread of the connection when the packager could not be sent to.
+			FThreadSafeBool bIsDisconnected;
+		};
+
+	private:
+		// Receives the request and the plugin source of a connection, queues the job and sends its updates. Runs on its own thread.
+		void HandleConnection(const TSharedRef<FRemoteBuildConnection>& Connection);
+
+		// Sends the output of a queued job as it is added, then the result and the built plugin once the job has finished.
+		// Runs on the thread of the connection.
+		void SendJobUpdates(const TSharedRef<FJob>& Job);
+
+		// Returns why the worker refuses to build a request, or an empty string if it can be built.
+		static FString ValidateBuildRequest(const FJob& Job);
+
+		// Creates the build task of a job, or sets the error of the job if it cannot be built.
+		void CreateJobTask(FJob& Job);
+
+		// Queues the output lines the task of a job has added since the last call, to be sent by the thread of the connection.
+		void QueueNewOutput(FJob& Job);
+
+		// Releases the task of a job that has finished or could not be started, and lets the thread of the connection send the result.
+		void FinishJob(const TSharedRef<FJob>& Job);
+
+		// Returns the directories where the source of a job is received and where the built plugin is output.
+		FString GetSourceDirectoryPath(const FString& JobName) const;
+		FString GetOutputDirectoryPath(const FString& JobName) const;
+
+	private:
+		// The directory where sources and outputs are kept.
+		FString WorkingDirectoryPath;
+
+		// The maximum number of builds that run at the same time.
+		int32 MaxConcurrentJobs;
+
+		// The token that a packager must send with each build request.
+		FString AccessToken;
+
+		// The socket that accepts connections and the thread that runs the accept loop.
+		FSocket* ListenSocket;
+		FRunnableThread* Thread;
+
+		// The port the worker listens on.
+		int32 PortNo;
+
+		// Set when the worker is shutting down.
+		FThreadSafeBool bShouldStop;
+
+		// Guards the state below, which is shared by the connection threads and the game thread.
+		FCriticalSection CriticalSection;
+
+		// The threads of the connections, which receive the requests and send the output and results.
+		TArray<TFuture<void>> ConnectionFutures;
+
+		// The jobs whose source has been received and that are waiting to start.
+		TArray<TSharedRef<FJob>> PendingJobs;
+
+		// The names of the jobs that are being received, waiting or running, so that the same plugin is not built twice at once.
+		TSet<FString> ActiveJobNames;
+
+		// The jobs that are running. Only used on the game thread.
+		TArray<TSharedRef<FJob>> RunningJobs;
+
+		// The largest number of output bytes sent in one message.
+		static constexpr int32 MaxOutputMessageSize = (1024 * 1024);
+	};
+}
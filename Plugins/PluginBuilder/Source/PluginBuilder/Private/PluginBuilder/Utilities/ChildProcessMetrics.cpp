@@ -0,0 +1,95 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/ChildProcessMetrics.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include "Windows/WindowsHWrapper.h"
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+namespace PluginBuilder
+{
+	FChildProcessMetrics::FChildProcessMetrics()
+		: JobHandle(nullptr)
+	{
+	}
+
+	FChildProcessMetrics::~FChildProcessMetrics()
+	{
+#if PLATFORM_WINDOWS
+		// Closing the job does not affect the processes in it, since no limit is set on it.
+		if (JobHandle != nullptr)
+		{
+			::CloseHandle(JobHandle);
+		}
+#endif
+	}
+
+	bool FChildProcessMetrics::Attach(FProcHandle& ProcessHandle)
+	{
+#if PLATFORM_WINDOWS
+		if (!ProcessHandle.IsValid())
+		{
+			return false;
+		}
+
+		const bool bHasCreatedJob = (JobHandle == nullptr);
+		if (bHasCreatedJob)
+		{
+			JobHandle = ::CreateJobObjectW(nullptr, nullptr);
+			if (JobHandle == nullptr)
+			{
+				return false;
+			}
+		}
+
+		// Nested jobs are supported since Windows 8, so this works even if the editor itself runs in a job.
+		if (!::AssignProcessToJobObject(JobHandle, ProcessHandle.Get()))
+		{
+			UE_LOG(LogPluginBuilder, Verbose, TEXT("Could not measure the child process. (Error = %u)"), ::GetLastError());
+			if (bHasCreatedJob)
+			{
+				::CloseHandle(JobHandle);
+				JobHandle = nullptr;
+			}
+			return false;
+		}
+
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	bool FChildProcessMetrics::Sample(FSample& OutSample) const
+	{
+#if PLATFORM_WINDOWS
+		if (JobHandle == nullptr)
+		{
+			return false;
+		}
+
+		JOBOBJECT_BASIC_ACCOUNTING_INFORMATION AccountingInfo;
+		if (!::QueryInformationJobObject(JobHandle, JobObjectBasicAccountingInformation, &AccountingInfo, sizeof(AccountingInfo), nullptr))
+		{
+			return false;
+		}
+
+		JOBOBJECT_EXTENDED_LIMIT_INFORMATION LimitInfo;
+		if (!::QueryInformationJobObject(JobHandle, JobObjectExtendedLimitInformation, &LimitInfo, sizeof(LimitInfo), nullptr))
+		{
+			return false;
+		}
+
+		// The times are in units of 100 nanoseconds.
+		OutSample.CpuSeconds = static_cast<double>(AccountingInfo.TotalUserTime.QuadPart + AccountingInfo.TotalKernelTime.QuadPart) / 10000000.0;
+		OutSample.PeakMemoryBytes = static_cast<uint64>(LimitInfo.PeakJobMemoryUsed);
+		OutSample.NumActiveProcesses = static_cast<int32>(AccountingInfo.ActiveProcesses);
+		return true;
+#else
+		return false;
+#endif
+	}
+}
@@ -0,0 +1,55 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * Measures the CPU time and memory used by a child process and all the processes it starts, such as UAT, UBT and the compilers.
+	 * On Windows the process is put in a job object, which accounts for every process in the tree including the ones that have exited.
+	 * On other platforms nothing is measured.
+	 */
+	class FChildProcessMetrics
+	{
+	public:
+		// A snapshot of the resources used by the process tree.
+		struct FSample
+		{
+		public:
+			// The user and kernel CPU seconds used by all processes in the tree so far.
+			double CpuSeconds = 0.0;
+
+			// The largest amount of memory committed by the process tree at the same time, in bytes.
+			uint64 PeakMemoryBytes = 0;
+
+			// The number of processes in the tree that are running now.
+			int32 NumActiveProcesses = 0;
+		};
+
+	public:
+		// Constructor.
+		FChildProcessMetrics();
+
+		// Destructor.
+		~FChildProcessMetrics();
+
+		// Non-copyable since this owns an OS handle.
+		FChildProcessMetrics(const FChildProcessMetrics&) = delete;
+		FChildProcessMetrics& operator=(const FChildProcessMetrics&) = delete;
+
+		// Starts measuring the process. Processes it started before this call are not included.
+		// Can be called for several processes, in which case the resources they use are added up.
+		// Returns false if the process cannot be measured on this platform.
+		bool Attach(FProcHandle& ProcessHandle);
+
+		// Reads the resources used so far. Returns false if no process is attached.
+		bool Sample(FSample& OutSample) const;
+
+	private:
+		// The job object the process tree belongs to.
+		void* JobHandle;
+	};
+}
@@ -0,0 +1,57 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/FileReplacer.h"
+#include "HAL/FileManager.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include "Windows/WindowsHWrapper.h"
+#include "Windows/HideWindowsPlatformTypes.h"
+#elif PLATFORM_UNIX || PLATFORM_MAC
+#include <stdio.h>
+#endif
+
+namespace PluginBuilder
+{
+	bool FFileReplacer::ReplaceFile(const FString& DestinationFilePath, const FString& SourceFilePath)
+	{
+		FString FullDestinationFilePath = FPaths::ConvertRelativePathToFull(DestinationFilePath);
+		FString FullSourceFilePath = FPaths::ConvertRelativePathToFull(SourceFilePath);
+		FPaths::MakePlatformFilename(FullDestinationFilePath);
+		FPaths::MakePlatformFilename(FullSourceFilePath);
+
+#if PLATFORM_WINDOWS
+		// Without MOVEFILE_COPY_ALLOWED the move is a rename, which replaces the destination in a single step.
+		return (::MoveFileExW(*FullSourceFilePath, *FullDestinationFilePath, MOVEFILE_REPLACE_EXISTING) != 0);
+#elif PLATFORM_UNIX || PLATFORM_MAC
+		// rename replaces the destination atomically.
+		return (::rename(TCHAR_TO_UTF8(*FullSourceFilePath), TCHAR_TO_UTF8(*FullDestinationFilePath)) == 0);
+#else
+		// Without an atomic rename, the previous file is moved aside and put back if the move fails.
+		IFileManager& FileManager = IFileManager::Get();
+		const bool bHasPreviousFile = FileManager.FileExists(*FullDestinationFilePath);
+		const FString PreviousFilePath = FString::Printf(TEXT("%s.%s.old"), *FullDestinationFilePath, *FGuid::NewGuid().ToString());
+		if (bHasPreviousFile && !FileManager.Move(*PreviousFilePath, *FullDestinationFilePath, false))
+		{
+			return false;
+		}
+
+		if (!FileManager.Move(*FullDestinationFilePath, *FullSourceFilePath, false))
+		{
+			if (bHasPreviousFile)
+			{
+				FileManager.Move(*FullDestinationFilePath, *PreviousFilePath, false);
+			}
+			return false;
+		}
+
+		if (bHasPreviousFile)
+		{
+			FileManager.Delete(*PreviousFilePath);
+		}
+		return true;
+#endif
+	}
+}
@@ -0,0 +1,20 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * Replaces a file with a completely written file in the same directory, such that readers see either the previous file or the new one.
+	 * IFileManager::Move deletes the destination before renaming the source, which loses the previous file if the rename fails.
+	 */
+	class FFileReplacer
+	{
+	public:
+		// Moves the source file to the destination, replacing the destination if it exists.
+		// Both files must be on the same volume. If the move fails, the destination is left as it was.
+		static bool ReplaceFile(const FString& DestinationFilePath, const FString& SourceFilePath);
+	};
+}
@@ -0,0 +1,21 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/FileSystemStorageSettings.h"
+
+UFileSystemStorageSettings::UFileSystemStorageSettings()
+	: CopyBufferSize(16)
+	, NumCopyBuffers(4)
+	, bWriteChecksumFiles(true)
+{
+}
+
+FString UFileSystemStorageSettings::GetSettingsName() const
+{
+	return TEXT("File System");
+}
+
+bool UFileSystemStorageSettings::IsConfigured() const
+{
+	// The directory is not probed here because this is polled by menus and a network share can take a long time to respond.
+	return !RootDirectory.Path.IsEmpty();
+}
@@ -0,0 +1,55 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/Utilities/PluginBuilderSettings.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#if UE_5_00_OR_LATER
+#include "UObject/SoftObjectPath.h"
+#else
+#include "Engine/EngineTypes.h"
+#endif
+#include "FileSystemStorageSettings.generated.h"
+
+/**
+ * Editor preferences for copying packaged plugins to a local directory or a network share.
+ */
+UCLASS(GlobalUserConfig)
+class PLUGINBUILDER_API UFileSystemStorageSettings : public UPluginBuilderSettings
+{
+	GENERATED_BODY()
+
+public:
+	// This class is read-only.
+	using UReference = const UFileSystemStorageSettings&;
+
+public:
+	// The directory that files are copied into, such as a NAS path (e.g. \\server\share\Plugins).
+	// Files are placed under RootDirectory/PluginName/...
+	UPROPERTY(EditAnywhere, Config, Category = "Destination")
+	FDirectoryPath RootDirectory;
+
+	// The size of each copy buffer in MB. Larger buffers mean fewer, larger writes, which suits network shares.
+	UPROPERTY(EditAnywhere, Config, Category = "Copy", meta = (ClampMin = 1, ClampMax = 256, Units = "MB"))
+	int32 CopyBufferSize;
+
+	// The number of copy buffers, so that reading the next buffer overlaps writing the previous ones.
+	UPROPERTY(EditAnywhere, Config, Category = "Copy", meta = (ClampMin = 2, ClampMax = 16))
+	int32 NumCopyBuffers;
+
+	// Whether to write a checksum file (.md5) next to each copied file, so that identical files can be detected without reading them again.
+	UPROPERTY(EditAnywhere, Config, Category = "Copy")
+	bool bWriteChecksumFiles;
+
+public:
+	// Constructor.
+	UFileSystemStorageSettings();
+
+	// UPluginBuilderSettings interface.
+	virtual FString GetSettingsName() const override;
+	// End of UPluginBuilderSettings interface.
+
+	// Returns whether the root directory is set.
+	bool IsConfigured() const;
+};
@@ -0,0 +1,287 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/PackageTrace.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace PluginBuilder
+{
+	namespace PackageTrace
+	{
+		// The process id written to every event, since all tracks belong to the editor process.
+		static constexpr int32 ProcessId = 1;
+
+		// Creates the arguments object of an event.
+		static TSharedRef<FJsonObject> MakeArgsObject(const FPackageTrace::FArgs& Args)
+		{
+			const TSharedRef<FJsonObject> ArgsObject = MakeShared<FJsonObject>();
+			for (const auto& Pair : Args)
+			{
+				ArgsObject->SetNumberField(Pair.Key, Pair.Value);
+			}
+			return ArgsObject;
+		}
+
+		// Creates an event object with the fields common to all types of events. The time is in seconds.
+		static TSharedRef<FJsonObject> MakeEventObject(const FString& Name, const TCHAR* Phase, const int32 TrackId, const double Time)
+		{
+			const TSharedRef<FJsonObject> EventObject = MakeShared<FJsonObject>();
+			EventObject->SetStringField(TEXT("name"), Name);
+			EventObject->SetStringField(TEXT("ph"), Phase);
+			EventObject->SetNumberField(TEXT("pid"), ProcessId);
+			EventObject->SetNumberField(TEXT("tid"), TrackId);
+			EventObject->SetNumberField(TEXT("ts"), Time * 1000000.0);
+			return EventObject;
+		}
+	}
+
+	FPackageTrace::FPackageTrace()
+		: StartTime(0.0)
+		, bIsRecording(false)
+		, EventIdOffset(0)
+	{
+	}
+
+	FPackageTrace& FPackageTrace::Get()
+	{
+		check(IsInGameThread());
+		static FPackageTrace Instance;
+		return Instance;
+	}
+
+	void FPackageTrace::Start(const FString& InRunName)
+	{
+		RunName = InRunName;
+		StartTime = FPlatformTime::Seconds();
+		StartDateTime = FDateTime::Now();
+		TrackNames.Reset();
+		EventIdOffset += Events.Num();
+		Events.Reset();
+		bIsRecording = true;
+
+		TRACE_BOOKMARK(TEXT("PluginBuilder: Start packaging %s"), *RunName);
+	}
+
+	void FPackageTrace::Stop()
+	{
+		if (!bIsRecording)
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < Events.Num(); Index++)
+		{
+			EndEvent(EventIdOffset + Index);
+		}
+		bIsRecording = false;
+
+		TRACE_BOOKMARK(TEXT("PluginBuilder: Finish packaging %s"), *RunName);
+	}
+
+	bool FPackageTrace::IsRecording() const
+	{
+		return bIsRecording;
+	}
+
+	int32 FPackageTrace::GetTrackId(const FString& TrackName)
+	{
+		if (!bIsRecording)
+		{
+			return INDEX_NONE;
+		}
+
+		return TrackNames.AddUnique(TrackName);
+	}
+
+	int32 FPackageTrace::BeginEvent(const int32 TrackId, const FString& Name, const TCHAR* Category, const bool bMayOverlap /* = false */)
+	{
+		if (!bIsRecording || !TrackNames.IsValidIndex(TrackId))
+		{
+			return INDEX_NONE;
+		}
+
+		FEvent Event;
+		Event.Type = (bMayOverlap ? EEventType::OverlappingSpan : EEventType::Span);
+		Event.TrackId = TrackId;
+		Event.Name = Name;
+		Event.Category = Category;
+		Event.BeginTime = GetElapsedTime();
+
+		// Regions are matched by name, so the track name keeps spans of tasks that run at the same time apart.
+#if UE_5_03_OR_LATER
+		Event.RegionName = FString::Printf(TEXT("PluginBuilder: %s - %s"), *TrackNames[TrackId], *Name);
+		TRACE_BEGIN_REGION(*Event.RegionName);
+#else
+		TRACE_BOOKMARK(TEXT("PluginBuilder: %s - %s"), *TrackNames[TrackId], *Name);
+#endif
+
+		return (EventIdOffset + Events.Add(MoveTemp(Event)));
+	}
+
+	void FPackageTrace::EndEvent(const int32 EventId, const FArgs& Args /* = FArgs() */)
+	{
+		FEvent* Event = FindOpenSpan(EventId);
+		if (Event == nullptr)
+		{
+			return;
+		}
+
+		Event->EndTime = GetElapsedTime();
+		Event->Args.Append(Args);
+
+#if UE_5_03_OR_LATER
+		TRACE_END_REGION(*Event->RegionName);
+#endif
+	}
+
+	void FPackageTrace::AddInstantEvent(const int32 TrackId, const FString& Name, const TCHAR* Category, const FArgs& Args /* = FArgs() */)
+	{
+		if (!bIsRecording || !TrackNames.IsValidIndex(TrackId))
+		{
+			return;
+		}
+
+		FEvent& Event = Events.AddDefaulted_GetRef();
+		Event.Type = EEventType::Instant;
+		Event.TrackId = TrackId;
+		Event.Name = Name;
+		Event.Category = Category;
+		Event.BeginTime = GetElapsedTime();
+		Event.EndTime = Event.BeginTime;
+		Event.Args = Args;
+	}
+
+	void FPackageTrace::AddCounter(const int32 TrackId, const FString& Name, const FArgs& Values)
+	{
+		if (!bIsRecording || !TrackNames.IsValidIndex(TrackId))
+		{
+			return;
+		}
+
+		FEvent& Event = Events.AddDefaulted_GetRef();
+		Event.Type = EEventType::Counter;
+		Event.TrackId = TrackId;
+		Event.Name = Name;
+		Event.Category = TEXT("Counter");
+		Event.BeginTime = GetElapsedTime();
+		Event.EndTime = Event.BeginTime;
+		Event.Args = Values;
+	}
+
+	bool FPackageTrace::ExportToChromeTrace(const FString& FilePath) const
+	{
+		TArray<TSharedPtr<FJsonValue>> EventValues;
+		EventValues.Reserve(Events.Num() + TrackNames.Num() + 1);
+
+		// Metadata events that name the process and the tracks, and keep the tracks in the order they were added.
+		auto AddMetadataEvent = [&EventValues](const TCHAR* Name, const int32 TrackId, const TCHAR* ArgName, const TSharedRef<FJsonValue>& ArgValue)
+		{
+			const TSharedRef<FJsonObject> ArgsObject = MakeShared<FJsonObject>();
+			ArgsObject->SetField(ArgName, ArgValue);
+
+			const TSharedRef<FJsonObject> EventObject = PackageTrace::MakeEventObject(Name, TEXT("M"), TrackId, 0.0);
+			EventObject->SetObjectField(TEXT("args"), ArgsObject);
+			EventValues.Add(MakeShared<FJsonValueObject>(EventObject));
+		};
+		AddMetadataEvent(TEXT("process_name"), 0, TEXT("name"), MakeShared<FJsonValueString>(FString::Printf(TEXT("Package %s"), *RunName)));
+		for (int32 TrackId = 0; TrackId < TrackNames.Num(); TrackId++)
+		{
+			AddMetadataEvent(TEXT("thread_name"), TrackId, TEXT("name"), MakeShared<FJsonValueString>(TrackNames[TrackId]));
+			AddMetadataEvent(TEXT("thread_sort_index"), TrackId, TEXT("sort_index"), MakeShared<FJsonValueNumber>(TrackId));
+		}
+
+		int32 AsyncId = 0;
+		for (const FEvent& Event : Events)
+		{
+			TSharedPtr<FJsonObject> EventObject;
+			switch (Event.Type)
+			{
+			case EEventType::Span:
+				EventObject = PackageTrace::MakeEventObject(Event.Name, TEXT("X"), Event.TrackId, Event.BeginTime);
+				EventObject->SetNumberField(TEXT("dur"), FMath::Max(Event.EndTime - Event.BeginTime, 0.0) * 1000000.0);
+				break;
+
+			case EEventType::OverlappingSpan:
+				// Async events are drawn in their own rows, so they do not have to nest.
+				{
+					const TSharedRef<FJsonObject> EndEventObject = PackageTrace::MakeEventObject(Event.Name, TEXT("e"), Event.TrackId, FMath::Max(Event.EndTime, Event.BeginTime));
+					EndEventObject->SetStringField(TEXT("cat"), Event.Category);
+					EndEventObject->SetNumberField(TEXT("id"), AsyncId);
+					EventValues.Add(MakeShared<FJsonValueObject>(EndEventObject));
+				}
+				EventObject = PackageTrace::MakeEventObject(Event.Name, TEXT("b"), Event.TrackId, Event.BeginTime);
+				EventObject->SetNumberField(TEXT("id"), AsyncId++);
+				break;
+
+			case EEventType::Instant:
+				EventObject = PackageTrace::MakeEventObject(Event.Name, TEXT("i"), Event.TrackId, Event.BeginTime);
+				EventObject->SetStringField(TEXT("s"), TEXT("t"));
+				break;
+
+			case EEventType::Counter:
+				// Counters belong to the process in the viewer, so the track name tells apart those of different tasks.
+				EventObject = PackageTrace::MakeEventObject(
+					FString::Printf(TEXT("%s - %s"), *TrackNames[Event.TrackId], *Event.Name),
+					TEXT("C"),
+					Event.TrackId,
+					Event.BeginTime
+				);
+				break;
+
+			default:
+				continue;
+			}
+
+			EventObject->SetStringField(TEXT("cat"), Event.Category);
+			EventObject->SetObjectField(TEXT("args"), PackageTrace::MakeArgsObject(Event.Args));
+			EventValues.Add(MakeShared<FJsonValueObject>(EventObject));
+		}
+
+		const TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetArrayField(TEXT("traceEvents"), EventValues);
+		RootObject->SetStringField(TEXT("displayTimeUnit"), TEXT("ms"));
+
+		FString JsonString;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+		FJsonSerializer::Serialize(RootObject, Writer);
+
+		if (!FFileHelper::SaveStringToFile(JsonString, *FilePath))
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Failed to export the package trace. (%s)"), *FilePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	FString FPackageTrace::MakeTraceFilePath() const
+	{
+		const FString FileName = FString::Printf(TEXT("%s_%s.json"), *RunName, *StartDateTime.ToString(TEXT("%Y%m%d_%H%M%S")));
+		return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PluginBuilder") / TEXT("Traces") / FPaths::MakeValidFileName(FileName));
+	}
+
+	FPackageTrace::FEvent* FPackageTrace::FindOpenSpan(const int32 EventId)
+	{
+		const int32 Index = (EventId - EventIdOffset);
+		if (!bIsRecording || (EventId == INDEX_NONE) || !Events.IsValidIndex(Index))
+		{
+			return nullptr;
+		}
+
+		FEvent& Event = Events[Index];
+		if ((Event.Type != EEventType::Span) && (Event.Type != EEventType::OverlappingSpan))
+		{
+			return nullptr;
+		}
+		return ((Event.EndTime < 0.0) ? &Event : nullptr);
+	}
+
+	double FPackageTrace::GetElapsedTime() const
+	{
+		return (FPlatformTime::Seconds() - StartTime);
+	}
+}
@@ -0,0 +1,122 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * Records what a packaging process spends its time on as begin / end events on named tracks, such as one for each task.
+	 * The events can be exported as a Chrome trace json that chrome://tracing and Perfetto can open, and spans are also
+	 * emitted as Unreal Insights regions (bookmarks before UE5.3) so that they line up with the rest of an editor trace.
+	 * Nothing is recorded while no packaging process is running, so that the calls in tasks and providers cost almost nothing.
+	 */
+	class FPackageTrace
+	{
+	public:
+		// Numeric arguments attached to an event, such as the number of bytes sent.
+		using FArgs = TMap<FString, double>;
+
+	public:
+		// Constructor.
+		FPackageTrace();
+
+		// Returns the recorder shared by the packaging process and its tasks. Must be used from the game thread.
+		static FPackageTrace& Get();
+
+		// Discards the previous events and starts recording a packaging process with the specified name.
+		void Start(const FString& InRunName);
+
+		// Stops recording and ends the spans that are still open.
+		void Stop();
+
+		// Returns whether a packaging process is being recorded.
+		bool IsRecording() const;
+
+		// Returns the id of the track with the specified name, adding it if needed. Returns INDEX_NONE while not recording.
+		int32 GetTrackId(const FString& TrackName);
+
+		// Begins a span on the track and returns its id, which is passed to EndEvent. Returns INDEX_NONE while not recording.
+		// Spans on a track must nest unless bMayOverlap is true, as for HTTP requests that are in flight at the same time.
+		int32 BeginEvent(int32 TrackId, const FString& Name, const TCHAR* Category, bool bMayOverlap = false);
+
+		// Ends a span and attaches the arguments to it. Does nothing for INDEX_NONE or a span that has already ended.
+		void EndEvent(int32 EventId, const FArgs& Args = FArgs());
+
+		// Adds an event that has no duration, such as the first output line of a process.
+		void AddInstantEvent(int32 TrackId, const FString& Name, const TCHAR* Category, const FArgs& Args = FArgs());
+
+		// Adds a sample of counters, such as the CPU usage and memory of a child process, which are drawn as a graph.
+		void AddCounter(int32 TrackId, const FString& Name, const FArgs& Values);
+
+		// Writes the recorded events as a Chrome trace json file. Returns whether the file was written.
+		bool ExportToChromeTrace(const FString& FilePath) const;
+
+		// Returns the path of a new trace file for the run in the Saved/PluginBuilder/Traces folder of the project.
+		FString MakeTraceFilePath() const;
+
+	private:
+		// The types of recorded events.
+		enum class EEventType : uint8
+		{
+			Span,
+			OverlappingSpan,
+			Instant,
+			Counter,
+		};
+
+		// A recorded event.
+		struct FEvent
+		{
+		public:
+			// The type of this event.
+			EEventType Type = EEventType::Span;
+
+			// The track this event is drawn on.
+			int32 TrackId = INDEX_NONE;
+
+			// The name and category shown in the viewer.
+			FString Name;
+			const TCHAR* Category = TEXT("");
+
+			// The times the event began and ended, in seconds since recording started. The end time is negative while a span is open.
+			double BeginTime = 0.0;
+			double EndTime = -1.0;
+
+			// The arguments, or counter values, of this event.
+			FArgs Args;
+
+#if UE_5_03_OR_LATER
+			// The name of the Unreal Insights region emitted for this span.
+			FString RegionName;
+#endif
+		};
+
+		// Returns the recorded span with the specified id that has not ended yet, or nullptr.
+		FEvent* FindOpenSpan(int32 EventId);
+
+		// Returns the seconds elapsed since recording started.
+		double GetElapsedTime() const;
+
+	private:
+		// The name of the packaging process being recorded, such as the plugin name.
+		FString RunName;
+
+		// The time at which recording started, and the same time in UTC used to name the trace file.
+		double StartTime;
+		FDateTime StartDateTime;
+
+		// Whether a packaging process is being recorded.
+		bool bIsRecording;
+
+		// The names of the tracks, indexed by track id.
+		TArray<FString> TrackNames;
+
+		// The recorded events. The id of an event is its index plus the offset, so that ids of a previous run
+		// held by requests that are still in flight do not refer to events of the current one.
+		TArray<FEvent> Events;
+		int32 EventIdOffset;
+	};
+}
@@ -0,0 +1,165 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/PlatformSdkStatusCache.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#if UE_5_00_OR_LATER
+#include "Interfaces/ITurnkeySupportModule.h"
+#endif
+
+namespace PluginBuilder
+{
+	FPlatformSdkStatusCache::ESdkStatus FPlatformSdkStatusCache::GetSdkStatus(const FString& IniPlatformName)
+	{
+		check(IsInGameThread());
+
+		const double CurrentTime = FPlatformTime::Seconds();
+		FEntry* Entry = Entries.Find(IniPlatformName);
+		if (Entry == nullptr)
+		{
+			Entry = &Entries.Add(IniPlatformName);
+			RequestedPlatformNames.Add(IniPlatformName);
+			StartQuery();
+		}
+		else if ((Entry->Status != ESdkStatus::Pending) && ((CurrentTime - Entry->UpdatedTime) >= TimeToLive))
+		{
+			// Marked as updated so that the platform is not requested again while the query is running.
+			Entry->UpdatedTime = CurrentTime;
+			RequestedPlatformNames.Add(IniPlatformName);
+			StartQuery();
+		}
+
+		// A stale status is still returned until the fresh one arrives, so that the menus never wait for Turnkey.
+		return Entry->Status;
+	}
+
+	FSimpleMulticastDelegate& FPlatformSdkStatusCache::OnSdkStatusUpdated()
+	{
+		return OnSdkStatusUpdatedDelegate;
+	}
+
+	void FPlatformSdkStatusCache::StartQuery()
+	{
+		check(IsInGameThread());
+
+		if (bIsQuerying || (RequestedPlatformNames.Num() == 0))
+		{
+			return;
+		}
+
+#if UE_5_00_OR_LATER
+		// The module is resolved here because loading modules is only allowed on the game thread.
+		ITurnkeySupportModule* TurnkeySupport = &ITurnkeySupportModule::Get();
+		TArray<FString> PlatformNames = RequestedPlatformNames.Array();
+		RequestedPlatformNames.Reset();
+		bIsQuerying = true;
+
+		Async(EAsyncExecution::ThreadPool, [TurnkeySupport, PlatformNames]()
+		{
+			TArray<TPair<FString, ESdkStatus>> Results;
+			Results.Reserve(PlatformNames.Num());
+			for (const auto& PlatformName : PlatformNames)
+			{
+				ESdkStatus Status;
+				switch (TurnkeySupport->GetSdkInfo(*PlatformName, false).Status)
+				{
+				case ETurnkeyPlatformSdkStatus::Valid:
+					Status = ESdkStatus::Valid;
+					break;
+
+				case ETurnkeyPlatformSdkStatus::OutOfDate:
+					Status = ESdkStatus::OutOfDate;
+					break;
+
+				case ETurnkeyPlatformSdkStatus::NoSdk:
+					Status = ESdkStatus::NoSdk;
+					break;
+
+				case ETurnkeyPlatformSdkStatus::Error:
+					Status = ESdkStatus::Error;
+					break;
+
+				case ETurnkeyPlatformSdkStatus::Querying:
+					Status = ESdkStatus::Pending;
+					break;
+
+				case ETurnkeyPlatformSdkStatus::Unknown:
+				default:
+					Status = ESdkStatus::Unknown;
+					break;
+				}
+				Results.Emplace(PlatformName, Status);
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [Results]()
+			{
+				HandleOnQueryCompleted(Results);
+			});
+		});
+#else
+		// UE4 keeps the SDK status in PlatformInfo, which is read directly without going through this cache.
+		RequestedPlatformNames.Reset();
+#endif
+	}
+
+	void FPlatformSdkStatusCache::HandleOnQueryCompleted(const TArray<TPair<FString, ESdkStatus>>& Results)
+	{
+		check(IsInGameThread());
+
+		bIsQuerying = false;
+
+		bool bHasChanged = false;
+		bool bHasPendingPlatforms = false;
+		const double CurrentTime = FPlatformTime::Seconds();
+		for (const auto& Result : Results)
+		{
+			FEntry& Entry = Entries.FindOrAdd(Result.Key);
+			bHasChanged |= (Entry.Status != Result.Value);
+			Entry.Status = Result.Value;
+			Entry.UpdatedTime = CurrentTime;
+
+			if (Result.Value == ESdkStatus::Pending)
+			{
+				bHasPendingPlatforms = true;
+			}
+		}
+
+		// Turnkey answers its own query later, so the platforms it is still querying are asked again after a while.
+		if (bHasPendingPlatforms)
+		{
+			const FTickerDelegate RetryDelegate = FTickerDelegate::CreateLambda(
+				[](float /* DeltaTime */) -> bool
+				{
+					for (const auto& Entry : Entries)
+					{
+						if (Entry.Value.Status == ESdkStatus::Pending)
+						{
+							RequestedPlatformNames.Add(Entry.Key);
+						}
+					}
+					StartQuery();
+					return false;
+				}
+			);
+#if UE_5_00_OR_LATER
+			FTSTicker::GetCoreTicker().AddTicker(RetryDelegate, PendingRetryInterval);
+#else
+			FTicker::GetCoreTicker().AddTicker(RetryDelegate, PendingRetryInterval);
+#endif
+		}
+
+		// Platforms requested while the query was running.
+		StartQuery();
+
+		if (bHasChanged)
+		{
+			OnSdkStatusUpdatedDelegate.Broadcast();
+		}
+	}
+
+	TMap<FString, FPlatformSdkStatusCache::FEntry> FPlatformSdkStatusCache::Entries;
+	TSet<FString> FPlatformSdkStatusCache::RequestedPlatformNames;
+	bool FPlatformSdkStatusCache::bIsQuerying = false;
+	FSimpleMulticastDelegate FPlatformSdkStatusCache::OnSdkStatusUpdatedDelegate;
+}
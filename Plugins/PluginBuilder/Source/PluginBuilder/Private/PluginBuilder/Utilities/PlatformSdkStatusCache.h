@@ -0,0 +1,81 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * Caches the SDK status of each platform, because querying Turnkey can take hundreds of milliseconds per platform.
+	 * The platform menus are built from whatever is cached, and the statuses that are missing or older than TimeToLive
+	 * are queried again on a background thread. OnSdkStatusUpdated is called on the game thread when fresh statuses arrive.
+	 */
+	class FPlatformSdkStatusCache
+	{
+	public:
+		// The state of the SDK required to build for a platform.
+		enum class ESdkStatus : uint8
+		{
+			// The status has not been queried yet, or Turnkey is still querying it.
+			Pending,
+
+			// The SDK is installed and can be used.
+			Valid,
+
+			// The SDK is installed but older than the engine requires.
+			OutOfDate,
+
+			// The SDK is not installed.
+			NoSdk,
+
+			// Querying the SDK failed.
+			Error,
+
+			// Turnkey could not determine the status.
+			Unknown,
+		};
+
+	public:
+		// Returns the cached SDK status of the platform with the specified ini name,
+		// and starts querying it in the background if it has not been queried or is older than TimeToLive.
+		static ESdkStatus GetSdkStatus(const FString& IniPlatformName);
+
+		// Returns the event called on the game thread when fresh statuses arrive.
+		static FSimpleMulticastDelegate& OnSdkStatusUpdated();
+
+	private:
+		// Queries the statuses of the requested platforms on a background thread, unless a query is already running.
+		static void StartQuery();
+
+		// Stores the statuses received from the background thread and queries the platforms still pending again later.
+		static void HandleOnQueryCompleted(const TArray<TPair<FString, ESdkStatus>>& Results);
+
+	private:
+		// A cached status and when it was received.
+		struct FEntry
+		{
+		public:
+			ESdkStatus Status = ESdkStatus::Pending;
+			double UpdatedTime = 0.0;
+		};
+
+		// The cached statuses keyed by ini platform name.
+		static TMap<FString, FEntry> Entries;
+
+		// The platforms to query with the next background query.
+		static TSet<FString> RequestedPlatformNames;
+
+		// Whether a background query is running.
+		static bool bIsQuerying;
+
+		// The event called when fresh statuses arrive.
+		static FSimpleMulticastDelegate OnSdkStatusUpdatedDelegate;
+
+		// How long a status is used before it is queried again, in seconds.
+		static constexpr double TimeToLive = 300.0;
+
+		// How long to wait before querying again a platform that Turnkey is still querying, in seconds.
+		static constexpr float PendingRetryInterval = 2.0f;
+	};
+}
@@ -12,7 +12,17 @@ UPluginBuilderEditorSettings::UPluginBuilderEditorSettings()
 	, bUseFriendlyName(true)
 	, bShowOnlyLogsFromThisPluginWhenPackageProcessStarts(false)
 	, bStopPackagingProcessImmediately(false)
+	, MaxConcurrentUATTasks(1)
+	, bExportPackageTrace(false)
+	, RegressionThresholdPercent(25)
 	, CloudStorageProvider(ECloudStorageProvider::OneDrive)
+	, UploadReadCacheSize(256)
+	, UploadBandwidthLimit(0)
+	, bUseWorkHoursUploadBandwidthLimit(false)
+	, WorkHoursUploadBandwidthLimit(1024)
+	, WorkHoursStartHour(9)
+	, WorkHoursEndHour(18)
+	, bWorkHoursOnWeekdaysOnly(true)
 {
 }
 
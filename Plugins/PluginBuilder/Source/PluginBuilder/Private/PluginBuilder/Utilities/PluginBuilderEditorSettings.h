@@ -19,6 +19,8 @@ UENUM()
 enum class ECloudStorageProvider : uint8
 {
 	OneDrive	UMETA(DisplayName = "OneDrive"),
+	S3			UMETA(DisplayName = "Amazon S3 / S3 Compatible"),
+	FileSystem	UMETA(DisplayName = "File System / Network Share"),
 };
 
 /**
@@ -72,10 +74,73 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Misc")
 	bool bStopPackagingProcessImmediately;
 
+	// The maximum number of builds and zips for different engine versions that run at the same time.
+	// Each build already uses all cores for compiling, so running more than one mainly overlaps the serial parts such as UAT startup and linking.
+	UPROPERTY(EditAnywhere, Config, Category = "Misc", meta = (ClampMin = 1, ClampMax = 8))
+	int32 MaxConcurrentUATTasks;
+
+	// Whether to write a trace of each packaging process to Saved/PluginBuilder/Traces, which can be opened in chrome://tracing or Perfetto.
+	// The trace shows when each task and phase ran, the CPU and memory used by UAT and each upload request.
+	UPROPERTY(EditAnywhere, Config, Category = "Misc")
+	bool bExportPackageTrace;
+
+	// How much longer or larger than the average of the last runs of the same plugin a task can get before it is reported as a regression, in percent.
+	// Each run writes a report with the time, CPU, memory and sizes of each task to Saved/PluginBuilder/RunReports.
+	UPROPERTY(EditAnywhere, Config, Category = "Misc", meta = (ClampMin = 1, Units = "Percent"))
+	int32 RegressionThresholdPercent;
+
+	// The addresses of the build workers that builds are sent to instead of being built on this machine, such as "192.168.0.10:9100".
+	// A build worker is started with "UnrealEditor-Cmd <Project> -run=PluginBuilderWorker -BindAddress=<Address> -Port=9100 -AccessToken=<Token>"
+	// on a machine that has the engine versions installed.
+	// The builds for the engine versions are spread over the workers in turn, and the built plugins are brought back here to be zipped.
+	UPROPERTY(EditAnywhere, Config, Category = "Build Workers")
+	TArray<FString> BuildWorkerAddresses;
+
+	// The access token that the build workers were started with.
+	// Building a plugin runs its build scripts, so a worker only accepts builds from packagers that know its token.
+	UPROPERTY(EditAnywhere, Config, Category = "Build Workers", meta = (PasswordField = true))
+	FString BuildWorkerAccessToken;
+
 	// The cloud storage provider to use when uploading packaged plugins.
 	UPROPERTY(EditAnywhere, Config, Category = "Cloud Storage")
 	ECloudStorageProvider CloudStorageProvider;
 
+	// Other cloud storage providers that packaged plugins are uploaded to at the same time.
+	// Each zip file is read from disk once and sent to every destination in parallel.
+	UPROPERTY(EditAnywhere, Config, Category = "Cloud Storage")
+	TArray<ECloudStorageProvider> AdditionalCloudStorageProviders;
+
+	// The maximum amount of file data in MB kept in memory while uploading to multiple destinations.
+	// A destination that gets this far ahead of the slowest one waits for it to catch up.
+	// A single read larger than this, such as a large S3 part, is still allowed once it is the only data kept in memory.
+	UPROPERTY(EditAnywhere, Config, Category = "Cloud Storage", meta = (ClampMin = 16, Units = "MB"))
+	int32 UploadReadCacheSize;
+
+	// The maximum upload speed in KB/s when uploading to cloud storage. 0 means unlimited.
+	UPROPERTY(EditAnywhere, Config, Category = "Cloud Storage|Bandwidth", meta = (ClampMin = 0, Units = "KB/s"))
+	int32 UploadBandwidthLimit;
+
+	// Whether to use a separate upload speed limit during work hours, so that uploads do not saturate the office network.
+	UPROPERTY(EditAnywhere, Config, Category = "Cloud Storage|Bandwidth")
+	bool bUseWorkHoursUploadBandwidthLimit;
+
+	// The maximum upload speed in KB/s during work hours. 0 means unlimited.
+	UPROPERTY(EditAnywhere, Config, Category = "Cloud Storage|Bandwidth", meta = (EditCondition = "bUseWorkHoursUploadBandwidthLimit", ClampMin = 0, Units = "KB/s"))
+	int32 WorkHoursUploadBandwidthLimit;
+
+	// The hour of the day (local time) at which work hours start.
+	UPROPERTY(EditAnywhere, Config, Category = "Cloud Storage|Bandwidth", meta = (EditCondition = "bUseWorkHoursUploadBandwidthLimit", ClampMin = 0, ClampMax = 23))
+	int32 WorkHoursStartHour;
+
+	// The hour of the day (local time) at which work hours end.
+	// If this is earlier than the start hour, work hours continue past midnight.
+	UPROPERTY(EditAnywhere, Config, Category = "Cloud Storage|Bandwidth", meta = (EditCondition = "bUseWorkHoursUploadBandwidthLimit", ClampMin = 0, ClampMax = 24))
+	int32 WorkHoursEndHour;
+
+	// Whether work hours apply only from Monday to Friday.
+	UPROPERTY(EditAnywhere, Config, Category = "Cloud Storage|Bandwidth", meta = (EditCondition = "bUseWorkHoursUploadBandwidthLimit"))
+	bool bWorkHoursOnWeekdaysOnly;
+
 public:
 	// Constructor.
 	UPluginBuilderEditorSettings();
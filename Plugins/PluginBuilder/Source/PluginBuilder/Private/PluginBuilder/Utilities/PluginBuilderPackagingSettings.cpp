@@ -10,6 +10,8 @@ UPluginBuilderPackagingSettings::UPluginBuilderPackagingSettings()
 	, bCreateSubFolder(false)
 	, bStrictIncludes(false)
 	, bUnversioned(false)
+	, bStopOnFirstBuildError(false)
+	, bBuildWithUBTDirectly(false)
 	, bZipUp(true)
 	, bOutputAllZipFilesToSingleFolder(false)
 	, bKeepBinariesFolder(false)
@@ -19,6 +21,7 @@ UPluginBuilderPackagingSettings::UPluginBuilderPackagingSettings()
 	, bAutoUploadAfterZip(false)
 	, bGetShareUrls(true)
 	, ConflictBehavior(EOneDriveConflictBehavior::Replace)
+	, bSkipIdenticalUploads(true)
 {
 }
 
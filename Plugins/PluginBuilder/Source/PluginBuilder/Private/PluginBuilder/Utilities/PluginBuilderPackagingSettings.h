@@ -69,6 +69,15 @@ public:
 	UPROPERTY(Config)
 	bool bUnversioned;
 
+	// Whether to skip the remaining builds and zips as soon as a compile error is found in the build for one engine version.
+	UPROPERTY(Config)
+	bool bStopOnFirstBuildError;
+
+	// Whether to build with UnrealBuildTool directly instead of the BuildPlugin command of UAT, for quick iteration builds.
+	// A host project is kept for each engine version so that only changed files are rebuilt.
+	UPROPERTY(Config)
+	bool bBuildWithUBTDirectly;
+
 	// Whether to create a zip file that contains only the files we need after the build.
 	UPROPERTY(Config)
 	bool bZipUp;
@@ -110,6 +119,11 @@ public:
 	UPROPERTY(Config)
 	EOneDriveConflictBehavior ConflictBehavior;
 
+	// Whether to skip uploading a file when the remote file with the same path has identical content.
+	// The comparison uses the content hash reported by the cloud storage provider, so only truly identical files are skipped.
+	UPROPERTY(Config)
+	bool bSkipIdenticalUploads;
+
 public:
 	// Constructor.
 	UPluginBuilderPackagingSettings();
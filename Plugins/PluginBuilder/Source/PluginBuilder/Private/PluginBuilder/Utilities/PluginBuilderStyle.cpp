@@ -5,6 +5,7 @@
 #include "PluginBuilder/PluginBuilderGlobals.h"
 #include "Styling/SlateStyleRegistry.h"
 #include "Styling/CoreStyle.h"
+#include "Async/Async.h"
 
 namespace PluginBuilder
 {
@@ -20,35 +21,85 @@ namespace PluginBuilder
 	{
 	}
 
-	void FPluginBuilderStyle::RegisterInternal()
+	FPluginBuilderStyle::~FPluginBuilderStyle()
 	{
-		const TArray<TSharedRef<IPlugin>> Plugins = IPluginManager::Get().GetDiscoveredPlugins();
-		for (const auto& Plugin : Plugins)
+		for (const FSlateBrush* RetiredBrush : RetiredBrushes)
 		{
-			const FName IconName = GetPropertyName(Plugin->GetFriendlyName());
-			FString IconPath = FPaths::ConvertRelativePathToFull(
-				Plugin->GetBaseDir() / TEXT("Resources") / TEXT("Icon128.png")
-			);
+			delete RetiredBrush;
+		}
+	}
 
+	const FString& FPluginBuilderStyle::GetDefaultIconPath()
+	{
+		if (!DefaultIconPath.IsSet())
+		{
+			FString Path;
 			const TSharedPtr<IPlugin> PluginBrowser = IPluginManager::Get().FindPlugin(TEXT("PluginBrowser"));
-			if (PluginBrowser.IsValid() && !FPaths::FileExists(IconPath))
+			if (PluginBrowser.IsValid())
 			{
-				IconPath = FPaths::ConvertRelativePathToFull(
+				Path = FPaths::ConvertRelativePathToFull(
 					PluginBrowser->GetBaseDir() / TEXT("Resources") / TEXT("DefaultIcon128.png")
 				);
 			}
-			
-			Set(
-				IconName,
-				new FSlateImageBrush(IconPath, CoreStyleConstants::Icon16x16)
-			);
+			DefaultIconPath = Path;
 		}
+
+		return DefaultIconPath.GetValue();
+	}
+
+	void FPluginBuilderStyle::RequestPluginIcon(const FString& PluginName, const FString& PluginBaseDir)
+	{
+		const FName IconName = GetPropertyName(PluginName);
+		if (RequestedIconNames.Contains(IconName))
+		{
+			return;
+		}
+		RequestedIconNames.Add(IconName);
+
+		const FString IconPath = FPaths::ConvertRelativePathToFull(
+			PluginBaseDir / TEXT("Resources") / TEXT("Icon128.png")
+		);
+
+		const FString& DefaultPath = GetDefaultIconPath();
+		if (DefaultPath.IsEmpty())
+		{
+			Set(IconName, new FSlateImageBrush(IconPath, CoreStyleConstants::Icon16x16));
+			return;
+		}
+
+		// The default icon is shown until the plugin's own icon is found, so that the menu does not wait for the disk.
+		Set(IconName, new FSlateImageBrush(DefaultPath, CoreStyleConstants::Icon16x16));
+
+		const TWeakPtr<FPluginBuilderStyle> WeakThis = Instance;
+		Async(EAsyncExecution::ThreadPool, [WeakThis, IconName, IconPath]()
+		{
+			if (!FPaths::FileExists(IconPath))
+			{
+				return;
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, IconName, IconPath]()
+			{
+				if (const TSharedPtr<FPluginBuilderStyle> This = WeakThis.Pin())
+				{
+					This->HandleOnIconFileFound(IconName, IconPath);
+				}
+			});
+		});
+	}
+
+	void FPluginBuilderStyle::HandleOnIconFileFound(const FName IconName, const FString& IconPath)
+	{
+		if (const FSlateBrush* DefaultBrush = GetOptionalBrush(IconName, nullptr, nullptr))
+		{
+			RetiredBrushes.Add(DefaultBrush);
+		}
+		Set(IconName, new FSlateImageBrush(IconPath, CoreStyleConstants::Icon16x16));
 	}
 
 	void FPluginBuilderStyle::Register()
 	{
 		Instance = MakeShared<FPluginBuilderStyle>();
-		Instance->RegisterInternal();
 		FSlateStyleRegistry::RegisterSlateStyle(*Instance);
 	}
 
@@ -64,9 +115,18 @@ namespace PluginBuilder
 		return *Instance.Get();
 	}
 
-	FName FPluginBuilderStyle::GetPropertyName(const FString& PluginFriendlyName)
+	FSlateIcon FPluginBuilderStyle::GetPluginIcon(const FString& PluginName, const FString& PluginBaseDir)
+	{
+		check(IsInGameThread());
+		check(Instance.IsValid()); // Don't call before Register is called or after Unregister is called.
+
+		Instance->RequestPluginIcon(PluginName, PluginBaseDir);
+		return FSlateIcon(Instance->GetStyleSetName(), GetPropertyName(PluginName));
+	}
+
+	FName FPluginBuilderStyle::GetPropertyName(const FString& PluginName)
 	{
-		return *FString::Printf(TEXT("%s.Icons.%s"), TEXT(UE_PLUGIN_NAME), *PluginFriendlyName);
+		return *FString::Printf(TEXT("%s.Icons.%s"), TEXT(UE_PLUGIN_NAME), *PluginName);
 	}
 
 	TSharedPtr<FPluginBuilderStyle> FPluginBuilderStyle::Instance = nullptr;
@@ -4,11 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "Styling/SlateStyle.h"
+#include "Textures/SlateIcon.h"
 
 namespace PluginBuilder
 {
 	/**
 	 * A class that manages the slate icon used by this plugin.
+	 * The brush of a plugin icon is only created the first time the icon is requested. It shows the default plugin
+	 * icon until a background check finds the plugin's own icon file, so that neither startup nor menus touch the disk.
 	 */
 	class PLUGINBUILDER_API FPluginBuilderStyle : public FSlateStyleSet
 	{
@@ -16,9 +19,18 @@ namespace PluginBuilder
 		// Constructor.
 		FPluginBuilderStyle();
 
+		// Destructor.
+		virtual ~FPluginBuilderStyle() override;
+
 	private:
-		// The actual registration process for this class.
-		void RegisterInternal();
+		// Returns the path of the default plugin icon, which is looked up only once.
+		const FString& GetDefaultIconPath();
+
+		// Registers the brush of the plugin icon if it has not been registered yet.
+		void RequestPluginIcon(const FString& PluginName, const FString& PluginBaseDir);
+
+		// Replaces the default brush of a plugin icon once the plugin's own icon file has been found.
+		void HandleOnIconFileFound(const FName IconName, const FString& IconPath);
 		
 	public:
 		// Registers-Unregisters and instance getter this class.
@@ -26,11 +38,23 @@ namespace PluginBuilder
 		static void Unregister();
 		static const ISlateStyle& Get();
 
+		// Returns the icon of the plugin with the specified name, registering its brush the first time it is requested.
+		static FSlateIcon GetPluginIcon(const FString& PluginName, const FString& PluginBaseDir);
+
 		// Gets the registered name of the icon from the plugin name.
-		static FName GetPropertyName(const FString& PluginFriendlyName);
+		static FName GetPropertyName(const FString& PluginName);
 		
 	private:
 		// The instance of this style class.
 		static TSharedPtr<FPluginBuilderStyle> Instance;
+
+		// The names of the plugin icons whose brushes have been registered.
+		TSet<FName> RequestedIconNames;
+
+		// The path of the default plugin icon, once it has been looked up.
+		TOptional<FString> DefaultIconPath;
+
+		// The brushes replaced by the plugin's own icon, which are kept alive because widgets may still point to them.
+		TArray<const FSlateBrush*> RetiredBrushes;
 	};
 }
@@ -0,0 +1,136 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/PluginDependencyGraph.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace PluginBuilder
+{
+	FPluginDependencyGraph::FPluginDependencyGraph(const TArray<FPackagePluginParams>& ParamsList)
+	{
+		// The plugin references in descriptors use the name of the descriptor file rather than the friendly name.
+		PluginNames.Reserve(ParamsList.Num());
+		for (const FPackagePluginParams& Params : ParamsList)
+		{
+			PluginNames.Add(FPaths::GetBaseFilename(Params.UATBatchFileParams.UPluginFile));
+		}
+
+		Dependencies.SetNum(ParamsList.Num());
+		for (int32 PluginIndex = 0; PluginIndex < ParamsList.Num(); PluginIndex++)
+		{
+			for (const FString& ReferencedPluginName : ReadPluginReferences(ParamsList[PluginIndex].UATBatchFileParams.UPluginFile))
+			{
+				const int32 DependencyIndex = PluginNames.IndexOfByKey(ReferencedPluginName);
+				if ((DependencyIndex != INDEX_NONE) && (DependencyIndex != PluginIndex))
+				{
+					Dependencies[PluginIndex].AddUnique(DependencyIndex);
+				}
+			}
+		}
+	}
+
+	const TArray<int32>& FPluginDependencyGraph::GetDependencies(const int32 PluginIndex) const
+	{
+		check(Dependencies.IsValidIndex(PluginIndex));
+		return Dependencies[PluginIndex];
+	}
+
+	FString FPluginDependencyGraph::FindCycle() const
+	{
+		// A depth-first search that finds a plugin which is still on the path when it is reached again.
+		enum class EVisitState : uint8
+		{
+			NotVisited,
+			OnPath,
+			Done,
+		};
+		TArray<EVisitState> VisitStates;
+		VisitStates.Init(EVisitState::NotVisited, Dependencies.Num());
+		TArray<int32> Path;
+
+		TFunction<bool(int32)> Visit = [&](const int32 PluginIndex) -> bool
+		{
+			VisitStates[PluginIndex] = EVisitState::OnPath;
+			Path.Add(PluginIndex);
+			for (const int32 DependencyIndex : Dependencies[PluginIndex])
+			{
+				if (VisitStates[DependencyIndex] == EVisitState::OnPath)
+				{
+					Path.Add(DependencyIndex);
+					return true;
+				}
+				if ((VisitStates[DependencyIndex] == EVisitState::NotVisited) && Visit(DependencyIndex))
+				{
+					return true;
+				}
+			}
+			Path.Pop();
+			VisitStates[PluginIndex] = EVisitState::Done;
+			return false;
+		};
+
+		for (int32 PluginIndex = 0; PluginIndex < Dependencies.Num(); PluginIndex++)
+		{
+			if ((VisitStates[PluginIndex] != EVisitState::NotVisited) || !Visit(PluginIndex))
+			{
+				continue;
+			}
+
+			// The path starts from where the search began, so only the part from the first visit of the repeated plugin is the cycle.
+			const int32 CycleStartIndex = Path.IndexOfByKey(Path.Last());
+			TArray<FString> CycleNames;
+			for (int32 PathIndex = CycleStartIndex; PathIndex < Path.Num(); PathIndex++)
+			{
+				CycleNames.Add(PluginNames[Path[PathIndex]]);
+			}
+			return FString::Join(CycleNames, TEXT(" -> "));
+		}
+
+		return FString();
+	}
+
+	TArray<FString> FPluginDependencyGraph::ReadPluginReferences(const FString& UPluginFile)
+	{
+		TArray<FString> ReferencedPluginNames;
+
+		FString UPluginContents;
+		TSharedPtr<FJsonObject> UPluginObject;
+		if (!FFileHelper::LoadFileToString(UPluginContents, *UPluginFile) ||
+			!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(UPluginContents), UPluginObject) ||
+			!UPluginObject.IsValid())
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Could not read the plugin references of %s."), *UPluginFile);
+			return ReferencedPluginNames;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* PluginValues = nullptr;
+		if (!UPluginObject->TryGetArrayField(TEXT("Plugins"), PluginValues))
+		{
+			return ReferencedPluginNames;
+		}
+
+		for (const TSharedPtr<FJsonValue>& PluginValue : *PluginValues)
+		{
+			const TSharedPtr<FJsonObject>* PluginObject = nullptr;
+			if (!PluginValue.IsValid() || !PluginValue->TryGetObject(PluginObject))
+			{
+				continue;
+			}
+
+			FString Name;
+			bool bEnabled = false;
+			if ((*PluginObject)->TryGetStringField(TEXT("Name"), Name) &&
+				(*PluginObject)->TryGetBoolField(TEXT("Enabled"), bEnabled) &&
+				bEnabled)
+			{
+				ReferencedPluginNames.Add(Name);
+			}
+		}
+
+		return ReferencedPluginNames;
+	}
+}
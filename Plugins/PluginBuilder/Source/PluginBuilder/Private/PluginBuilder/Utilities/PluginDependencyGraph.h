@@ -0,0 +1,36 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/Types/PackagePluginParams.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * The dependencies between the plugins packaged together, read from the Plugins array of their descriptors.
+	 * Only references to other plugins in the same list are kept, since the others are built elsewhere, such as engine plugins.
+	 */
+	class FPluginDependencyGraph
+	{
+	public:
+		// Constructor. Reads the descriptor of each plugin in the list.
+		explicit FPluginDependencyGraph(const TArray<FPackagePluginParams>& ParamsList);
+
+		// Returns the indices in the list of the plugins that the plugin references directly.
+		const TArray<int32>& GetDependencies(int32 PluginIndex) const;
+
+		// Returns the plugins that depend on each other in a cycle, such as "A -> B -> A", or empty if there is none.
+		FString FindCycle() const;
+
+		// Returns the names of the enabled plugins referenced by the descriptor, such as "EnhancedInput".
+		static TArray<FString> ReadPluginReferences(const FString& UPluginFile);
+
+	private:
+		// The names of the plugins in the list, which are the base names of their descriptors.
+		TArray<FString> PluginNames;
+
+		// The indices of the plugins each plugin references directly.
+		TArray<TArray<int32>> Dependencies;
+	};
+}
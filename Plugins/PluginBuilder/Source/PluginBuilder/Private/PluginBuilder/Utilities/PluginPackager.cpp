@@ -4,6 +4,8 @@
 #include "PluginBuilder/Tasks/IPluginBuilderTask.h"
 #include "PluginBuilder/Tasks/IUATBatchFileTask.h"
 #include "PluginBuilder/Tasks/BuildPluginTask.h"
+#include "PluginBuilder/Tasks/DirectBuildPluginTask.h"
+#include "PluginBuilder/Tasks/RemoteBuildPluginTask.h"
 #include "PluginBuilder/Tasks/ZipUpPluginTask.h"
 #include "PluginBuilder/Tasks/UploadToCloudTask.h"
 #include "PluginBuilder/Types/BuildTargets.h"
@@ -11,12 +13,20 @@
 #include "PluginBuilder/CloudStorages/CloudStorageManager.h"
 #include "PluginBuilder/CloudStorages/ICloudStorageProvider.h"
 #include "PluginBuilder/Utilities/PluginBuilderSettings.h"
+#include "PluginBuilder/Utilities/TaskTimingDatabase.h"
+#include "PluginBuilder/Utilities/PackageTrace.h"
+#include "PluginBuilder/Utilities/RunReportHistory.h"
+#include "PluginBuilder/Utilities/PluginBuilderEditorSettings.h"
+#include "PluginBuilder/Utilities/BuildMonitor.h"
+#include "PluginBuilder/Utilities/PluginDependencyGraph.h"
+#include "PluginBuilder/Widgets/SBuildMonitor.h"
 #include "PluginBuilder/PluginBuilderGlobals.h"
 #include "DesktopPlatformModule.h"
 #include "HAL/PlatformFileManager.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Framework/Docking/TabManager.h"
 #include "Editor.h"
+#include "HAL/IConsoleManager.h"
 #if UE_5_01_OR_LATER
 #include "OutputLogModule.h"
 #endif
@@ -26,12 +36,18 @@
 namespace PluginBuilder
 {
 	DECLARE_STATS_GROUP(TEXT("PackagePluginTask"), STATGROUP_PackagePluginTask, STATCAT_Advanced);
+
+	namespace PluginPackager
+	{
+		// The name of the console command that packages several plugins together.
+		static const TCHAR* CommandName = TEXT("PluginBuilder.PackagePlugins");
+	}
 	
 	bool FPluginPackager::StartPackagePluginTask(const TOptional<FPackagePluginParams>& InParams /* = {} */)
 	{
 		if (IsPackagePluginTaskRunning())
 		{
-			UE_LOG(LogPluginBuilder, Warning, TEXT("A package plugin task is currently running. (plugin in package : %s)"), *Instance->Params.UATBatchFileParams.PluginFriendlyName);
+			UE_LOG(LogPluginBuilder, Warning, TEXT("A package plugin task is currently running. (plugin in package : %s)"), *Instance->RunName);
 			return false;
 		}
 
@@ -48,36 +64,103 @@ namespace PluginBuilder
             	return false;
             }
 		}
-		if (!ParamsToPass.IsValid())
+
+		return StartBatchPackagePluginTask(TArray<FPackagePluginParams>{ ParamsToPass });
+	}
+
+	bool FPluginPackager::StartBatchPackagePluginTask(const TArray<FPackagePluginParams>& InParamsList)
+	{
+		if (IsPackagePluginTaskRunning())
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("A package plugin task is currently running. (plugin in package : %s)"), *Instance->RunName);
+			return false;
+		}
+
+		if (InParamsList.Num() == 0)
 		{
-			UE_LOG(LogPluginBuilder, Warning, TEXT("The specified plugin does not exist, or an invalid value is specified for the engine versions."));
+			UE_LOG(LogPluginBuilder, Warning, TEXT("No plugin to package was specified."));
 			return false;
 		}
 
-		if (!ParamsToPass.UATBatchFileParams.OutputDirectoryPath.IsSet())
+		TArray<FPackagePluginParams> ParamsListToPass = InParamsList;
+		TSet<FString> PluginFriendlyNames;
+		for (const FPackagePluginParams& ParamsToPass : ParamsListToPass)
 		{
-			if (IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get())
+			if (!ParamsToPass.IsValid())
 			{
-				FString OutputDirectoryPath;
-				const bool bWasSelected = DesktopPlatform->OpenDirectoryDialog(
-					FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr),
-					TEXT("Select Output Directory"),
-					FPaths::ProjectDir(),
-					OutputDirectoryPath
-				);
-				if (bWasSelected)
+				UE_LOG(LogPluginBuilder, Warning, TEXT("The specified plugin (%s) does not exist, or an invalid value is specified for the engine versions."), *ParamsToPass.UATBatchFileParams.PluginFriendlyName);
+				return false;
+			}
+
+			// The packages of the same plugin would be written to the same directories.
+			bool bIsAlreadyInSet = false;
+			PluginFriendlyNames.Add(ParamsToPass.UATBatchFileParams.PluginFriendlyName, &bIsAlreadyInSet);
+			if (bIsAlreadyInSet)
+			{
+				UE_LOG(LogPluginBuilder, Warning, TEXT("The plugin %s is specified more than once."), *ParamsToPass.UATBatchFileParams.PluginFriendlyName);
+				return false;
+			}
+		}
+
+		// The output directory is asked only once for all plugins that don't specify one.
+		TOptional<FString> SelectedOutputDirectoryPath;
+		for (FPackagePluginParams& ParamsToPass : ParamsListToPass)
+		{
+			if (ParamsToPass.UATBatchFileParams.OutputDirectoryPath.IsSet())
+			{
+				continue;
+			}
+
+			if (!SelectedOutputDirectoryPath.IsSet())
+			{
+				if (IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get())
 				{
-					ParamsToPass.UATBatchFileParams.OutputDirectoryPath = OutputDirectoryPath;
+					FString OutputDirectoryPath;
+					const bool bWasSelected = DesktopPlatform->OpenDirectoryDialog(
+						FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr),
+						TEXT("Select Output Directory"),
+						FPaths::ProjectDir(),
+						OutputDirectoryPath
+					);
+					if (bWasSelected)
+					{
+						SelectedOutputDirectoryPath = OutputDirectoryPath;
+					}
 				}
 			}
+			if (!SelectedOutputDirectoryPath.IsSet())
+			{
+				return false;
+			}
+
+			ParamsToPass.UATBatchFileParams.OutputDirectoryPath = SelectedOutputDirectoryPath;
+		}
+
+		if (ParamsListToPass.Num() > 1)
+		{
+			for (FPackagePluginParams& ParamsToPass : ParamsListToPass)
+			{
+				ParamsToPass.UATBatchFileParams.bIncludePluginNameInTaskLabel = true;
+			}
 		}
-		if (!ParamsToPass.UATBatchFileParams.OutputDirectoryPath.IsSet())
+
+		// The list is not reordered, since the first parameters hold the settings of the whole process.
+		const FPluginDependencyGraph DependencyGraph(ParamsListToPass);
+		const FString Cycle = DependencyGraph.FindCycle();
+		if (!Cycle.IsEmpty())
 		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("The plugins depend on each other in a cycle, so none of them can be built first. (%s)"), *Cycle);
 			return false;
 		}
 
+		LastDiagnostics.Reset();
+		LastRunReport = FPackageRunReport();
 		Instance = MakeUnique<FPluginPackager>();
-		Instance->Params = ParamsToPass;
+		for (int32 PluginIndex = 0; PluginIndex < ParamsListToPass.Num(); PluginIndex++)
+		{
+			Instance->PluginDependencies.Add(DependencyGraph.GetDependencies(PluginIndex));
+		}
+		Instance->PluginParamsList = MoveTemp(ParamsListToPass);
 		Instance->Initialize();
 
 		return true;
@@ -149,13 +232,25 @@ namespace PluginBuilder
 			return false;
 		}
 
+		LastDiagnostics.Reset();
+		LastRunReport = FPackageRunReport();
 		Instance = MakeUnique<FPluginPackager>();
-		Instance->Params.UATBatchFileParams.PluginFriendlyName = InPluginName;
+		FPackagePluginParams& Params = Instance->PluginParamsList.AddDefaulted_GetRef();
+		Params.UATBatchFileParams.PluginFriendlyName = InPluginName;
+		Params.bExportPackageTrace = GetSettings<UPluginBuilderEditorSettings>().bExportPackageTrace;
+		Params.RegressionThresholdPercent = GetSettings<UPluginBuilderEditorSettings>().RegressionThresholdPercent;
+		Instance->RunName = InPluginName;
+		Instance->StartTrace();
 		Instance->Tasks.Add(
 			MakeShared<FUploadToCloudTask>(InZipFilePaths, InPackagedPluginsPath, InPluginName, bInGetShareUrls)
 		);
+		Instance->TaskPluginIndices.Add(&Instance->Tasks[0].Get(), 0);
 		Instance->TotalTaskCount = 1;
+		Instance->RemainingUploadCount = 1;
 		Instance->bIsUploadOnlyMode = true;
+		Instance->PredictTaskTimes();
+		Instance->HandleOnTaskTransition();
+		FBuildMonitor::BeginRun(InPluginName, Instance->Tasks, Instance->ExpectedTaskTimes);
 
 		PendingNotificationHandle = FEditorNotification::Pending(
 			FText::Format(
@@ -169,6 +264,11 @@ namespace PluginBuilder
 					LOCTEXT("ShowOutputLogLinkText", "Show Output Log"),
 					FSimpleDelegate::CreateStatic(&FPluginPackager::OpenOutputLog)
 				),
+				FEditorNotificationInteraction(
+					LOCTEXT("BuildMonitorButtonLabel", "Build Monitor"),
+					LOCTEXT("BuildMonitorButtonTooltip", "Opens the tab that shows the progress, output and diagnostics of each task."),
+					FSimpleDelegate::CreateStatic(&SBuildMonitor::OpenTab)
+				),
 				FEditorNotificationInteraction(
 					LOCTEXT("CancelButtonLabel", "Cancel"),
 					LOCTEXT("CancelUploadButtonTooltip", "Cancels the OneDrive upload process."),
@@ -188,65 +288,115 @@ namespace PluginBuilder
 		return Instance.IsValid();
 	}
 
+	const TArray<FBuildDiagnostics>& FPluginPackager::GetLastDiagnostics()
+	{
+		return LastDiagnostics;
+	}
+
+	const FPackageRunReport& FPluginPackager::GetLastRunReport()
+	{
+		return LastRunReport;
+	}
+
 	void FPluginPackager::CleanupStatics()
 	{
 		Instance.Reset();
 		PendingNotificationHandle = FEditorNotificationHandle{};
+		LastDiagnostics.Empty();
+		LastRunReport = FPackageRunReport();
+		FPackageTrace::Get().Stop();
 	}
 
-	void FPluginPackager::Tick(float DeltaTime)
+	void FPluginPackager::RegisterConsoleCommand()
 	{
-		check(Tasks.IsValidIndex(0));
-		const TSharedRef<IPluginBuilderTask>& Task = Tasks[0];
+		ConsoleCommand = IConsoleManager::Get().RegisterConsoleCommand(
+			PluginPackager::CommandName,
+			TEXT("Packages several plugins together, sharing the builds, zips and uploads of all of them in one task pool. ")
+			TEXT("Usage: PluginBuilder.PackagePlugins <PluginFriendlyName> [<PluginFriendlyName>...]. ")
+			TEXT("The other parameters are taken from the editor preferences."),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&FPluginPackager::HandleOnConsoleCommand),
+			ECVF_Default
+		);
+	}
 
-		if (Task->GetState() == IPluginBuilderTask::EState::PreInitialize)
+	void FPluginPackager::UnregisterConsoleCommand()
+	{
+		if (ConsoleCommand != nullptr)
 		{
-			Task->Initialize();
+			IConsoleManager::Get().UnregisterConsoleObject(ConsoleCommand);
+			ConsoleCommand = nullptr;
 		}
-		if (Task->GetState() == IPluginBuilderTask::EState::Processing)
+	}
+
+	void FPluginPackager::Tick(float DeltaTime)
+	{
+		check(Tasks.Num() > 0);
+
+		bool bHasAnyTaskFinished = false;
 		{
-			Task->Tick(DeltaTime);
+			StartReadyTasks();
 
-			if (Task->GetState() == IPluginBuilderTask::EState::Processing)
+			// Holds copies of the references as finished tasks are removed from the list while processing.
+			// They are released before Terminate, since a build task must not outlive the zip task waiting for it.
+			const TArray<TSharedRef<IPluginBuilderTask>> RunningTasks = GetRunningTasks();
+			if ((RunningTasks.Num() == 0) && (Tasks.Num() > 0) && !bWasCanceled)
 			{
-				NotificationUpdateTimer += DeltaTime;
-				if (!bWasCanceled && PendingNotificationHandle.IsValid() && (NotificationUpdateTimer >= NotificationUpdateInterval))
+				UE_LOG(LogPluginBuilder, Error, TEXT("None of the remaining %d task(s) can start."), Tasks.Num());
+				bHasAnyError = true;
+				for (const TSharedRef<IPluginBuilderTask>& Task : Tasks)
 				{
-					NotificationUpdateTimer = 0.f;
-					PendingNotificationHandle.SetText(BuildNotificationText(Task));
+					FBuildMonitor::NotifyTaskFinished(Task, EBuildMonitorTaskState::Skipped);
 				}
-			}
-		}
-		if (Task->GetState() == IPluginBuilderTask::EState::PreTerminate)
-		{
-			Task->Terminate();
-		}
-		if (Task->GetState() == IPluginBuilderTask::EState::Terminated)
-		{
-			if (Task->HasAnyError())
-			{
-				bHasAnyError = true;
+				Tasks.Empty();
 			}
 
-			if (bWasCanceled)
+			for (const TSharedRef<IPluginBuilderTask>& Task : RunningTasks)
 			{
-				Tasks.Empty();
+				if (Task->GetState() == IPluginBuilderTask::EState::Processing)
+				{
+					Task->Tick(DeltaTime);
+
+					if (ShouldSkipRemainingTasks(Task))
+					{
+						SkipRemainingTasks(
+							GetPluginIndex(Task),
+							FString::Printf(TEXT("A build error was found in %s"), *Task->GetTaskLabel())
+						);
+					}
+				}
+				if (Task->GetState() == IPluginBuilderTask::EState::PreTerminate)
+				{
+					Task->Terminate();
+				}
+				if (Task->GetState() == IPluginBuilderTask::EState::Terminated)
+				{
+					FinishTask(Task);
+					bHasAnyTaskFinished = true;
+				}
 			}
-			else
-			{
-				Tasks.RemoveAt(0);
 
-				if ((Tasks.Num() > 0) && PendingNotificationHandle.IsValid())
+			// After cancellation no more tasks start, and the pending ones are dropped once the running ones have finished.
+			if (bWasCanceled && (InitializedTasks.Num() == 0))
+			{
+				for (const TSharedRef<IPluginBuilderTask>& Task : Tasks)
 				{
-					NotificationUpdateTimer = 0.f;
-					PendingNotificationHandle.SetText(BuildNotificationText(Tasks[0]));
+					FBuildMonitor::NotifyTaskFinished(Task, EBuildMonitorTaskState::Canceled);
 				}
+				Tasks.Empty();
 			}
 		}
 
 		if (Tasks.Num() == 0)
 		{
 			Terminate();
+			return;
+		}
+
+		NotificationUpdateTimer += DeltaTime;
+		if (!bWasCanceled && PendingNotificationHandle.IsValid() && (bHasAnyTaskFinished || (NotificationUpdateTimer >= NotificationUpdateInterval)))
+		{
+			NotificationUpdateTimer = 0.f;
+			UpdateNotificationText();
 		}
 	}
 
@@ -272,51 +422,25 @@ namespace PluginBuilder
 
 	void FPluginPackager::Initialize()
 	{
-		for (const auto& EngineVersion : Params.EngineVersions)
+		const FUATBatchFileParams& FirstUATBatchFileParams = PluginParamsList[0].UATBatchFileParams;
+		if (PluginParamsList.Num() == 1)
 		{
-			TSharedPtr<FBuildPluginTask> BuildPluginTask = nullptr;
-			if (Params.BuildPluginParams.IsSet())
-			{
-				BuildPluginTask = MakeShared<FBuildPluginTask>(
-					EngineVersion,
-					Params.UATBatchFileParams,
-					Params.BuildPluginParams.GetValue()
-				);
-				Tasks.Add(BuildPluginTask.ToSharedRef());
-			}
-
-			if (Params.ZipUpPluginParams.IsSet())
-			{
-				TSharedPtr<FZipUpPluginTask> ZipTask = MakeShared<FZipUpPluginTask>(
-					EngineVersion,
-					Params.UATBatchFileParams,
-					Params.ZipUpPluginParams.GetValue(),
-					BuildPluginTask
-				);
-				Tasks.Add(ZipTask.ToSharedRef());
-				ZipTaskRefs.Add(ZipTask);
-			}
+			RunName = FString::Printf(TEXT("%s (%s)"), *FirstUATBatchFileParams.PluginFriendlyName, *FirstUATBatchFileParams.PluginVersionName);
+		}
+		else
+		{
+			RunName = FString::Printf(TEXT("%d plugins"), PluginParamsList.Num());
 		}
 
-		// Add cloud upload task when params request it and zip files will be produced.
-		if (Params.CloudStorageParams.IsSet() && (ZipTaskRefs.Num() > 0))
+		StartTrace();
+
+		TArray<TMap<FString, TSharedPtr<IUATBatchFileTask>>> BuildTasksOfPlugins;
+		BuildTasksOfPlugins.SetNum(PluginParamsList.Num());
+		for (int32 PluginIndex = 0; PluginIndex < PluginParamsList.Num(); PluginIndex++)
 		{
-			TSharedPtr<ICloudStorageProvider> Provider = FCloudStorageManager::GetCurrentProvider();
-			if (Provider.IsValid() && Provider->IsAuthenticated())
-			{
-				const FString PackagedPluginsPath = Params.UATBatchFileParams.OutputDirectoryPath.Get(FPaths::ProjectDir()) / TEXT("PackagedPlugins");
-				Tasks.Add(MakeShared<FUploadToCloudTask>(
-					ZipTaskRefs,
-					PackagedPluginsPath,
-					Params.UATBatchFileParams.GetPluginNameInSpecifiedFormat(),
-					Params.CloudStorageParams.GetValue().bGetShareUrls
-				));
-			}
-			else
-			{
-				UE_LOG(LogPluginBuilder, Warning, TEXT("Cloud storage upload skipped: not authenticated."));
-			}
+			AddPluginTasks(PluginIndex, BuildTasksOfPlugins[PluginIndex]);
 		}
+		LinkDependentBuildTasks(BuildTasksOfPlugins);
 
 		TotalTaskCount = Tasks.Num();
 
@@ -335,6 +459,10 @@ namespace PluginBuilder
 				TotalUploadCount++;
 			}
 		}
+		RemainingBuildCount = TotalBuildCount;
+		RemainingZipCount = TotalZipCount;
+		RemainingUploadCount = TotalUploadCount;
+
 		TArray<FString> TaskCountParts;
 		if (TotalBuildCount > 0)
 		{
@@ -348,13 +476,22 @@ namespace PluginBuilder
 		{
 			TaskCountParts.Add(FString::Printf(TEXT("%d %s"), TotalUploadCount, (TotalUploadCount == 1) ? TEXT("Upload") : TEXT("Uploads")));
 		}
-		const FString TaskCountText = FString::Join(TaskCountParts, TEXT(", "));
+		FString TaskCountText = FString::Join(TaskCountParts, TEXT(", "));
+
+		PredictTaskTimes();
+		SortTasksByExpectedTime();
+		HandleOnTaskTransition();
+		FBuildMonitor::BeginRun(RunName, Tasks, ExpectedTaskTimes);
+		const double ExpectedTime = ExpectedRemainingTimeAtTransition;
+		if (ExpectedTime >= 0.0)
+		{
+			TaskCountText += FString::Printf(TEXT(", ETA %s"), *FormatDuration(ExpectedTime));
+		}
 
 		PendingNotificationHandle = FEditorNotification::Pending(
 			FText::Format(
-				LOCTEXT("NotificationTextFormat", "Preparing...\r\n{0} ({1})\r\n{2}"),
-				FText::FromString(Params.UATBatchFileParams.PluginFriendlyName),
-				FText::FromString(Params.UATBatchFileParams.PluginVersionName),
+				LOCTEXT("NotificationTextFormat", "Preparing...\r\n{0}\r\n{1}"),
+				FText::FromString(RunName),
 				FText::FromString(TaskCountText)
 			),
 			0.f,
@@ -364,6 +501,12 @@ namespace PluginBuilder
 					LOCTEXT("ShowOutputLogLinkText", "Show Output Log"),
 					FSimpleDelegate::CreateStatic(&FPluginPackager::OpenOutputLog)
 				),
+				// Build Monitor Button.
+				FEditorNotificationInteraction(
+					LOCTEXT("BuildMonitorButtonLabel", "Build Monitor"),
+					LOCTEXT("BuildMonitorButtonTooltip", "Opens the tab that shows the progress, output and diagnostics of each task."),
+					FSimpleDelegate::CreateStatic(&SBuildMonitor::OpenTab)
+				),
 				// Cancel Button.
 				FEditorNotificationInteraction(
 					LOCTEXT("CancelButtonLabel", "Cancel"),
@@ -377,16 +520,208 @@ namespace PluginBuilder
 		GEditor->PlayEditorSound(TEXT("/Engine/EditorSounds/Notifications/CompileStart_Cue.CompileStart_Cue"));
 
 #if UE_5_01_OR_LATER
-		if (Params.bShowOnlyLogsFromThisPluginWhenPackageProcessStarts)
+		if (GetRunParams().bShowOnlyLogsFromThisPluginWhenPackageProcessStarts)
 		{
 			FOutputLogModule::Get().UpdateOutputLogFilter(TArray<FName>{ LogPluginBuilder.GetCategoryName() });
 		}
 #endif
 	}
 
+	void FPluginPackager::AddPluginTasks(const int32 PluginIndex, TMap<FString, TSharedPtr<IUATBatchFileTask>>& OutBuildTasks)
+	{
+		const FPackagePluginParams& Params = PluginParamsList[PluginIndex];
+		const int32 FirstTaskIndex = Tasks.Num();
+
+		// The upload task of each plugin only waits for the zip tasks of that plugin.
+		TArray<TSharedPtr<FZipUpPluginTask>> PluginZipTasks;
+		for (const auto& EngineVersion : Params.EngineVersions)
+		{
+			TSharedPtr<IUATBatchFileTask> BuildPluginTask = nullptr;
+			if (Params.BuildPluginParams.IsSet())
+			{
+				const TArray<FString>& BuildWorkerAddresses = Params.BuildPluginParams->BuildWorkerAddresses;
+				if (BuildWorkerAddresses.Num() > 0)
+				{
+					BuildPluginTask = MakeShared<FRemoteBuildPluginTask>(
+						EngineVersion,
+						Params.UATBatchFileParams,
+						Params.BuildPluginParams.GetValue(),
+						BuildWorkerAddresses[NextBuildWorkerIndex++ % BuildWorkerAddresses.Num()]
+					);
+				}
+				else if (Params.BuildPluginParams->bBuildWithUBTDirectly)
+				{
+					BuildPluginTask = MakeShared<FDirectBuildPluginTask>(
+						EngineVersion,
+						Params.UATBatchFileParams,
+						Params.BuildPluginParams.GetValue()
+					);
+				}
+				else
+				{
+					BuildPluginTask = MakeShared<FBuildPluginTask>(
+						EngineVersion,
+						Params.UATBatchFileParams,
+						Params.BuildPluginParams.GetValue()
+					);
+				}
+				Tasks.Add(BuildPluginTask.ToSharedRef());
+				OutBuildTasks.Add(EngineVersion, BuildPluginTask);
+			}
+
+			if (Params.ZipUpPluginParams.IsSet())
+			{
+				TSharedPtr<FZipUpPluginTask> ZipTask = MakeShared<FZipUpPluginTask>(
+					EngineVersion,
+					Params.UATBatchFileParams,
+					Params.ZipUpPluginParams.GetValue(),
+					BuildPluginTask
+				);
+				Tasks.Add(ZipTask.ToSharedRef());
+				ZipTaskRefs.Add(ZipTask);
+				PluginZipTasks.Add(ZipTask);
+			}
+		}
+
+		// Add cloud upload task when params request it and zip files will be produced.
+		if (Params.CloudStorageParams.IsSet() && (PluginZipTasks.Num() > 0))
+		{
+			TSharedPtr<ICloudStorageProvider> Provider = FCloudStorageManager::GetCurrentProvider();
+			if (Provider.IsValid() && Provider->IsAuthenticated())
+			{
+				const FString PackagedPluginsPath = Params.UATBatchFileParams.OutputDirectoryPath.Get(FPaths::ProjectDir()) / TEXT("PackagedPlugins");
+				const TSharedRef<FUploadToCloudTask> UploadTask = MakeShared<FUploadToCloudTask>(
+					PluginZipTasks,
+					PackagedPluginsPath,
+					Params.UATBatchFileParams.GetPluginNameInSpecifiedFormat(),
+					Params.CloudStorageParams.GetValue().bGetShareUrls
+				);
+				UploadTask->SetIncludePluginNameInTaskLabel(Params.UATBatchFileParams.bIncludePluginNameInTaskLabel);
+				Tasks.Add(UploadTask);
+			}
+			else
+			{
+				UE_LOG(LogPluginBuilder, Warning, TEXT("Cloud storage upload skipped: not authenticated. (%s)"), *Params.UATBatchFileParams.PluginFriendlyName);
+			}
+		}
+
+		for (int32 TaskIndex = FirstTaskIndex; TaskIndex < Tasks.Num(); TaskIndex++)
+		{
+			TaskPluginIndices.Add(&Tasks[TaskIndex].Get(), PluginIndex);
+		}
+	}
+
+	void FPluginPackager::LinkDependentBuildTasks(const TArray<TMap<FString, TSharedPtr<IUATBatchFileTask>>>& BuildTasksOfPlugins)
+	{
+		bool bHasAnyBinariesNotReused = false;
+		for (int32 PluginIndex = 0; PluginIndex < PluginParamsList.Num(); PluginIndex++)
+		{
+			const FPackagePluginParams& Params = PluginParamsList[PluginIndex];
+			for (const int32 DependencyIndex : PluginDependencies[PluginIndex])
+			{
+				const FPackagePluginParams& DependencyParams = PluginParamsList[DependencyIndex];
+
+				// The binaries can only be reused when both plugins are built on this machine in host projects that this plugin manages.
+				// BuildPlugin of UAT creates its own host project, and build workers do not have the dependency, so those builds only wait for it.
+				auto IsBuiltInHostProject = [](const FPackagePluginParams& ParamsToCheck) -> bool
+				{
+					return (
+						ParamsToCheck.BuildPluginParams.IsSet() &&
+						ParamsToCheck.BuildPluginParams->bBuildWithUBTDirectly &&
+						(ParamsToCheck.BuildPluginParams->BuildWorkerAddresses.Num() == 0)
+					);
+				};
+				const bool bCanReuseBinaries = (IsBuiltInHostProject(Params) && IsBuiltInHostProject(DependencyParams));
+
+				for (const auto& Pair : BuildTasksOfPlugins[PluginIndex])
+				{
+					const TSharedPtr<IUATBatchFileTask>* DependencyBuildTask = BuildTasksOfPlugins[DependencyIndex].Find(Pair.Key);
+					if (DependencyBuildTask == nullptr)
+					{
+						continue;
+					}
+
+					TaskPrerequisites.FindOrAdd(Pair.Value.Get()).Add(DependencyBuildTask->Get());
+					if (bCanReuseBinaries)
+					{
+						StaticCastSharedPtr<FDirectBuildPluginTask>(Pair.Value)->AddPrecompiledDependency(
+							StaticCastSharedPtr<FDirectBuildPluginTask>(*DependencyBuildTask)->GetStagedPluginDirectoryPath()
+						);
+					}
+					else
+					{
+						bHasAnyBinariesNotReused = true;
+					}
+				}
+
+				UE_LOG(
+					LogPluginBuilder, Log, TEXT("%s is built after %s, which it depends on."),
+					*Params.UATBatchFileParams.PluginFriendlyName, *DependencyParams.UATBatchFileParams.PluginFriendlyName
+				);
+			}
+		}
+
+		if (bHasAnyBinariesNotReused)
+		{
+			UE_LOG(LogPluginBuilder, Log, TEXT("The built binaries of dependencies are only reused when both plugins are built with UBT directly on this machine. The others compile their dependencies again."));
+		}
+	}
+
+	const FPackagePluginParams& FPluginPackager::GetRunParams() const
+	{
+		check(PluginParamsList.Num() > 0);
+		return PluginParamsList[0];
+	}
+
+	int32 FPluginPackager::GetPluginIndex(const TSharedRef<IPluginBuilderTask>& Task) const
+	{
+		const int32* PluginIndex = TaskPluginIndices.Find(&Task.Get());
+		return ((PluginIndex != nullptr) ? *PluginIndex : 0);
+	}
+
+	FString FPluginPackager::GetPluginNames() const
+	{
+		TArray<FString> PluginFriendlyNames;
+		for (const FPackagePluginParams& Params : PluginParamsList)
+		{
+			PluginFriendlyNames.Add(Params.UATBatchFileParams.PluginFriendlyName);
+		}
+
+		return FString::Join(PluginFriendlyNames, TEXT("+"));
+	}
+
+	void FPluginPackager::HandleOnConsoleCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() == 0)
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Usage: %s <PluginFriendlyName> [<PluginFriendlyName>...]"), PluginPackager::CommandName);
+			return;
+		}
+
+		TArray<FName> PluginFriendlyNames;
+		for (const FString& Arg : Args)
+		{
+			PluginFriendlyNames.Add(*Arg);
+		}
+
+		TArray<FPackagePluginParams> ParamsList;
+		if (!FPackagePluginParams::MakeBatchFromPluginFriendlyNames(PluginFriendlyNames, ParamsList))
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("No plugin or engine version to build for was specified."));
+			return;
+		}
+
+		StartBatchPackagePluginTask(ParamsList);
+	}
+
 	void FPluginPackager::Terminate()
 	{
 		UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
+		LogDiagnosticsSummary();
+		FTaskTimingDatabase::Get().SaveIfDirty();
+		WriteRunReport();
+		FinishTrace();
+		FBuildMonitor::EndRun();
 		
 		if (PendingNotificationHandle.IsValid())
 		{
@@ -405,9 +740,31 @@ namespace PluginBuilder
 		{
 			FEditorNotification::Success(LOCTEXT("PackageSucceeded", "Plugin packaging has completed successfully."));
 
-			if (!Params.IsFormatExpectedByMarketplace())
+			if (LastRunReport.Regressions.Num() > 0)
+			{
+				FEditorNotification::Fail(
+					FText::Format(
+						LOCTEXT("RegressionNotificationTextFormat", "Packaging took longer or got larger than in recent runs.\r\n{0}{1}"),
+						FText::FromString(LastRunReport.Regressions[0].Description),
+						(LastRunReport.Regressions.Num() > 1) ?
+						FText::Format(LOCTEXT("MoreRegressionsFormat", "\r\n(and {0} more, see the Output Log)"), FText::AsNumber(LastRunReport.Regressions.Num() - 1)) :
+						FText::GetEmpty()
+					),
+					8.f
+				);
+			}
+
+			TArray<FString> UnexpectedFormatPluginNames;
+			for (const FPackagePluginParams& Params : PluginParamsList)
+			{
+				if (!Params.IsFormatExpectedByMarketplace())
+				{
+					UnexpectedFormatPluginNames.Add(Params.UATBatchFileParams.PluginFriendlyName);
+				}
+			}
+			if (UnexpectedFormatPluginNames.Num() > 0)
 			{
-				UE_LOG(LogPluginBuilder, Warning, TEXT("The created package is not in a format that can be submitted to the marketplace."));
+				UE_LOG(LogPluginBuilder, Warning, TEXT("The created package is not in a format that can be submitted to the marketplace. (%s)"), *FString::Join(UnexpectedFormatPluginNames, TEXT(", ")));
 				UE_LOG(LogPluginBuilder, Warning, TEXT("If you plan to submit to the marketplace, please review the build options and zip up options."));
 				UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
 			}
@@ -437,9 +794,11 @@ namespace PluginBuilder
 	void FPluginPackager::OnCancelButtonPressed()
 	{
 		bWasCanceled = true;
-		if (Tasks.IsValidIndex(0))
+		FPackageTrace& Trace = FPackageTrace::Get();
+		Trace.AddInstantEvent(Trace.GetTrackId(TEXT("Packager")), TEXT("Cancel"), TEXT("Package"));
+		for (const TSharedRef<IPluginBuilderTask>& Task : GetRunningTasks())
 		{
-			Tasks[0]->RequestCancel();
+			Task->RequestCancel();
 		}
 
 		if (PendingNotificationHandle.IsValid())
@@ -450,43 +809,281 @@ namespace PluginBuilder
 		}
 	}
 
-	FText FPluginPackager::BuildNotificationText(const TSharedRef<IPluginBuilderTask>& CurrentTask) const
+	bool FPluginPackager::ShouldSkipRemainingTasks(const TSharedRef<IPluginBuilderTask>& Task) const
 	{
-		const float TaskProgress = CurrentTask->GetProgress();
-		const int32 TaskProgressPercent = ((TaskProgress >= 0.f) ? FMath::RoundToInt(TaskProgress * 100.f) : 0);
+		if (bWasCanceled || !Task->IsBuildTask() || !Task->HasFoundBuildError())
+		{
+			return false;
+		}
 
-		FText Message;
-		if (bIsUploadOnlyMode || CurrentTask->IsCloudUploadTask())
+		const int32 PluginIndex = GetPluginIndex(Task);
+		const FPackagePluginParams& Params = PluginParamsList[PluginIndex];
+		if (!Params.BuildPluginParams.IsSet() || !Params.BuildPluginParams->bStopOnFirstBuildError)
 		{
-			Message = LOCTEXT("UploadProgressText", "Uploading to Cloud Storage...");
+			return false;
 		}
-		else if (CurrentTask->IsZipTask())
+
+		return HasPendingTasksOfPlugin(PluginIndex);
+	}
+
+	bool FPluginPackager::ArePrerequisitesFinished(const TSharedRef<IPluginBuilderTask>& Task, bool& bOutHaveAllSucceeded) const
+	{
+		bOutHaveAllSucceeded = true;
+
+		const TArray<const IPluginBuilderTask*>* Prerequisites = TaskPrerequisites.Find(&Task.Get());
+		if (Prerequisites == nullptr)
 		{
-			Message = LOCTEXT("ZipProgressText", "Zipping Up...");
+			return true;
 		}
-		else
+
+		for (const IPluginBuilderTask* Prerequisite : *Prerequisites)
 		{
-			Message = LOCTEXT("BuildProgressText", "Building...");
+			const bool* bHasSucceeded = FinishedTaskResults.Find(Prerequisite);
+			if (bHasSucceeded == nullptr)
+			{
+				return false;
+			}
+			if (!*bHasSucceeded)
+			{
+				bOutHaveAllSucceeded = false;
+			}
 		}
 
-		int32 RemainingBuildCount = 0;
-		int32 RemainingZipCount = 0;
-		int32 RemainingUploadCount = 0;
+		return true;
+	}
+
+	void FPluginPackager::SkipRemainingTasks(const int32 PluginIndex, const FString& Reason)
+	{
+		TArray<TSharedRef<IPluginBuilderTask>> SkippedTasks;
 		for (const TSharedRef<IPluginBuilderTask>& Task : Tasks)
 		{
+			if ((Task->GetState() == IPluginBuilderTask::EState::PreInitialize) && (GetPluginIndex(Task) == PluginIndex))
+			{
+				SkippedTasks.Add(Task);
+			}
+		}
+		UE_LOG(
+			LogPluginBuilder, Error, TEXT("%s. The remaining %d task(s) of %s are skipped."),
+			*Reason, SkippedTasks.Num(), *PluginParamsList[PluginIndex].UATBatchFileParams.PluginFriendlyName
+		);
+
+		FPackageTrace& Trace = FPackageTrace::Get();
+		Trace.AddInstantEvent(
+			Trace.GetTrackId(TEXT("Packager")),
+			TEXT("Skip remaining tasks"),
+			TEXT("Package"),
+			{ { TEXT("skippedTasks"), static_cast<double>(SkippedTasks.Num()) } }
+		);
+
+		// Skipped tasks are excluded from the totals so that the notification does not count them as completed.
+		for (const TSharedRef<IPluginBuilderTask>& SkippedTask : SkippedTasks)
+		{
+			// An upload task that has already started waits for the zip tasks of the plugin, and would wait forever for a skipped one.
+			for (const TSharedRef<IPluginBuilderTask>& Task : Tasks)
+			{
+				if (Task->IsCloudUploadTask() && (Task->GetState() != IPluginBuilderTask::EState::PreInitialize))
+				{
+					StaticCastSharedRef<FUploadToCloudTask>(Task)->HandleOnTaskSkipped(&SkippedTask.Get());
+				}
+			}
+
+			if (SkippedTask->IsBuildTask())
+			{
+				TotalBuildCount--;
+			}
+			else if (SkippedTask->IsZipTask())
+			{
+				TotalZipCount--;
+			}
+			else if (SkippedTask->IsCloudUploadTask())
+			{
+				TotalUploadCount--;
+			}
+			AdjustTaskCounts(SkippedTask, -1, 0);
+			ExpectedTaskTimes.Remove(&SkippedTask.Get());
+			TaskPluginIndices.Remove(&SkippedTask.Get());
+			FinishedTaskResults.Add(&SkippedTask.Get(), false);
+			FBuildMonitor::NotifyTaskFinished(SkippedTask, EBuildMonitorTaskState::Skipped);
+			Tasks.RemoveSingle(SkippedTask);
+		}
+		TotalTaskCount -= SkippedTasks.Num();
+		HandleOnTaskTransition();
+
+		bHasAnyError = true;
+	}
+
+	void FPluginPackager::SortTasksByExpectedTime()
+	{
+		// Zips come first so that a zip whose build has finished starts before the next build, which keeps the tail of the run short.
+		// Within each kind the longest expected task comes first, and tasks that have never been recorded are assumed to be the longest.
+		auto GetKindOrder = [](const TSharedRef<IPluginBuilderTask>& Task) -> int32
+		{
+			if (Task->IsZipTask())
+			{
+				return 0;
+			}
 			if (Task->IsBuildTask())
 			{
-				RemainingBuildCount++;
+				return 1;
 			}
-			else if (Task->IsZipTask())
+			return 2;
+		};
+		auto GetExpectedTime = [this](const TSharedRef<IPluginBuilderTask>& Task) -> double
+		{
+			const double* ExpectedTime = ExpectedTaskTimes.Find(&Task.Get());
+			return ((ExpectedTime != nullptr) ? *ExpectedTime : TNumericLimits<double>::Max());
+		};
+
+		// Builds that other builds wait for come before the rest, so that the dependent builds can start as early as possible.
+		TSet<const IPluginBuilderTask*> AwaitedTasks;
+		for (const auto& Pair : TaskPrerequisites)
+		{
+			AwaitedTasks.Append(Pair.Value);
+		}
+
+		Tasks.StableSort(
+			[&](const TSharedRef<IPluginBuilderTask>& A, const TSharedRef<IPluginBuilderTask>& B) -> bool
 			{
-				RemainingZipCount++;
+				const int32 KindOrderA = GetKindOrder(A);
+				const int32 KindOrderB = GetKindOrder(B);
+				if (KindOrderA != KindOrderB)
+				{
+					return (KindOrderA < KindOrderB);
+				}
+				const bool bIsAwaitedA = AwaitedTasks.Contains(&A.Get());
+				const bool bIsAwaitedB = AwaitedTasks.Contains(&B.Get());
+				if (bIsAwaitedA != bIsAwaitedB)
+				{
+					return bIsAwaitedA;
+				}
+				return (GetExpectedTime(A) > GetExpectedTime(B));
 			}
-			else if (Task->IsCloudUploadTask())
+		);
+	}
+
+	void FPluginPackager::StartReadyTasks()
+	{
+		if (bWasCanceled || !HasPendingTasks())
+		{
+			return;
+		}
+
+		auto IsUATTask = [](const TSharedRef<IPluginBuilderTask>& Task) -> bool
+		{
+			return ((Task->IsBuildTask() && !Task->IsRemoteTask()) || Task->IsZipTask());
+		};
+
+		int32 NumRunningUATTasks = (RunningBuildCount - RunningRemoteBuildCount + RunningZipCount);
+		bool bHasAnyTaskStarted = false;
+		TSet<int32> PluginIndicesWithFailedPrerequisites;
+
+		// Uploads and builds on build workers are not limited since they hardly use the CPU of this machine.
+		const int32 MaxConcurrentUATTasks = FMath::Max(GetRunParams().MaxConcurrentUATTasks, 1);
+		for (const TSharedRef<IPluginBuilderTask>& Task : Tasks)
+		{
+			if ((Task->GetState() != IPluginBuilderTask::EState::PreInitialize) || !Task->CanStart())
+			{
+				continue;
+			}
+
+			bool bHaveAllPrerequisitesSucceeded = true;
+			if (!ArePrerequisitesFinished(Task, bHaveAllPrerequisitesSucceeded))
+			{
+				continue;
+			}
+			if (!bHaveAllPrerequisitesSucceeded)
+			{
+				PluginIndicesWithFailedPrerequisites.Add(GetPluginIndex(Task));
+				continue;
+			}
+
+			const bool bIsUATTask = IsUATTask(Task);
+			if (bIsUATTask && (NumRunningUATTasks >= MaxConcurrentUATTasks))
+			{
+				continue;
+			}
+
+			TaskStartTimes.Add(&Task.Get(), FPlatformTime::Seconds());
+			FPackageTrace& Trace = FPackageTrace::Get();
+			const FString TraceTrackName = Task->GetTraceTrackName();
+			TaskTraceEventIds.Add(&Task.Get(), Trace.BeginEvent(Trace.GetTrackId(TraceTrackName), TraceTrackName, TEXT("Task")));
+			Task->Initialize();
+			FBuildMonitor::NotifyTaskStarted(Task);
+			InitializedTasks.Add(Task);
+			NotificationTaskLabels.Add(&Task.Get(), Task->GetTaskLabel());
+			AdjustTaskCounts(Task, 0, 1);
+			bHasAnyTaskStarted = true;
+
+			if (bIsUATTask && (Task->GetState() != IPluginBuilderTask::EState::Terminated))
+			{
+				NumRunningUATTasks++;
+			}
+		}
+
+		if (bHasAnyTaskStarted)
+		{
+			HandleOnTaskTransition();
+		}
+
+		// The plugins that depend on the skipped ones are skipped on a later tick, when their builds are reached.
+		for (const int32 PluginIndex : PluginIndicesWithFailedPrerequisites)
+		{
+			SkipRemainingTasks(PluginIndex, TEXT("A plugin this plugin depends on could not be built"));
+		}
+	}
+
+	TArray<TSharedRef<IPluginBuilderTask>> FPluginPackager::GetRunningTasks() const
+	{
+		return InitializedTasks;
+	}
+
+	bool FPluginPackager::HasPendingTasks() const
+	{
+		// Every scheduled task that has been initialized is in InitializedTasks until it is removed from both.
+		return (Tasks.Num() > InitializedTasks.Num());
+	}
+
+	bool FPluginPackager::HasPendingTasksOfPlugin(const int32 PluginIndex) const
+	{
+		for (const TSharedRef<IPluginBuilderTask>& Task : Tasks)
+		{
+			if ((Task->GetState() == IPluginBuilderTask::EState::PreInitialize) && (GetPluginIndex(Task) == PluginIndex))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void FPluginPackager::AdjustTaskCounts(const TSharedRef<IPluginBuilderTask>& Task, const int32 RemainingDelta, const int32 RunningDelta)
+	{
+		if (Task->IsBuildTask())
+		{
+			RemainingBuildCount += RemainingDelta;
+			RunningBuildCount += RunningDelta;
+			if (Task->IsRemoteTask())
 			{
-				RemainingUploadCount++;
+				RunningRemoteBuildCount += RunningDelta;
 			}
 		}
+		else if (Task->IsZipTask())
+		{
+			RemainingZipCount += RemainingDelta;
+			RunningZipCount += RunningDelta;
+		}
+		else if (Task->IsCloudUploadTask())
+		{
+			RemainingUploadCount += RemainingDelta;
+		}
+	}
+
+	void FPluginPackager::HandleOnTaskTransition()
+	{
+		// The schedule is only simulated when it changes, and the notification counts the result down in between.
+		ExpectedRemainingTimeAtTransition = GetExpectedRemainingTimeOfAllTasks();
+		LastTransitionTime = FPlatformTime::Seconds();
+
 		TArray<FString> ProgressParts;
 		if (TotalBuildCount > 0)
 		{
@@ -500,21 +1097,394 @@ namespace PluginBuilder
 		{
 			ProgressParts.Add(FString::Printf(TEXT("Upload %d/%d"), (TotalUploadCount - RemainingUploadCount), TotalUploadCount));
 		}
-		const FString ProgressText = FString::Join(ProgressParts, TEXT(", "));
+		TaskCountsText = FString::Join(ProgressParts, TEXT(", "));
+
+		bIsNotificationTextDirty = true;
+	}
+
+	void FPluginPackager::FinishTask(const TSharedRef<IPluginBuilderTask>& Task)
+	{
+		if (Task->HasAnyError())
+		{
+			bHasAnyError = true;
+		}
+		else if (!bWasCanceled)
+		{
+			RecordTaskTimes(Task);
+		}
+		const FTaskRunReport& TaskRunReport = AddTaskRunReport(Task);
+		FinishedTaskResults.Add(&Task.Get(), TaskRunReport.bSucceeded);
+		int32 TaskTraceEventId = INDEX_NONE;
+		if (TaskTraceEventIds.RemoveAndCopyValue(&Task.Get(), TaskTraceEventId))
+		{
+			FPackageTrace::FArgs TraceArgs = TaskRunReport.Metrics;
+			TraceArgs.Add(TEXT("succeeded"), TaskRunReport.bSucceeded ? 1.0 : 0.0);
+			if (const double* ExpectedTime = ExpectedTaskTimes.Find(&Task.Get()))
+			{
+				TraceArgs.Add(TEXT("expectedSeconds"), *ExpectedTime);
+			}
+			FPackageTrace::Get().EndEvent(TaskTraceEventId, TraceArgs);
+		}
+		ExpectedTaskTimes.Remove(&Task.Get());
+		TaskStartTimes.Remove(&Task.Get());
 
-		return FText::Format(
-			LOCTEXT("BuildProgressTextFormat", "{0} {1}%\r\n{2} ({3})\r\n{4}\r\n{5}"),
-			Message,
-			FText::AsNumber(TaskProgressPercent),
-			FText::FromString(Params.UATBatchFileParams.PluginFriendlyName),
-			FText::FromString(Params.UATBatchFileParams.PluginVersionName),
-			FText::FromString(CurrentTask->GetTaskLabel()),
-			FText::FromString(ProgressText)
+		FBuildDiagnostics Diagnostics = Task->GetDiagnostics();
+		if (Diagnostics.Entries.Num() > 0)
+		{
+			LastDiagnostics.Add(MoveTemp(Diagnostics));
+		}
+
+		EBuildMonitorTaskState FinalState = EBuildMonitorTaskState::Succeeded;
+		if (!TaskRunReport.bSucceeded)
+		{
+			FinalState = (bWasCanceled ? EBuildMonitorTaskState::Canceled : EBuildMonitorTaskState::Failed);
+		}
+		FBuildMonitor::NotifyTaskFinished(Task, FinalState);
+
+		InitializedTasks.RemoveSingle(Task);
+		NotificationTaskLabels.Remove(&Task.Get());
+		AdjustTaskCounts(Task, -1, -1);
+		TaskPluginIndices.Remove(&Task.Get());
+
+		Tasks.RemoveSingle(Task);
+		HandleOnTaskTransition();
+	}
+
+	const FTaskRunReport& FPluginPackager::AddTaskRunReport(const TSharedRef<IPluginBuilderTask>& Task)
+	{
+		FTaskRunReport& TaskRunReport = TaskRunReports.AddDefaulted_GetRef();
+		TaskRunReport.TaskName = Task->GetTraceTrackName();
+		TaskRunReport.TimingKey = Task->GetTimingKey();
+		TaskRunReport.bSucceeded = (!Task->HasAnyError() && !bWasCanceled);
+
+		if (const double* StartTime = TaskStartTimes.Find(&Task.Get()))
+		{
+			TaskRunReport.Metrics.Add(TEXT("wallSeconds"), FPlatformTime::Seconds() - *StartTime);
+		}
+
+		const FTaskPhaseTimes PhaseTimes = Task->GetPhaseTimes();
+		for (int32 Index = 0; Index < static_cast<int32>(ETaskPhase::Num); Index++)
+		{
+			const ETaskPhase Phase = static_cast<ETaskPhase>(Index);
+			if (PhaseTimes.Get(Phase) > 0.0)
+			{
+				// Such as "compileSeconds".
+				FString MetricName = FString::Printf(TEXT("%sSeconds"), LexToString(Phase));
+				MetricName[0] = FChar::ToLower(MetricName[0]);
+				TaskRunReport.Metrics.Add(MetricName, PhaseTimes.Get(Phase));
+			}
+		}
+
+		Task->GetReportMetrics(TaskRunReport.Metrics);
+		return TaskRunReport;
+	}
+
+	void FPluginPackager::WriteRunReport()
+	{
+		FPackageRunReport& Report = LastRunReport;
+		Report = FPackageRunReport();
+		// A batch is compared against the previous runs of the same set of plugins.
+		Report.PluginName = GetPluginNames();
+		if (PluginParamsList.Num() == 1)
+		{
+			Report.PluginVersionName = PluginParamsList[0].UATBatchFileParams.PluginVersionName;
+		}
+		Report.StartTime = RunStartDateTime;
+		Report.WallSeconds = (FPlatformTime::Seconds() - RunStartTime);
+		Report.bSucceeded = (!bHasAnyError && !bWasCanceled);
+		Report.bWasCanceled = bWasCanceled;
+		Report.Tasks = MoveTemp(TaskRunReports);
+
+		if (!bWasCanceled)
+		{
+			const TArray<FPackageRunReport> PreviousReports = FRunReportHistory::LoadRecentReports(Report.PluginName, FRunReportHistory::NumBaselineRuns * 2);
+			Report.Regressions = FRunReportHistory::FindRegressions(Report, PreviousReports, GetRunParams().RegressionThresholdPercent / 100.0);
+		}
+
+		Report.FilePath = FRunReportHistory::Save(Report);
+		if (!Report.FilePath.IsEmpty())
+		{
+			UE_LOG(LogPluginBuilder, Log, TEXT("[Run Report] %s"), *Report.FilePath);
+		}
+		for (const FRunRegression& Regression : Report.Regressions)
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("[Regression] %s"), *Regression.Description);
+		}
+	}
+
+	void FPluginPackager::PredictTaskTimes()
+	{
+		ExpectedTaskTimes.Reset();
+
+		const FTaskTimingDatabase& TimingDatabase = FTaskTimingDatabase::Get();
+		for (const TSharedRef<IPluginBuilderTask>& Task : Tasks)
+		{
+			const double ExpectedTime = TimingDatabase.GetExpectedTotalTime(Task->GetTimingKey());
+			if (ExpectedTime >= 0.0)
+			{
+				ExpectedTaskTimes.Add(&Task.Get(), ExpectedTime);
+			}
+		}
+	}
+
+	void FPluginPackager::RecordTaskTimes(const TSharedRef<IPluginBuilderTask>& Task) const
+	{
+		const FString TimingKey = Task->GetTimingKey();
+		if (TimingKey.IsEmpty())
+		{
+			return;
+		}
+
+		const FTaskPhaseTimes PhaseTimes = Task->GetPhaseTimes();
+		if (PhaseTimes.GetTotal() > 0.0)
+		{
+			FTaskTimingDatabase::Get().Record(TimingKey, PhaseTimes);
+		}
+	}
+
+	double FPluginPackager::GetExpectedRemainingTime(const TSharedRef<IPluginBuilderTask>& Task) const
+	{
+		const double* ExpectedTime = ExpectedTaskTimes.Find(&Task.Get());
+		if (ExpectedTime == nullptr)
+		{
+			return -1.0;
+		}
+
+		const double* StartTime = TaskStartTimes.Find(&Task.Get());
+		if (StartTime == nullptr)
+		{
+			return *ExpectedTime;
+		}
+
+		// A task that takes longer than usual is expected to finish soon rather than at an unknown time.
+		return FMath::Max(*ExpectedTime - (FPlatformTime::Seconds() - *StartTime), 0.0);
+	}
+
+	double FPluginPackager::GetExpectedRemainingTimeOfAllTasks() const
+	{
+		// Simulates the schedule: builds and zips share the UAT slots, running ones first, and uploads finish after them.
+		TArray<double> SlotEndTimes;
+		SlotEndTimes.Init(0.0, FMath::Max(GetRunParams().MaxConcurrentUATTasks, 1));
+		double UploadTime = 0.0;
+
+		TArray<TSharedRef<IPluginBuilderTask>> OrderedTasks = GetRunningTasks();
+		for (const TSharedRef<IPluginBuilderTask>& Task : Tasks)
+		{
+			if (Task->GetState() == IPluginBuilderTask::EState::PreInitialize)
+			{
+				OrderedTasks.Add(Task);
+			}
+		}
+
+		for (const TSharedRef<IPluginBuilderTask>& Task : OrderedTasks)
+		{
+			const double TaskRemainingTime = GetExpectedRemainingTime(Task);
+			if (TaskRemainingTime < 0.0)
+			{
+				return -1.0;
+			}
+
+			if (Task->IsCloudUploadTask())
+			{
+				UploadTime += TaskRemainingTime;
+				continue;
+			}
+
+			int32 EarliestSlotIndex = 0;
+			for (int32 SlotIndex = 1; SlotIndex < SlotEndTimes.Num(); SlotIndex++)
+			{
+				if (SlotEndTimes[SlotIndex] < SlotEndTimes[EarliestSlotIndex])
+				{
+					EarliestSlotIndex = SlotIndex;
+				}
+			}
+			SlotEndTimes[EarliestSlotIndex] += TaskRemainingTime;
+		}
+
+		return (FMath::Max(SlotEndTimes) + UploadTime);
+	}
+
+	FString FPluginPackager::FormatDuration(const double Seconds)
+	{
+		const int64 TotalSeconds = static_cast<int64>(FMath::CeilToDouble(Seconds));
+		const int64 Hours = (TotalSeconds / 3600);
+		const int64 Minutes = ((TotalSeconds / 60) % 60);
+		const int64 RemainingSeconds = (TotalSeconds % 60);
+		if (Hours > 0)
+		{
+			return FString::Printf(TEXT("%lldh %02lldm"), Hours, Minutes);
+		}
+		if (Minutes > 0)
+		{
+			return FString::Printf(TEXT("%lldm %02llds"), Minutes, RemainingSeconds);
+		}
+		return FString::Printf(TEXT("%llds"), RemainingSeconds);
+	}
+
+	void FPluginPackager::LogDiagnosticsSummary()
+	{
+		if (LastDiagnostics.Num() == 0)
+		{
+			return;
+		}
+
+		int32 NumErrors = 0;
+		int32 NumWarnings = 0;
+		for (const FBuildDiagnostics& Diagnostics : LastDiagnostics)
+		{
+			NumErrors += Diagnostics.GetNum(EBuildDiagnosticSeverity::Error);
+			NumWarnings += Diagnostics.GetNum(EBuildDiagnosticSeverity::Warning);
+		}
+
+		UE_LOG(LogPluginBuilder, Log, TEXT("[Diagnostics] %d error(s), %d warning(s)"), NumErrors, NumWarnings);
+		for (const FBuildDiagnostics& Diagnostics : LastDiagnostics)
+		{
+			for (const FBuildDiagnostic& Entry : Diagnostics.Entries)
+			{
+				// Warnings were already output with the task log, so only errors are repeated here.
+				if (Entry.IsError())
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("[%s] %s"), *Diagnostics.TaskLabel, *Entry.ToString());
+				}
+			}
+		}
+		UE_LOG(LogPluginBuilder, Log, TEXT("===================================================================================================="));
+	}
+
+	void FPluginPackager::StartTrace()
+	{
+		FPackageTrace& Trace = FPackageTrace::Get();
+		Trace.Start(GetPluginNames());
+		RunTraceEventId = Trace.BeginEvent(
+			Trace.GetTrackId(TEXT("Packager")),
+			FString::Printf(TEXT("Package %s"), *GetPluginNames()),
+			TEXT("Package")
+		);
+	}
+
+	void FPluginPackager::FinishTrace()
+	{
+		FPackageTrace& Trace = FPackageTrace::Get();
+		Trace.EndEvent(
+			RunTraceEventId,
+			{
+				{ TEXT("succeeded"), (!bHasAnyError && !bWasCanceled) ? 1.0 : 0.0 },
+				{ TEXT("canceled"), bWasCanceled ? 1.0 : 0.0 }
+			}
+		);
+		RunTraceEventId = INDEX_NONE;
+		TaskTraceEventIds.Reset();
+		Trace.Stop();
+
+		if (GetRunParams().bExportPackageTrace)
+		{
+			const FString TraceFilePath = Trace.MakeTraceFilePath();
+			if (Trace.ExportToChromeTrace(TraceFilePath))
+			{
+				UE_LOG(LogPluginBuilder, Log, TEXT("[Trace] %s"), *TraceFilePath);
+			}
+		}
+	}
+
+	void FPluginPackager::UpdateNotificationText()
+	{
+		if (!PendingNotificationHandle.IsValid())
+		{
+			return;
+		}
+
+		// Only the running tasks are visited here, since the counts and the expected time are updated on task transitions.
+		// The percentage is the average of the running tasks that report their progress.
+		float TotalTaskProgress = 0.f;
+		int32 NumTasksWithProgress = 0;
+		TArray<FString> TaskProgressTexts;
+		TaskProgressTexts.Reserve(InitializedTasks.Num());
+		for (const TSharedRef<IPluginBuilderTask>& Task : InitializedTasks)
+		{
+			const float TaskProgress = Task->GetProgress();
+			if (TaskProgress >= 0.f)
+			{
+				TotalTaskProgress += TaskProgress;
+				NumTasksWithProgress++;
+			}
+			TaskProgressTexts.Add(Task->GetProgressText());
+		}
+		const int32 TaskProgressPercent = ((NumTasksWithProgress > 0) ? FMath::RoundToInt(TotalTaskProgress / NumTasksWithProgress * 100.f) : 0);
+
+		// Between transitions the running tasks just count down, so the schedule does not have to be simulated again.
+		int64 RemainingSeconds = INDEX_NONE;
+		if (ExpectedRemainingTimeAtTransition >= 0.0)
+		{
+			const double RemainingTime = FMath::Max(ExpectedRemainingTimeAtTransition - (FPlatformTime::Seconds() - LastTransitionTime), 0.0);
+			RemainingSeconds = static_cast<int64>(FMath::CeilToDouble(RemainingTime));
+		}
+
+		if (!bIsNotificationTextDirty &&
+			(TaskProgressPercent == DisplayedProgressPercent) &&
+			(RemainingSeconds == DisplayedRemainingSeconds) &&
+			(TaskProgressTexts == DisplayedTaskProgressTexts))
+		{
+			return;
+		}
+		bIsNotificationTextDirty = false;
+		DisplayedProgressPercent = TaskProgressPercent;
+		DisplayedRemainingSeconds = RemainingSeconds;
+		DisplayedTaskProgressTexts = MoveTemp(TaskProgressTexts);
+
+		FText Message;
+		if (bIsUploadOnlyMode || ((RunningBuildCount == 0) && (RunningZipCount == 0) && (InitializedTasks.Num() > 0)))
+		{
+			Message = LOCTEXT("UploadProgressText", "Uploading to Cloud Storage...");
+		}
+		else if ((RunningBuildCount == 0) && (RunningZipCount > 0))
+		{
+			Message = LOCTEXT("ZipProgressText", "Zipping Up...");
+		}
+		else
+		{
+			Message = LOCTEXT("BuildProgressText", "Building...");
+		}
+
+		FString ProgressText = TaskCountsText;
+		if (RemainingSeconds >= 0)
+		{
+			ProgressText += FString::Printf(TEXT(", ETA %s"), *FormatDuration(static_cast<double>(RemainingSeconds)));
+		}
+
+		TArray<FString> TaskLabels;
+		for (int32 Index = 0; Index < InitializedTasks.Num(); Index++)
+		{
+			const IPluginBuilderTask* Task = &InitializedTasks[Index].Get();
+			FString TaskLabel = NotificationTaskLabels.FindRef(Task);
+			if (!DisplayedTaskProgressTexts[Index].IsEmpty())
+			{
+				TaskLabel += FString::Printf(TEXT(" %s"), *DisplayedTaskProgressTexts[Index]);
+			}
+			if (const double* ExpectedTime = ExpectedTaskTimes.Find(Task))
+			{
+				TaskLabel += FString::Printf(TEXT(" (usually %s)"), *FormatDuration(*ExpectedTime));
+			}
+			TaskLabels.Add(TaskLabel);
+		}
+		const FString TaskLabel = FString::Join(TaskLabels, TEXT("\r\n"));
+
+		PendingNotificationHandle.SetText(
+			FText::Format(
+				LOCTEXT("BuildProgressTextFormat", "{0} {1}%\r\n{2}\r\n{3}\r\n{4}"),
+				Message,
+				FText::AsNumber(TaskProgressPercent),
+				FText::FromString(RunName),
+				FText::FromString(TaskLabel),
+				FText::FromString(ProgressText)
+			)
 		);
 	}
 
 	TUniquePtr<FPluginPackager> FPluginPackager::Instance;
 	FEditorNotificationHandle FPluginPackager::PendingNotificationHandle;
+	TArray<FBuildDiagnostics> FPluginPackager::LastDiagnostics;
+	FPackageRunReport FPluginPackager::LastRunReport;
+	IConsoleObject* FPluginPackager::ConsoleCommand = nullptr;
 }
 
 #undef LOCTEXT_NAMESPACE
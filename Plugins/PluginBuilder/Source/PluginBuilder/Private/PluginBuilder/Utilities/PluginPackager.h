@@ -5,11 +5,16 @@
 #include "CoreMinimal.h"
 #include "Tickable.h"
 #include "PluginBuilder/Types/PackagePluginParams.h"
+#include "PluginBuilder/Types/BuildDiagnostics.h"
+#include "PluginBuilder/Types/PackageRunReport.h"
 #include "PluginBuilder/Utilities/EditorNotification.h"
 
+class IConsoleObject;
+
 namespace PluginBuilder
 {
 	class IPluginBuilderTask;
+	class IUATBatchFileTask;
 	class FZipUpPluginTask;
 	
 	/**
@@ -23,6 +28,13 @@ namespace PluginBuilder
 		// Returns whether the package plugin task has started.
 		static bool StartPackagePluginTask(const TOptional<FPackagePluginParams>& InParams = {});
 
+		// Creates and starts a task that packages several plugins, each with its own parameters, in one shared task pool.
+		// The builds, zips and uploads of all plugins are scheduled together, so they share the concurrency limit instead of running one plugin after another.
+		// A plugin that references another plugin in the list in its descriptor is built after it for each engine version.
+		// Settings that apply to the whole process, such as MaxConcurrentUATTasks and bExportPackageTrace, are taken from the first parameters.
+		// Returns whether the package plugin task has started.
+		static bool StartBatchPackagePluginTask(const TArray<FPackagePluginParams>& InParamsList);
+
 		// Creates and starts a task that runs only the build step (no zip, no upload).
 		static bool StartBuildOnlyTask();
 
@@ -44,8 +56,21 @@ namespace PluginBuilder
 		// Returns whether package processing is being done.
 		static bool IsPackagePluginTaskRunning();
 
+		// Returns the errors and warnings of each task in the last packaging process, or of the running one.
+		// Tasks that reported no diagnostics are not included.
+		static const TArray<FBuildDiagnostics>& GetLastDiagnostics();
+
+		// Returns the run report of the last packaging process. It is empty while a packaging process is running.
+		static const FPackageRunReport& GetLastRunReport();
+
 		// Releases all static state. Must be called before Slate is torn down (e.g., from ShutdownModule).
 		static void CleanupStatics();
+
+		// Registers the console command that packages the plugins with the specified friendly names together.
+		static void RegisterConsoleCommand();
+
+		// Unregisters the console command.
+		static void UnregisterConsoleCommand();
 		
 		// FTickableObjectBase interface.
 		virtual void Tick(float DeltaTime) override;
@@ -59,6 +84,24 @@ namespace PluginBuilder
 		// Called once when package processing begins.
 		void Initialize();
 
+		// Schedules the build, zip and upload tasks of a plugin, and returns its build tasks by engine version.
+		void AddPluginTasks(int32 PluginIndex, TMap<FString, TSharedPtr<IUATBatchFileTask>>& OutBuildTasks);
+
+		// Makes the build tasks of each plugin wait for those of the plugins it depends on for the same engine version.
+		void LinkDependentBuildTasks(const TArray<TMap<FString, TSharedPtr<IUATBatchFileTask>>>& BuildTasksOfPlugins);
+
+		// Returns the parameters whose settings apply to the whole packaging process.
+		const FPackagePluginParams& GetRunParams() const;
+
+		// Returns the index in PluginParamsList of the plugin the task belongs to.
+		int32 GetPluginIndex(const TSharedRef<IPluginBuilderTask>& Task) const;
+
+		// Returns the friendly names of the plugins joined with "+", used to name the trace and the run report.
+		FString GetPluginNames() const;
+
+		// Called when the console command is executed.
+		static void HandleOnConsoleCommand(const TArray<FString>& Args);
+
 		// Called once when package processing ends.
 		void Terminate();
 
@@ -68,8 +111,73 @@ namespace PluginBuilder
 		// Called when the editor notification cancel button is pressed.
 		void OnCancelButtonPressed();
 
-		// Builds a notification text string reflecting the given task's fine-grained progress.
-		FText BuildNotificationText(const TSharedRef<IPluginBuilderTask>& CurrentTask) const;
+		// Orders the scheduled tasks so that the longest expected ones start first.
+		void SortTasksByExpectedTime();
+
+		// Initializes the scheduled tasks that can start, as long as the number of running UAT tasks stays within the limit.
+		void StartReadyTasks();
+
+		// Returns the tasks that have been initialized and have not been removed yet.
+		TArray<TSharedRef<IPluginBuilderTask>> GetRunningTasks() const;
+
+		// Returns whether any scheduled task has not been initialized yet.
+		bool HasPendingTasks() const;
+
+		// Returns whether any scheduled task of the plugin has not been initialized yet.
+		bool HasPendingTasksOfPlugin(int32 PluginIndex) const;
+
+		// Adds the deltas to the remaining and running counts of the kind of the task.
+		void AdjustTaskCounts(const TSharedRef<IPluginBuilderTask>& Task, int32 RemainingDelta, int32 RunningDelta);
+
+		// Called when tasks have started, finished or been skipped, to update the values that only change at those times.
+		void HandleOnTaskTransition();
+
+		// Collects the results of a terminated task and removes it from the scheduled tasks.
+		void FinishTask(const TSharedRef<IPluginBuilderTask>& Task);
+
+		// Returns whether the remaining tasks of the plugin the task belongs to should be skipped because a build error was found in the task.
+		bool ShouldSkipRemainingTasks(const TSharedRef<IPluginBuilderTask>& Task) const;
+
+		// Returns whether all tasks the task waits for have finished, and whether all of them succeeded.
+		bool ArePrerequisitesFinished(const TSharedRef<IPluginBuilderTask>& Task, bool& bOutHaveAllSucceeded) const;
+
+		// Removes the scheduled tasks of the plugin that have not been initialized yet.
+		// The tasks of the other plugins in a batch keep running, except those that depend on the skipped ones.
+		void SkipRemainingTasks(int32 PluginIndex, const FString& Reason);
+
+		// Looks up how long each scheduled task is expected to take in the timing database.
+		void PredictTaskTimes();
+
+		// Records the time spent on a task that completed successfully in the timing database.
+		void RecordTaskTimes(const TSharedRef<IPluginBuilderTask>& Task) const;
+
+		// Returns the expected seconds until the task completes, or a negative value if it has never been recorded.
+		double GetExpectedRemainingTime(const TSharedRef<IPluginBuilderTask>& Task) const;
+
+		// Returns the expected seconds until all scheduled tasks complete, or a negative value if any of them has never been recorded.
+		double GetExpectedRemainingTimeOfAllTasks() const;
+
+		// Returns a short human readable form of a duration, such as "1m 05s".
+		static FString FormatDuration(double Seconds);
+
+		// Outputs the errors and warnings collected from all tasks to the log.
+		static void LogDiagnosticsSummary();
+
+		// Adds the measurements of a finished task to the run report and returns them.
+		const FTaskRunReport& AddTaskRunReport(const TSharedRef<IPluginBuilderTask>& Task);
+
+		// Completes the run report, compares it against the previous runs of the plugin and writes it to a file.
+		void WriteRunReport();
+
+		// Starts recording the trace of the packaging process.
+		void StartTrace();
+
+		// Stops recording the trace and writes it to a file if requested.
+		void FinishTrace();
+
+		// Updates the notification text to reflect the fine-grained progress of the running tasks.
+		// The text is only formatted again when one of the values it shows has changed.
+		void UpdateNotificationText();
 		
 	private:
 		// The running task that packages a plugin.
@@ -78,10 +186,34 @@ namespace PluginBuilder
 		// The editor notification item that package a plugin.
 		static FEditorNotificationHandle PendingNotificationHandle;
 
-		// The dataset used to process plugin packages.
-		FPackagePluginParams Params;
+		// The diagnostics collected from the tasks of the last packaging process.
+		static TArray<FBuildDiagnostics> LastDiagnostics;
+
+		// The run report of the last packaging process.
+		static FPackageRunReport LastRunReport;
+
+		// The registered console command.
+		static IConsoleObject* ConsoleCommand;
+
+		// The datasets used to process the package of each plugin.
+		TArray<FPackagePluginParams> PluginParamsList;
+
+		// The index in PluginParamsList of the plugin each scheduled task belongs to.
+		TMap<const IPluginBuilderTask*, int32> TaskPluginIndices;
+
+		// The indices in PluginParamsList of the plugins each plugin depends on.
+		TArray<TArray<int32>> PluginDependencies;
+
+		// The tasks each scheduled task waits for before it starts, which are the builds of the plugins it depends on.
+		TMap<const IPluginBuilderTask*, TArray<const IPluginBuilderTask*>> TaskPrerequisites;
+
+		// Whether each task that has finished or been skipped succeeded.
+		TMap<const IPluginBuilderTask*, bool> FinishedTaskResults;
+
+		// The name of the packaging process shown in the notification and the build monitor, such as "MyPlugin (1.0)" or "3 plugins".
+		FString RunName;
 
-		// The list of tasks scheduled to process.
+		// The list of tasks scheduled to process, including the running ones, in the order they are started.
 		TArray<TSharedRef<IPluginBuilderTask>> Tasks;
 
 		// Zip tasks kept alive so FUploadToCloudTask can read their output paths.
@@ -93,6 +225,38 @@ namespace PluginBuilder
 		int32 TotalZipCount = 0;
 		int32 TotalUploadCount = 0;
 
+		// The per-type numbers of tasks that have not finished yet and of running tasks, updated as tasks start and finish.
+		int32 RemainingBuildCount = 0;
+		int32 RemainingZipCount = 0;
+		int32 RemainingUploadCount = 0;
+		int32 RunningBuildCount = 0;
+		int32 RunningZipCount = 0;
+
+		// The number of running builds that run on build workers, which do not count towards the limit of concurrent UAT tasks.
+		int32 RunningRemoteBuildCount = 0;
+
+		// The index of the build worker the next remote build is sent to.
+		int32 NextBuildWorkerIndex = 0;
+
+		// The tasks that have been initialized and have not been removed yet, in the order they were initialized.
+		TArray<TSharedRef<IPluginBuilderTask>> InitializedTasks;
+
+		// The label of each initialized task shown in the notification, such as "UnrealEngine (5.4)".
+		TMap<const IPluginBuilderTask*, FString> NotificationTaskLabels;
+
+		// The expected seconds until all tasks complete as of the last task transition, and when it was computed.
+		double ExpectedRemainingTimeAtTransition = -1.0;
+		double LastTransitionTime = 0.0;
+
+		// The task counts part of the notification text, rebuilt on task transitions.
+		FString TaskCountsText;
+
+		// The values the notification text was last formatted from.
+		bool bIsNotificationTextDirty = true;
+		int32 DisplayedProgressPercent = INDEX_NONE;
+		int64 DisplayedRemainingSeconds = INDEX_NONE;
+		TArray<FString> DisplayedTaskProgressTexts;
+
 		// Whether the task was canceled.
 		bool bWasCanceled = false;
 
@@ -102,6 +266,23 @@ namespace PluginBuilder
 		// Whether this instance was started in upload-only mode (no build/zip tasks).
 		bool bIsUploadOnlyMode = false;
 
+		// The expected total seconds of each scheduled task found in the timing database.
+		TMap<const IPluginBuilderTask*, double> ExpectedTaskTimes;
+
+		// The time at which each running task was initialized.
+		TMap<const IPluginBuilderTask*, double> TaskStartTimes;
+
+		// The time at which the packaging process started, and the same time in UTC for the run report.
+		double RunStartTime = FPlatformTime::Seconds();
+		FDateTime RunStartDateTime = FDateTime::UtcNow();
+
+		// The measurements of the tasks that have finished.
+		TArray<FTaskRunReport> TaskRunReports;
+
+		// The span of the whole packaging process and of each running task in the trace.
+		int32 RunTraceEventId = INDEX_NONE;
+		TMap<const IPluginBuilderTask*, int32> TaskTraceEventIds;
+
 		// Elapsed time since the last in-progress notification update.
 		float NotificationUpdateTimer = 0.f;
 
@@ -0,0 +1,526 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/RemoteBuildConnection.h"
+#include "PluginBuilder/Utilities/FileReplacer.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformFile.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+namespace PluginBuilder
+{
+	namespace RemoteBuildConnection
+	{
+		// How long each socket wait lasts before checking whether the connection should stop.
+		static const FTimespan PollInterval = FTimespan::FromMilliseconds(100);
+
+		// The extension of the files being received, which are renamed once all of their parts have arrived.
+		static const FString PartialFileExtension = TEXT(".partial");
+
+		// The number of bytes read at a time when comparing files.
+		static constexpr int64 CompareChunkSize = (1024 * 1024);
+
+		// Returns whether the two files have the same contents. The files are compared a chunk at a time so that large binaries are not held in memory.
+		static bool AreFilesIdentical(const FString& FileA, const FString& FileB)
+		{
+			IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+			const TUniquePtr<IFileHandle> FileHandleA(PlatformFile.OpenRead(*FileA));
+			const TUniquePtr<IFileHandle> FileHandleB(PlatformFile.OpenRead(*FileB));
+			if (!FileHandleA.IsValid() || !FileHandleB.IsValid() || (FileHandleA->Size() != FileHandleB->Size()))
+			{
+				return false;
+			}
+
+			TArray<uint8> ChunkA;
+			TArray<uint8> ChunkB;
+			ChunkA.SetNumUninitialized(static_cast<int32>(CompareChunkSize));
+			ChunkB.SetNumUninitialized(static_cast<int32>(CompareChunkSize));
+			for (int64 RemainingSize = FileHandleA->Size(); RemainingSize > 0; RemainingSize -= CompareChunkSize)
+			{
+				const int64 ChunkSize = FMath::Min(RemainingSize, CompareChunkSize);
+				if (!FileHandleA->Read(ChunkA.GetData(), ChunkSize) || !FileHandleB->Read(ChunkB.GetData(), ChunkSize) ||
+					(FMemory::Memcmp(ChunkA.GetData(), ChunkB.GetData(), ChunkSize) != 0))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	const FString FRemoteBuildMessage::Build = TEXT("Build");
+	const FString FRemoteBuildMessage::Accepted = TEXT("Accepted");
+	const FString FRemoteBuildMessage::File = TEXT("File");
+	const FString FRemoteBuildMessage::EndOfFiles = TEXT("EndOfFiles");
+	const FString FRemoteBuildMessage::Output = TEXT("Output");
+	const FString FRemoteBuildMessage::Result = TEXT("Result");
+
+	FRemoteBuildMessage FRemoteBuildMessage::MakeBuild(
+		const FString& EngineVersion,
+		const FUATBatchFileParams& UATBatchFileParams,
+		const FBuildPluginParams& BuildPluginParams
+	)
+	{
+		auto MakeStringValues = [](const TArray<FString>& Strings) -> TArray<TSharedPtr<FJsonValue>>
+		{
+			TArray<TSharedPtr<FJsonValue>> Values;
+			for (const FString& String : Strings)
+			{
+				Values.Add(MakeShared<FJsonValueString>(String));
+			}
+			return Values;
+		};
+
+		FRemoteBuildMessage Message;
+		Message.Type = Build;
+		Message.Fields->SetStringField(TEXT("AccessToken"), BuildPluginParams.BuildWorkerAccessToken);
+		Message.Fields->SetStringField(TEXT("EngineVersion"), EngineVersion);
+		Message.Fields->SetStringField(TEXT("PluginName"), UATBatchFileParams.PluginName);
+		Message.Fields->SetStringField(TEXT("PluginFriendlyName"), UATBatchFileParams.PluginFriendlyName);
+		Message.Fields->SetBoolField(TEXT("bUseFriendlyName"), UATBatchFileParams.bUseFriendlyName);
+		Message.Fields->SetStringField(TEXT("PluginVersionName"), UATBatchFileParams.PluginVersionName);
+		Message.Fields->SetStringField(TEXT("UPluginFileName"), FPaths::GetCleanFilename(UATBatchFileParams.UPluginFile));
+		Message.Fields->SetBoolField(TEXT("bNoHostPlatform"), BuildPluginParams.bNoHostPlatform);
+		Message.Fields->SetArrayField(TEXT("HostPlatforms"), MakeStringValues(BuildPluginParams.HostPlatforms));
+		Message.Fields->SetArrayField(TEXT("TargetPlatforms"), MakeStringValues(BuildPluginParams.TargetPlatforms));
+		Message.Fields->SetBoolField(TEXT("bRocket"), BuildPluginParams.bRocket);
+		Message.Fields->SetBoolField(TEXT("bCreateSubFolder"), BuildPluginParams.bCreateSubFolder);
+		Message.Fields->SetBoolField(TEXT("bStrictIncludes"), BuildPluginParams.bStrictIncludes);
+		Message.Fields->SetBoolField(TEXT("bUnversioned"), BuildPluginParams.bUnversioned);
+		Message.Fields->SetBoolField(TEXT("bBuildWithUBTDirectly"), BuildPluginParams.bBuildWithUBTDirectly);
+		return Message;
+	}
+
+	bool FRemoteBuildMessage::ParseBuild(
+		FString& OutEngineVersion,
+		FUATBatchFileParams& OutUATBatchFileParams,
+		FBuildPluginParams& OutBuildPluginParams
+	) const
+	{
+		return (
+			(Type == Build) &&
+			Fields->TryGetStringField(TEXT("EngineVersion"), OutEngineVersion) &&
+			Fields->TryGetStringField(TEXT("PluginName"), OutUATBatchFileParams.PluginName) &&
+			Fields->TryGetStringField(TEXT("PluginFriendlyName"), OutUATBatchFileParams.PluginFriendlyName) &&
+			Fields->TryGetBoolField(TEXT("bUseFriendlyName"), OutUATBatchFileParams.bUseFriendlyName) &&
+			Fields->TryGetStringField(TEXT("PluginVersionName"), OutUATBatchFileParams.PluginVersionName) &&
+			Fields->TryGetStringField(TEXT("UPluginFileName"), OutUATBatchFileParams.UPluginFile) &&
+			Fields->TryGetBoolField(TEXT("bNoHostPlatform"), OutBuildPluginParams.bNoHostPlatform) &&
+			Fields->TryGetStringArrayField(TEXT("HostPlatforms"), OutBuildPluginParams.HostPlatforms) &&
+			Fields->TryGetStringArrayField(TEXT("TargetPlatforms"), OutBuildPluginParams.TargetPlatforms) &&
+			Fields->TryGetBoolField(TEXT("bRocket"), OutBuildPluginParams.bRocket) &&
+			Fields->TryGetBoolField(TEXT("bCreateSubFolder"), OutBuildPluginParams.bCreateSubFolder) &&
+			Fields->TryGetBoolField(TEXT("bStrictIncludes"), OutBuildPluginParams.bStrictIncludes) &&
+			Fields->TryGetBoolField(TEXT("bUnversioned"), OutBuildPluginParams.bUnversioned) &&
+			Fields->TryGetBoolField(TEXT("bBuildWithUBTDirectly"), OutBuildPluginParams.bBuildWithUBTDirectly)
+		);
+	}
+
+	FRemoteBuildMessage FRemoteBuildMessage::MakeResult(const bool bSucceeded, const FString& Error)
+	{
+		FRemoteBuildMessage Message;
+		Message.Type = Result;
+		Message.Fields->SetBoolField(TEXT("bSucceeded"), bSucceeded);
+		Message.Fields->SetStringField(TEXT("Error"), Error);
+		return Message;
+	}
+
+	FRemoteBuildConnection::FRemoteBuildConnection(FSocket* InSocket)
+		: Socket(InSocket)
+	{
+		check(Socket != nullptr);
+		Socket->SetNonBlocking(true);
+	}
+
+	FRemoteBuildConnection::~FRemoteBuildConnection()
+	{
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+	}
+
+	TSharedPtr<FRemoteBuildConnection> FRemoteBuildConnection::Connect(const FString& Address)
+	{
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		if (SocketSubsystem == nullptr)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to get socket subsystem."));
+			return nullptr;
+		}
+
+		FString Host = Address;
+		int32 PortNo = DefaultPortNo;
+		FString PortString;
+		if (Address.Split(TEXT(":"), &Host, &PortString, ESearchCase::IgnoreCase, ESearchDir::FromEnd))
+		{
+			PortNo = FCString::Atoi(*PortString);
+		}
+
+		const TSharedPtr<FInternetAddr> InternetAddress = SocketSubsystem->GetAddressFromString(Host);
+		if (!InternetAddress.IsValid() || !InternetAddress->IsValid())
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: %s is not a valid address."), *Address);
+			return nullptr;
+		}
+		InternetAddress->SetPort(PortNo);
+
+		FSocket* NewSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("RemoteBuildConnection"), false);
+		if (NewSocket == nullptr)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to create socket."));
+			return nullptr;
+		}
+
+		if (!NewSocket->Connect(*InternetAddress))
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to connect to %s."), *Address);
+			SocketSubsystem->DestroySocket(NewSocket);
+			return nullptr;
+		}
+
+		return MakeShared<FRemoteBuildConnection>(NewSocket);
+	}
+
+	bool FRemoteBuildConnection::Send(const FRemoteBuildMessage& Message)
+	{
+		const TSharedRef<FJsonObject> Header = MakeShared<FJsonObject>(*Message.Fields);
+		Header->SetStringField(TEXT("Type"), Message.Type);
+		Header->SetNumberField(TEXT("PayloadSize"), Message.Payload.Num());
+
+		FString HeaderString;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&HeaderString);
+		FJsonSerializer::Serialize(Header, Writer);
+		const FTCHARToUTF8 HeaderUtf8(*HeaderString);
+
+		const uint32 HeaderSize = static_cast<uint32>(HeaderUtf8.Length());
+		const uint8 HeaderSizeBytes[4] = {
+			static_cast<uint8>(HeaderSize >> 24),
+			static_cast<uint8>(HeaderSize >> 16),
+			static_cast<uint8>(HeaderSize >> 8),
+			static_cast<uint8>(HeaderSize),
+		};
+
+		return SendAll(HeaderSizeBytes, sizeof(HeaderSizeBytes)) &&
+			SendAll(reinterpret_cast<const uint8*>(HeaderUtf8.Get()), HeaderSize) &&
+			SendAll(Message.Payload.GetData(), Message.Payload.Num());
+	}
+
+	bool FRemoteBuildConnection::Receive(FRemoteBuildMessage& OutMessage, const FThreadSafeBool& bShouldStop)
+	{
+		uint8 HeaderSizeBytes[4];
+		if (!ReceiveAll(HeaderSizeBytes, sizeof(HeaderSizeBytes), bShouldStop))
+		{
+			return false;
+		}
+
+		const uint32 HeaderSize = (
+			(static_cast<uint32>(HeaderSizeBytes[0]) << 24) |
+			(static_cast<uint32>(HeaderSizeBytes[1]) << 16) |
+			(static_cast<uint32>(HeaderSizeBytes[2]) << 8) |
+			static_cast<uint32>(HeaderSizeBytes[3])
+		);
+		if (HeaderSize > MaxHeaderSize)
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Received a message of %u bytes, which is larger than allowed."), HeaderSize);
+			return false;
+		}
+
+		TArray<uint8> HeaderBytes;
+		HeaderBytes.SetNumUninitialized(HeaderSize);
+		if (!ReceiveAll(HeaderBytes.GetData(), HeaderSize, bShouldStop))
+		{
+			return false;
+		}
+
+		const FUTF8ToTCHAR HeaderString(reinterpret_cast<const ANSICHAR*>(HeaderBytes.GetData()), HeaderBytes.Num());
+		TSharedPtr<FJsonObject> Header;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FString(HeaderString.Length(), HeaderString.Get())), Header) || !Header.IsValid())
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Received a message that is not JSON."));
+			return false;
+		}
+
+		double PayloadSize = 0.0;
+		if (!Header->TryGetStringField(TEXT("Type"), OutMessage.Type) ||
+			!Header->TryGetNumberField(TEXT("PayloadSize"), PayloadSize) ||
+			(PayloadSize < 0.0) || (PayloadSize > FileChunkSize))
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Received a message without a valid type or payload size."));
+			return false;
+		}
+
+		OutMessage.Fields = Header.ToSharedRef();
+		OutMessage.Payload.SetNumUninitialized(static_cast<int32>(PayloadSize));
+		return ReceiveAll(OutMessage.Payload.GetData(), OutMessage.Payload.Num(), bShouldStop);
+	}
+
+	bool FRemoteBuildConnection::SendDirectory(const FString& DirectoryPath, TFunctionRef<bool(const FString& /* RelativePath */)> ShouldSend, const FThreadSafeBool& bShouldStop)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		const FString NormalizedDirectoryPath = FPaths::ConvertRelativePathToFull(DirectoryPath) / TEXT("");
+
+		TArray<FString> Files;
+		PlatformFile.FindFilesRecursively(Files, *DirectoryPath, nullptr);
+
+		TArray<uint8> Buffer;
+		for (const FString& File : Files)
+		{
+			const FString RelativePath = FPaths::ConvertRelativePathToFull(File).RightChop(NormalizedDirectoryPath.Len());
+			if (!ShouldSend(RelativePath))
+			{
+				continue;
+			}
+
+			const TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*File));
+			if (!FileHandle.IsValid())
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to open %s."), *File);
+				return false;
+			}
+
+			// Empty files are sent as a single message without a payload.
+			const int64 FileSize = FileHandle->Size();
+			int64 Offset = 0;
+			do
+			{
+				if (bShouldStop)
+				{
+					return false;
+				}
+
+				const int64 ChunkSize = FMath::Min(FileSize - Offset, FileChunkSize);
+				Buffer.SetNumUninitialized(static_cast<int32>(ChunkSize));
+				if (!FileHandle->Read(Buffer.GetData(), ChunkSize))
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to read %s."), *File);
+					return false;
+				}
+
+				FRemoteBuildMessage Message;
+				Message.Type = FRemoteBuildMessage::File;
+				Message.Fields->SetStringField(TEXT("Path"), RelativePath);
+				Message.Fields->SetNumberField(TEXT("Offset"), Offset);
+				Message.Fields->SetNumberField(TEXT("Size"), FileSize);
+				Message.Payload = MoveTemp(Buffer);
+				if (!Send(Message))
+				{
+					return false;
+				}
+				Buffer = MoveTemp(Message.Payload);
+
+				Offset += ChunkSize;
+			}
+			while (Offset < FileSize);
+		}
+
+		FRemoteBuildMessage EndMessage;
+		EndMessage.Type = FRemoteBuildMessage::EndOfFiles;
+		return Send(EndMessage);
+	}
+
+	bool FRemoteBuildConnection::ReceiveDirectory(const FString& DirectoryPath, const bool bKeepUnchangedFiles, const FThreadSafeBool& bShouldStop)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		if (!PlatformFile.CreateDirectoryTree(*DirectoryPath))
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to create %s."), *DirectoryPath);
+			return false;
+		}
+
+		TSet<FString> ReceivedPaths;
+		TUniquePtr<IFileHandle> PartialFileHandle;
+
+		// The file being received and the number of its bytes written so far.
+		// The parts of a file must arrive in order and one file at a time, otherwise a part could be written into another file.
+		FString ReceivingRelativePath;
+		int64 ReceivedSize = 0;
+		FRemoteBuildMessage Message;
+		while (Receive(Message, bShouldStop))
+		{
+			if (Message.Type == FRemoteBuildMessage::EndOfFiles)
+			{
+				break;
+			}
+			if (Message.Type != FRemoteBuildMessage::File)
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Received %s while receiving files."), *Message.Type);
+				return false;
+			}
+
+			FString RelativePath;
+			double Offset = 0.0;
+			double Size = 0.0;
+			if (!Message.Fields->TryGetStringField(TEXT("Path"), RelativePath) ||
+				!Message.Fields->TryGetNumberField(TEXT("Offset"), Offset) ||
+				!Message.Fields->TryGetNumberField(TEXT("Size"), Size) ||
+				!IsSafeRelativePath(RelativePath) ||
+				(Size < 0.0) || ((Offset + Message.Payload.Num()) > Size))
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Received a file with invalid fields."));
+				return false;
+			}
+
+			const FString File = (DirectoryPath / RelativePath);
+			const FString PartialFile = (File + RemoteBuildConnection::PartialFileExtension);
+			if (!PartialFileHandle.IsValid())
+			{
+				if ((Offset != 0.0) || ReceivedPaths.Contains(RelativePath))
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Received a part of %s that does not start a new file."), *RelativePath);
+					return false;
+				}
+
+				PlatformFile.CreateDirectoryTree(*FPaths::GetPath(File));
+				PartialFileHandle.Reset(PlatformFile.OpenWrite(*PartialFile));
+				if (!PartialFileHandle.IsValid())
+				{
+					UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to write %s."), *File);
+					return false;
+				}
+				ReceivingRelativePath = RelativePath;
+				ReceivedSize = 0;
+			}
+			else if ((RelativePath != ReceivingRelativePath) || (static_cast<int64>(Offset) != ReceivedSize))
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Received a part of %s at %lld while %lld bytes of %s had been received."), *RelativePath, static_cast<int64>(Offset), ReceivedSize, *ReceivingRelativePath);
+				return false;
+			}
+
+			if (!PartialFileHandle->Write(Message.Payload.GetData(), Message.Payload.Num()))
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to write %s."), *File);
+				return false;
+			}
+			ReceivedSize += Message.Payload.Num();
+			if (ReceivedSize < static_cast<int64>(Size))
+			{
+				continue;
+			}
+
+			PartialFileHandle.Reset();
+			ReceivedPaths.Add(RelativePath);
+			if (bKeepUnchangedFiles && PlatformFile.FileExists(*File) && RemoteBuildConnection::AreFilesIdentical(File, PartialFile))
+			{
+				PlatformFile.DeleteFile(*PartialFile);
+				continue;
+			}
+
+			// The previous file is only replaced once the new one is complete, and in a single rename so that a failed rename leaves it in place.
+			if (!FFileReplacer::ReplaceFile(File, PartialFile))
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: Failed to write %s."), *File);
+				return false;
+			}
+		}
+		if ((Message.Type != FRemoteBuildMessage::EndOfFiles) || PartialFileHandle.IsValid())
+		{
+			UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: The transfer of the files ended before all of them had been received."));
+			return false;
+		}
+
+		if (bKeepUnchangedFiles)
+		{
+			const FString NormalizedDirectoryPath = FPaths::ConvertRelativePathToFull(DirectoryPath) / TEXT("");
+			TArray<FString> Files;
+			PlatformFile.FindFilesRecursively(Files, *DirectoryPath, nullptr);
+			for (const FString& File : Files)
+			{
+				if (!ReceivedPaths.Contains(FPaths::ConvertRelativePathToFull(File).RightChop(NormalizedDirectoryPath.Len())))
+				{
+					PlatformFile.DeleteFile(*File);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void FRemoteBuildConnection::Close()
+	{
+		Socket->Close();
+	}
+
+	bool FRemoteBuildConnection::SendAll(const uint8* Data, const int64 Size)
+	{
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		double LastProgressTime = FPlatformTime::Seconds();
+		int64 TotalSent = 0;
+		while (TotalSent < Size)
+		{
+			if ((FPlatformTime::Seconds() - LastProgressTime) >= SendTimeout)
+			{
+				UE_LOG(LogPluginBuilder, Error, TEXT("Build worker: The other side has not read anything for %.0f seconds, so the connection is given up."), SendTimeout);
+				return false;
+			}
+			if (!Socket->Wait(ESocketWaitConditions::WaitForWrite, RemoteBuildConnection::PollInterval))
+			{
+				continue;
+			}
+
+			// The send buffer can still fill up between the wait and the send, in which case the send is tried again.
+			int32 BytesSent = 0;
+			if (!Socket->Send(Data + TotalSent, static_cast<int32>(Size - TotalSent), BytesSent))
+			{
+				if (SocketSubsystem->GetLastErrorCode() == SE_EWOULDBLOCK)
+				{
+					continue;
+				}
+				return false;
+			}
+			if (BytesSent > 0)
+			{
+				LastProgressTime = FPlatformTime::Seconds();
+				TotalSent += BytesSent;
+			}
+		}
+		return true;
+	}
+
+	bool FRemoteBuildConnection::ReceiveAll(uint8* Data, const int64 Size, const FThreadSafeBool& bShouldStop)
+	{
+		int64 TotalRead = 0;
+		while (TotalRead < Size)
+		{
+			if (bShouldStop)
+			{
+				return false;
+			}
+			if (!Socket->Wait(ESocketWaitConditions::WaitForRead, RemoteBuildConnection::PollInterval))
+			{
+				continue;
+			}
+
+			// Recv fails once the other side has closed the connection, and succeeds without data when there is nothing to read yet.
+			int32 BytesRead = 0;
+			if (!Socket->Recv(Data + TotalRead, static_cast<int32>(Size - TotalRead), BytesRead))
+			{
+				return false;
+			}
+			TotalRead += BytesRead;
+		}
+		return true;
+	}
+
+	bool FRemoteBuildConnection::IsSafeRelativePath(const FString& RelativePath)
+	{
+		if (RelativePath.IsEmpty() || FPaths::IsDrive(RelativePath) || RelativePath.StartsWith(TEXT("/")) || RelativePath.StartsWith(TEXT("\\")))
+		{
+			return false;
+		}
+
+		TArray<FString> PathParts;
+		RelativePath.ParseIntoArray(PathParts, TEXT("/"));
+		return !PathParts.ContainsByPredicate(
+			[](const FString& PathPart) -> bool
+			{
+				return (PathPart == TEXT("..")) || PathPart.Contains(TEXT("\\")) || PathPart.Contains(TEXT(":"));
+			}
+		);
+	}
+}
@@ -0,0 +1,126 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Dom/JsonObject.h"
+#include "PluginBuilder/Types/PackagePluginParams.h"
+
+class FSocket;
+
+namespace PluginBuilder
+{
+	/**
+	 * A message exchanged between the packager and a build worker.
+	 */
+	struct FRemoteBuildMessage
+	{
+	public:
+		// The kind of the message, such as "Build" or "Output".
+		FString Type;
+
+		// The fields of the message.
+		TSharedRef<FJsonObject> Fields = MakeShared<FJsonObject>();
+
+		// The raw bytes that follow the message, such as a part of a file.
+		TArray<uint8> Payload;
+
+	public:
+		// The kinds of messages.
+		// The packager sends Build, and the worker answers Accepted, or Result if it refuses the build.
+		// The packager then sends the source files of the plugin as File messages and EndOfFiles.
+		// The worker sends the output of the build as Output messages, then Result, and the built plugin as File messages and EndOfFiles.
+		static const FString Build;
+		static const FString Accepted;
+		static const FString File;
+		static const FString EndOfFiles;
+		static const FString Output;
+		static const FString Result;
+
+	public:
+		// Returns a Build message that asks a worker to build the plugin for the engine version.
+		// The message carries the access token of the build worker from the parameters.
+		static FRemoteBuildMessage MakeBuild(
+			const FString& EngineVersion,
+			const FUATBatchFileParams& UATBatchFileParams,
+			const FBuildPluginParams& BuildPluginParams
+		);
+
+		// Reads a Build message. The UPluginFile of the parameters is the file name of the descriptor, without a directory.
+		// Returns false if any field is missing. The access token is not read, as it is checked before the request is parsed.
+		bool ParseBuild(
+			FString& OutEngineVersion,
+			FUATBatchFileParams& OutUATBatchFileParams,
+			FBuildPluginParams& OutBuildPluginParams
+		) const;
+
+		// Returns a Result message with the outcome of a build.
+		static FRemoteBuildMessage MakeResult(bool bSucceeded, const FString& Error);
+	};
+
+	/**
+	 * A connection between the packager and a build worker, used from one thread at a time.
+	 * Each message is sent as a 4-byte big-endian length, that many bytes of UTF-8 JSON with a "Type" field,
+	 * and the number of raw bytes given by the "PayloadSize" field of the JSON.
+	 * Files are sent as File messages of up to FileChunkSize bytes each, so that large binaries are not held in memory at once.
+	 * The socket is non-blocking, and a send that makes no progress for SendTimeout fails, so that a peer that stops reading
+	 * without closing the connection cannot hold up the sending thread forever.
+	 */
+	class FRemoteBuildConnection
+	{
+	public:
+		// Constructor. Takes the ownership of the connected socket.
+		explicit FRemoteBuildConnection(FSocket* InSocket);
+
+		// Destructor.
+		~FRemoteBuildConnection();
+
+		// Connects to a build worker at an address such as "127.0.0.1:9100". Returns null if the connection failed.
+		static TSharedPtr<FRemoteBuildConnection> Connect(const FString& Address);
+
+		// Sends a message. Returns false if the connection was closed or the other side stopped reading.
+		bool Send(const FRemoteBuildMessage& Message);
+
+		// Waits for the next message. Returns false if the connection was closed, the message was malformed or bShouldStop was set.
+		bool Receive(FRemoteBuildMessage& OutMessage, const FThreadSafeBool& bShouldStop);
+
+		// Sends the files in the directory that pass the filter as File messages, followed by EndOfFiles.
+		// The filter is given the path relative to the directory. Returns false if the connection was closed or bShouldStop was set.
+		bool SendDirectory(const FString& DirectoryPath, TFunctionRef<bool(const FString& /* RelativePath */)> ShouldSend, const FThreadSafeBool& bShouldStop);
+
+		// Receives File messages into the directory until EndOfFiles. Returns false if the connection was closed or a file could not be written.
+		// When bKeepUnchangedFiles is set, files whose contents have not changed are left as they are so that their timestamps are kept,
+		// and files that were not received are removed, which lets the build on the worker reuse its previous output.
+		bool ReceiveDirectory(const FString& DirectoryPath, bool bKeepUnchangedFiles, const FThreadSafeBool& bShouldStop);
+
+		// Closes the connection. Any thread waiting on it returns.
+		void Close();
+
+		// The port that build workers listen on by default.
+		static constexpr int32 DefaultPortNo = 9100;
+
+	private:
+		// Sends all of the specified bytes. Returns false if the connection was closed or no byte could be sent for SendTimeout.
+		bool SendAll(const uint8* Data, int64 Size);
+
+		// Receives exactly the specified number of bytes. Returns false if the connection was closed or bShouldStop was set.
+		bool ReceiveAll(uint8* Data, int64 Size, const FThreadSafeBool& bShouldStop);
+
+		// Returns whether a path received from the other side stays within the directory it is written to.
+		static bool IsSafeRelativePath(const FString& RelativePath);
+
+	private:
+		// The connected socket.
+		FSocket* Socket;
+
+		// The largest number of file bytes sent in one message.
+		static constexpr int64 FileChunkSize = (4 * 1024 * 1024);
+
+		// The largest JSON part of a message that is accepted.
+		static constexpr uint32 MaxHeaderSize = (1024 * 1024);
+
+		// How long a send waits for the other side to read before the connection is given up, in seconds.
+		static constexpr double SendTimeout = 60.0;
+	};
+}
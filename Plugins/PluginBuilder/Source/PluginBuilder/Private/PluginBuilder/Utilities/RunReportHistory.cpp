@@ -0,0 +1,334 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/RunReportHistory.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace PluginBuilder
+{
+	namespace RunReportHistory
+	{
+		// The units of the compared measurements, used to format them in descriptions.
+		enum class EMetricUnit : uint8
+		{
+			Seconds,
+			Megabytes,
+			Bytes,
+		};
+
+		// A measurement that is compared against the previous runs.
+		struct FComparedMetric
+		{
+		public:
+			// The name of the measurement in the report, and the name shown in descriptions.
+			const TCHAR* Name;
+			const TCHAR* DisplayName;
+
+			// The unit of the measurement.
+			EMetricUnit Unit;
+
+			// The smallest increase that is reported, so that small tasks do not report noise as regressions.
+			double MinIncrease;
+		};
+
+		// The measurements where a larger value is worse.
+		static const FComparedMetric ComparedMetrics[] = {
+			{ TEXT("wallSeconds"), TEXT("wall time"), EMetricUnit::Seconds, 10.0 },
+			{ TEXT("startupSeconds"), TEXT("startup time"), EMetricUnit::Seconds, 10.0 },
+			{ TEXT("compileSeconds"), TEXT("compile time"), EMetricUnit::Seconds, 10.0 },
+			{ TEXT("linkSeconds"), TEXT("link time"), EMetricUnit::Seconds, 10.0 },
+			{ TEXT("zipSeconds"), TEXT("zip time"), EMetricUnit::Seconds, 10.0 },
+			{ TEXT("uploadSeconds"), TEXT("upload time"), EMetricUnit::Seconds, 10.0 },
+			{ TEXT("cpuSeconds"), TEXT("CPU time"), EMetricUnit::Seconds, 10.0 },
+			{ TEXT("peakMemoryMB"), TEXT("peak memory"), EMetricUnit::Megabytes, 256.0 },
+			{ TEXT("zippedBytes"), TEXT("zip size"), EMetricUnit::Bytes, 1024.0 * 1024.0 },
+		};
+
+		// Returns a short human readable form of a value, such as "1m 05s" or "12.3 MB".
+		static FString FormatValue(const double Value, const EMetricUnit Unit)
+		{
+			switch (Unit)
+			{
+			case EMetricUnit::Seconds:
+				{
+					const int64 TotalSeconds = FMath::Max<int64>(FMath::RoundToInt(Value), 0);
+					if (TotalSeconds >= 3600)
+					{
+						return FString::Printf(TEXT("%lldh %02lldm"), TotalSeconds / 3600, (TotalSeconds % 3600) / 60);
+					}
+					if (TotalSeconds >= 60)
+					{
+						return FString::Printf(TEXT("%lldm %02llds"), TotalSeconds / 60, TotalSeconds % 60);
+					}
+					return FString::Printf(TEXT("%llds"), TotalSeconds);
+				}
+
+			case EMetricUnit::Megabytes:
+				return FString::Printf(TEXT("%.0f MB"), Value);
+
+			case EMetricUnit::Bytes:
+				return FString::Printf(TEXT("%.1f MB"), Value / (1024.0 * 1024.0));
+
+			default:
+				return FString::SanitizeFloat(Value);
+			}
+		}
+	}
+
+	TArray<FPackageRunReport> FRunReportHistory::LoadRecentReports(const FString& PluginName, const int32 MaxNumReports)
+	{
+		const FString DirectoryPath = GetReportDirectoryPath(PluginName);
+
+		TArray<FString> FileNames;
+		IFileManager::Get().FindFiles(FileNames, *(DirectoryPath / TEXT("*.json")), true, false);
+
+		// The file names are timestamps, so they sort in the order the reports were written.
+		FileNames.Sort(
+			[](const FString& A, const FString& B) -> bool
+			{
+				return (A > B);
+			}
+		);
+
+		TArray<FPackageRunReport> Reports;
+		for (const FString& FileName : FileNames)
+		{
+			if (Reports.Num() >= MaxNumReports)
+			{
+				break;
+			}
+
+			const FString FilePath = (DirectoryPath / FileName);
+			FString JsonString;
+			if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+			{
+				continue;
+			}
+
+			TSharedPtr<FJsonObject> JsonObject;
+			const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+			FPackageRunReport Report;
+			if (FJsonSerializer::Deserialize(Reader, JsonObject) && FromJson(JsonObject, Report))
+			{
+				Report.FilePath = FilePath;
+				Reports.Add(MoveTemp(Report));
+			}
+			else
+			{
+				UE_LOG(LogPluginBuilder, Verbose, TEXT("Skipped a broken run report. (%s)"), *FilePath);
+			}
+		}
+
+		return Reports;
+	}
+
+	TArray<FRunRegression> FRunReportHistory::FindRegressions(const FPackageRunReport& Report, const TArray<FPackageRunReport>& PreviousReports, const double ThresholdRatio)
+	{
+		TArray<FRunRegression> Regressions;
+		for (const FTaskRunReport& Task : Report.Tasks)
+		{
+			if (!Task.bSucceeded || Task.TimingKey.IsEmpty())
+			{
+				continue;
+			}
+
+			for (const RunReportHistory::FComparedMetric& Metric : RunReportHistory::ComparedMetrics)
+			{
+				const double* Value = Task.Metrics.Find(Metric.Name);
+				if (Value == nullptr)
+				{
+					continue;
+				}
+
+				// Canceled and failed runs stop early, so they would make the baseline look faster than it is.
+				double BaselineTotal = 0.0;
+				int32 NumBaselineValues = 0;
+				for (const FPackageRunReport& PreviousReport : PreviousReports)
+				{
+					const FTaskRunReport* PreviousTask = PreviousReport.FindTask(Task.TimingKey);
+					if ((PreviousTask == nullptr) || !PreviousTask->bSucceeded || PreviousReport.bWasCanceled)
+					{
+						continue;
+					}
+
+					if (const double* PreviousValue = PreviousTask->Metrics.Find(Metric.Name))
+					{
+						BaselineTotal += *PreviousValue;
+						NumBaselineValues++;
+					}
+					if (NumBaselineValues >= NumBaselineRuns)
+					{
+						break;
+					}
+				}
+				if (NumBaselineValues < MinBaselineRuns)
+				{
+					continue;
+				}
+
+				const double BaselineValue = (BaselineTotal / NumBaselineValues);
+				if ((BaselineValue <= 0.0) || (*Value <= BaselineValue * (1.0 + ThresholdRatio)) || ((*Value - BaselineValue) < Metric.MinIncrease))
+				{
+					continue;
+				}
+
+				FRunRegression& Regression = Regressions.AddDefaulted_GetRef();
+				Regression.TaskName = Task.TaskName;
+				Regression.MetricName = Metric.Name;
+				Regression.Value = *Value;
+				Regression.BaselineValue = BaselineValue;
+				Regression.NumBaselineRuns = NumBaselineValues;
+				Regression.Description = FString::Printf(
+					TEXT("%s %s +%d%% vs last %d runs (%s vs %s)"),
+					*Task.TaskName,
+					Metric.DisplayName,
+					FMath::RoundToInt((*Value / BaselineValue - 1.0) * 100.0),
+					NumBaselineValues,
+					*RunReportHistory::FormatValue(*Value, Metric.Unit),
+					*RunReportHistory::FormatValue(BaselineValue, Metric.Unit)
+				);
+			}
+		}
+
+		return Regressions;
+	}
+
+	FString FRunReportHistory::Save(const FPackageRunReport& Report)
+	{
+		FString JsonString;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+		FJsonSerializer::Serialize(ToJson(Report), Writer);
+
+		const FString DirectoryPath = GetReportDirectoryPath(Report.PluginName);
+		const FString FilePath = (DirectoryPath / FString::Printf(TEXT("%s.json"), *Report.StartTime.ToString(TEXT("%Y%m%d_%H%M%S"))));
+		if (!FFileHelper::SaveStringToFile(JsonString, *FilePath))
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Failed to save the run report. (%s)"), *FilePath);
+			return FString();
+		}
+
+		TArray<FString> FileNames;
+		IFileManager::Get().FindFiles(FileNames, *(DirectoryPath / TEXT("*.json")), true, false);
+		if (FileNames.Num() > MaxStoredReports)
+		{
+			FileNames.Sort();
+			for (int32 Index = 0; Index < FileNames.Num() - MaxStoredReports; Index++)
+			{
+				IFileManager::Get().Delete(*(DirectoryPath / FileNames[Index]));
+			}
+		}
+
+		return FilePath;
+	}
+
+	FString FRunReportHistory::GetReportDirectoryPath(const FString& PluginName)
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PluginBuilder") / TEXT("RunReports") / FPaths::MakeValidFileName(PluginName));
+	}
+
+	TSharedRef<FJsonObject> FRunReportHistory::ToJson(const FPackageRunReport& Report)
+	{
+		TArray<TSharedPtr<FJsonValue>> TaskValues;
+		for (const FTaskRunReport& Task : Report.Tasks)
+		{
+			const TSharedRef<FJsonObject> MetricsObject = MakeShared<FJsonObject>();
+			for (const auto& Pair : Task.Metrics)
+			{
+				MetricsObject->SetNumberField(Pair.Key, Pair.Value);
+			}
+
+			const TSharedRef<FJsonObject> TaskObject = MakeShared<FJsonObject>();
+			TaskObject->SetStringField(TEXT("name"), Task.TaskName);
+			TaskObject->SetStringField(TEXT("timingKey"), Task.TimingKey);
+			TaskObject->SetBoolField(TEXT("succeeded"), Task.bSucceeded);
+			TaskObject->SetObjectField(TEXT("metrics"), MetricsObject);
+			TaskValues.Add(MakeShared<FJsonValueObject>(TaskObject));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> RegressionValues;
+		for (const FRunRegression& Regression : Report.Regressions)
+		{
+			const TSharedRef<FJsonObject> RegressionObject = MakeShared<FJsonObject>();
+			RegressionObject->SetStringField(TEXT("task"), Regression.TaskName);
+			RegressionObject->SetStringField(TEXT("metric"), Regression.MetricName);
+			RegressionObject->SetNumberField(TEXT("value"), Regression.Value);
+			RegressionObject->SetNumberField(TEXT("baseline"), Regression.BaselineValue);
+			RegressionObject->SetNumberField(TEXT("baselineRuns"), Regression.NumBaselineRuns);
+			RegressionObject->SetStringField(TEXT("description"), Regression.Description);
+			RegressionValues.Add(MakeShared<FJsonValueObject>(RegressionObject));
+		}
+
+		const TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetNumberField(TEXT("version"), FileVersion);
+		RootObject->SetStringField(TEXT("plugin"), Report.PluginName);
+		RootObject->SetStringField(TEXT("pluginVersion"), Report.PluginVersionName);
+		RootObject->SetStringField(TEXT("startTime"), Report.StartTime.ToIso8601());
+		RootObject->SetNumberField(TEXT("wallSeconds"), Report.WallSeconds);
+		RootObject->SetBoolField(TEXT("succeeded"), Report.bSucceeded);
+		RootObject->SetBoolField(TEXT("canceled"), Report.bWasCanceled);
+		RootObject->SetArrayField(TEXT("tasks"), TaskValues);
+		RootObject->SetArrayField(TEXT("regressions"), RegressionValues);
+		return RootObject;
+	}
+
+	bool FRunReportHistory::FromJson(const TSharedPtr<FJsonObject>& JsonObject, FPackageRunReport& OutReport)
+	{
+		int32 Version = 0;
+		if (!JsonObject.IsValid() || !JsonObject->TryGetNumberField(TEXT("version"), Version) || (Version != FileVersion))
+		{
+			return false;
+		}
+
+		JsonObject->TryGetStringField(TEXT("plugin"), OutReport.PluginName);
+		JsonObject->TryGetStringField(TEXT("pluginVersion"), OutReport.PluginVersionName);
+		JsonObject->TryGetNumberField(TEXT("wallSeconds"), OutReport.WallSeconds);
+		JsonObject->TryGetBoolField(TEXT("succeeded"), OutReport.bSucceeded);
+		JsonObject->TryGetBoolField(TEXT("canceled"), OutReport.bWasCanceled);
+
+		FString StartTime;
+		if (JsonObject->TryGetStringField(TEXT("startTime"), StartTime))
+		{
+			FDateTime::ParseIso8601(*StartTime, OutReport.StartTime);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* TaskValues = nullptr;
+		if (JsonObject->TryGetArrayField(TEXT("tasks"), TaskValues) && (TaskValues != nullptr))
+		{
+			for (const TSharedPtr<FJsonValue>& TaskValue : *TaskValues)
+			{
+				const TSharedPtr<FJsonObject>* TaskObject = nullptr;
+				if (!TaskValue.IsValid() || !TaskValue->TryGetObject(TaskObject) || (TaskObject == nullptr))
+				{
+					continue;
+				}
+
+				FTaskRunReport& Task = OutReport.Tasks.AddDefaulted_GetRef();
+				(*TaskObject)->TryGetStringField(TEXT("name"), Task.TaskName);
+				(*TaskObject)->TryGetStringField(TEXT("timingKey"), Task.TimingKey);
+				(*TaskObject)->TryGetBoolField(TEXT("succeeded"), Task.bSucceeded);
+
+				const TSharedPtr<FJsonObject>* MetricsObject = nullptr;
+				if ((*TaskObject)->TryGetObjectField(TEXT("metrics"), MetricsObject) && (MetricsObject != nullptr))
+				{
+					for (const auto& Pair : (*MetricsObject)->Values)
+					{
+						double Value = 0.0;
+						if (Pair.Value.IsValid() && Pair.Value->TryGetNumber(Value))
+						{
+							Task.Metrics.Add(Pair.Key, Value);
+						}
+					}
+				}
+			}
+		}
+
+		// Regressions of previous runs are only informative, so they are not read back.
+		return true;
+	}
+}
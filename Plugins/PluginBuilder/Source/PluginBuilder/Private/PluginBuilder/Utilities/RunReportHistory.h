@@ -0,0 +1,51 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/Types/PackageRunReport.h"
+
+class FJsonObject;
+
+namespace PluginBuilder
+{
+	/**
+	 * Stores the run reports of packaging processes as json files and compares a new report against the previous runs of the same plugin.
+	 * Reports are written to Saved/PluginBuilder/RunReports/<Plugin>/<timestamp>.json, and only the most recent ones are kept.
+	 * Nothing here depends on the editor UI, so that reports are also written when packaging runs headless.
+	 */
+	class FRunReportHistory
+	{
+	public:
+		// Returns the reports of the plugin, newest first, up to the specified number.
+		static TArray<FPackageRunReport> LoadRecentReports(const FString& PluginName, int32 MaxNumReports);
+
+		// Returns the measurements of the report that exceed the average of the same task in the previous runs by more than the threshold.
+		// ThresholdRatio is the allowed increase, such as 0.25 for 25%. Only successful tasks and previous runs are compared.
+		static TArray<FRunRegression> FindRegressions(const FPackageRunReport& Report, const TArray<FPackageRunReport>& PreviousReports, double ThresholdRatio);
+
+		// Writes the report to a new file and removes the oldest reports of the plugin beyond the limit. Returns the path, or empty on failure.
+		static FString Save(const FPackageRunReport& Report);
+
+		// Returns the path of the directory where the reports of the plugin are stored.
+		static FString GetReportDirectoryPath(const FString& PluginName);
+
+		// The number of previous runs a new report is compared against.
+		static constexpr int32 NumBaselineRuns = 10;
+
+	private:
+		// Converts between a report and its json representation.
+		static TSharedRef<FJsonObject> ToJson(const FPackageRunReport& Report);
+		static bool FromJson(const TSharedPtr<FJsonObject>& JsonObject, FPackageRunReport& OutReport);
+
+	private:
+		// The fewest previous runs that a measurement is compared against, so that a single slow run is not taken as the norm.
+		static constexpr int32 MinBaselineRuns = 3;
+
+		// The number of reports kept for each plugin.
+		static constexpr int32 MaxStoredReports = 50;
+
+		// The version of the report file format.
+		static constexpr int32 FileVersion = 1;
+	};
+}
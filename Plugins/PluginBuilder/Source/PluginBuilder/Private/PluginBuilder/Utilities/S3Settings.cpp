@@ -0,0 +1,34 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/S3Settings.h"
+
+US3Settings::US3Settings()
+	: Endpoint(TEXT("http://localhost:9000"))
+	, Region(TEXT("us-east-1"))
+	, bUsePathStyle(true)
+	, PartSize(16)
+	, MaxConcurrentParts(8)
+	, ShareUrlExpiration(168)
+{
+}
+
+FString US3Settings::GetSettingsName() const
+{
+	return TEXT("S3");
+}
+
+bool US3Settings::IsConfigured() const
+{
+	return (
+		!Endpoint.IsEmpty() &&
+		!Region.IsEmpty() &&
+		!Bucket.IsEmpty() &&
+		!AccessKeyId.IsEmpty() &&
+		!SecretAccessKey.IsEmpty()
+	);
+}
+
+int64 US3Settings::GetPartSizeInBytes() const
+{
+	return (static_cast<int64>(FMath::Clamp(PartSize, 5, 2047)) * 1024 * 1024);
+}
@@ -0,0 +1,79 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/Utilities/PluginBuilderSettings.h"
+#include "S3Settings.generated.h"
+
+/**
+ * Editor preferences for uploading to Amazon S3 or an S3-compatible storage such as MinIO.
+ */
+UCLASS(GlobalUserConfig)
+class PLUGINBUILDER_API US3Settings : public UPluginBuilderSettings
+{
+	GENERATED_BODY()
+
+public:
+	// This class is read-only.
+	using UReference = const US3Settings&;
+
+public:
+	// The endpoint URL of the S3 API, including the scheme and port.
+	// e.g. https://s3.us-east-1.amazonaws.com, or http://localhost:9000 for a local MinIO instance.
+	UPROPERTY(EditAnywhere, Config, Category = "Connection")
+	FString Endpoint;
+
+	// The region used for request signing. MinIO accepts us-east-1 unless configured otherwise.
+	UPROPERTY(EditAnywhere, Config, Category = "Connection")
+	FString Region;
+
+	// The name of the bucket to upload to.
+	UPROPERTY(EditAnywhere, Config, Category = "Connection")
+	FString Bucket;
+
+	// Whether to address the bucket as part of the path (http://host/bucket/key) instead of the host name (http://bucket.host/key).
+	// S3-compatible storages such as MinIO usually require this.
+	UPROPERTY(EditAnywhere, Config, Category = "Connection")
+	bool bUsePathStyle;
+
+	// The access key ID used for request signing.
+	UPROPERTY(EditAnywhere, Config, Category = "Credentials")
+	FString AccessKeyId;
+
+	// The secret access key used for request signing.
+	UPROPERTY(EditAnywhere, Config, Category = "Credentials", meta = (PasswordField = true))
+	FString SecretAccessKey;
+
+	// The key prefix inside the bucket where plugins will be uploaded.
+	// Leave empty to upload directly under the bucket root (e.g. PluginName/...).
+	UPROPERTY(EditAnywhere, Config, Category = "Upload")
+	FString KeyPrefix;
+
+	// The size of each part of a multipart upload in MB. Files up to this size are uploaded with a single request.
+	// S3 requires at least 5 MB and allows at most 10000 parts per file. Each part is held in one buffer, which is limited to 2047 MB.
+	UPROPERTY(EditAnywhere, Config, Category = "Upload", meta = (ClampMin = 5, ClampMax = 2047, Units = "MB"))
+	int32 PartSize;
+
+	// The maximum number of parts uploaded at the same time. Memory usage is about PartSize times this value.
+	UPROPERTY(EditAnywhere, Config, Category = "Upload", meta = (ClampMin = 1, ClampMax = 64))
+	int32 MaxConcurrentParts;
+
+	// How long the share URLs remain valid, in hours. Presigned URLs cannot be valid for more than 7 days.
+	UPROPERTY(EditAnywhere, Config, Category = "Share URL", meta = (ClampMin = 1, ClampMax = 168, Units = "Hours"))
+	int32 ShareUrlExpiration;
+
+public:
+	// Constructor.
+	US3Settings();
+
+	// UPluginBuilderSettings interface.
+	virtual FString GetSettingsName() const override;
+	// End of UPluginBuilderSettings interface.
+
+	// Returns whether all the values needed to sign requests are set.
+	bool IsConfigured() const;
+
+	// Returns the part size in bytes.
+	int64 GetPartSizeInBytes() const;
+};
@@ -0,0 +1,58 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/TaskOutputLog.h"
+
+namespace PluginBuilder
+{
+	FTaskOutputLog::FTaskOutputLog(const int32 InMaxLines /* = DefaultMaxLines */)
+		: MaxLines(FMath::Max(InMaxLines, 1))
+		, OldestLineIndex(0)
+		, NumAddedLines(0)
+	{
+		Lines.Reserve(MaxLines);
+	}
+
+	void FTaskOutputLog::AddLine(const TCHAR* Line)
+	{
+		check(IsInGameThread());
+
+		NumAddedLines++;
+		if (Lines.Num() < MaxLines)
+		{
+			Lines.Emplace(Line);
+			return;
+		}
+
+		// Assigning to the existing string reuses its allocation when the new line fits in it.
+		Lines[OldestLineIndex] = Line;
+		OldestLineIndex = ((OldestLineIndex + 1) % MaxLines);
+	}
+
+	void FTaskOutputLog::AddDiagnostic(const FBuildDiagnostic& Diagnostic)
+	{
+		check(IsInGameThread());
+
+		Diagnostics.Add(Diagnostic);
+	}
+
+	int32 FTaskOutputLog::GetNumLines() const
+	{
+		return Lines.Num();
+	}
+
+	const FString& FTaskOutputLog::GetLine(const int32 Index) const
+	{
+		check(Lines.IsValidIndex(Index));
+		return Lines[(OldestLineIndex + Index) % Lines.Num()];
+	}
+
+	uint64 FTaskOutputLog::GetNumAddedLines() const
+	{
+		return NumAddedLines;
+	}
+
+	const TArray<FBuildDiagnostic>& FTaskOutputLog::GetDiagnostics() const
+	{
+		return Diagnostics;
+	}
+}
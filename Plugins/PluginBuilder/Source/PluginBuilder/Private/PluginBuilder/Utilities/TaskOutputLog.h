@@ -0,0 +1,60 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/Types/BuildDiagnostics.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * Keeps the output of one task for the build monitor.
+	 * The lines are kept in a ring buffer of a fixed number of slots, so a long build only keeps its latest output and
+	 * reuses the memory of the oldest lines. The diagnostics are kept apart from the lines as they are found by the parser,
+	 * so that they can be filtered and searched without going through the whole output.
+	 */
+	class FTaskOutputLog
+	{
+	public:
+		// Constructor.
+		explicit FTaskOutputLog(int32 InMaxLines = DefaultMaxLines);
+
+		// Adds a line of output, overwriting the oldest line if the buffer is full.
+		void AddLine(const TCHAR* Line);
+
+		// Adds an error or warning found in the output.
+		void AddDiagnostic(const FBuildDiagnostic& Diagnostic);
+
+		// Returns the number of lines kept in the buffer.
+		int32 GetNumLines() const;
+
+		// Returns the line at the specified index, where 0 is the oldest line kept in the buffer.
+		// The returned reference points to the slot of the line, which is overwritten once the buffer wraps around to it.
+		const FString& GetLine(int32 Index) const;
+
+		// Returns the number of lines added so far including the overwritten ones, which tells whether any line has been added.
+		uint64 GetNumAddedLines() const;
+
+		// Returns the errors and warnings in the order they were found.
+		const TArray<FBuildDiagnostic>& GetDiagnostics() const;
+
+	private:
+		// The slots of the lines. Slots are reserved up front and never reallocated, so references to them stay valid.
+		TArray<FString> Lines;
+
+		// The maximum number of lines kept in the buffer.
+		int32 MaxLines;
+
+		// The index of the slot of the oldest line once the buffer is full.
+		int32 OldestLineIndex;
+
+		// The number of lines added so far.
+		uint64 NumAddedLines;
+
+		// The errors and warnings found in the output.
+		TArray<FBuildDiagnostic> Diagnostics;
+
+		// The number of lines kept by default, which is enough for the tail of a full engine-wide build.
+		static constexpr int32 DefaultMaxLines = 20000;
+	};
+}
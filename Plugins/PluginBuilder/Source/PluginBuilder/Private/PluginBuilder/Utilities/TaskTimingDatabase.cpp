@@ -0,0 +1,186 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/TaskTimingDatabase.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace PluginBuilder
+{
+	FTaskTimingDatabase& FTaskTimingDatabase::Get()
+	{
+		check(IsInGameThread());
+		static FTaskTimingDatabase Instance;
+		static bool bIsLoaded = false;
+		if (!bIsLoaded)
+		{
+			Instance.Load();
+			bIsLoaded = true;
+		}
+		return Instance;
+	}
+
+	bool FTaskTimingDatabase::FindExpectedTimes(const FString& Key, FTaskPhaseTimes& OutTimes) const
+	{
+		if (const FEntry* Entry = Entries.Find(Key))
+		{
+			OutTimes = Entry->AverageTimes;
+			return true;
+		}
+
+		return false;
+	}
+
+	double FTaskTimingDatabase::GetExpectedTotalTime(const FString& Key) const
+	{
+		if (const FEntry* Entry = Entries.Find(Key))
+		{
+			return Entry->AverageTimes.GetTotal();
+		}
+
+		return -1.0;
+	}
+
+	void FTaskTimingDatabase::Record(const FString& Key, const FTaskPhaseTimes& Times)
+	{
+		if (Key.IsEmpty())
+		{
+			return;
+		}
+
+		FEntry& Entry = Entries.FindOrAdd(Key);
+		Entry.NumSamples = FMath::Min(Entry.NumSamples + 1, MaxAveragedSamples);
+
+		// Averages the first samples evenly, then weights the latest one by 1 / MaxAveragedSamples.
+		const double Weight = 1.0 / static_cast<double>(Entry.NumSamples);
+		for (int32 Index = 0; Index < static_cast<int32>(ETaskPhase::Num); Index++)
+		{
+			const ETaskPhase Phase = static_cast<ETaskPhase>(Index);
+			const double Average = Entry.AverageTimes.Get(Phase);
+			Entry.AverageTimes.Set(Phase, Average + (Times.Get(Phase) - Average) * Weight);
+		}
+		Entry.LastRecorded = FDateTime::UtcNow();
+
+		bIsDirty = true;
+	}
+
+	void FTaskTimingDatabase::SaveIfDirty()
+	{
+		if (!bIsDirty)
+		{
+			return;
+		}
+
+		const TSharedRef<FJsonObject> EntriesObject = MakeShared<FJsonObject>();
+		for (const auto& Pair : Entries)
+		{
+			const FEntry& Entry = Pair.Value;
+
+			const TSharedRef<FJsonObject> PhasesObject = MakeShared<FJsonObject>();
+			for (int32 Index = 0; Index < static_cast<int32>(ETaskPhase::Num); Index++)
+			{
+				const ETaskPhase Phase = static_cast<ETaskPhase>(Index);
+				if (Entry.AverageTimes.Get(Phase) > 0.0)
+				{
+					PhasesObject->SetNumberField(LexToString(Phase), Entry.AverageTimes.Get(Phase));
+				}
+			}
+
+			const TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+			EntryObject->SetObjectField(TEXT("phases"), PhasesObject);
+			EntryObject->SetNumberField(TEXT("samples"), Entry.NumSamples);
+			EntryObject->SetStringField(TEXT("lastRecorded"), Entry.LastRecorded.ToIso8601());
+			EntriesObject->SetObjectField(Pair.Key, EntryObject);
+		}
+
+		const TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetNumberField(TEXT("version"), FileVersion);
+		RootObject->SetObjectField(TEXT("entries"), EntriesObject);
+
+		FString JsonString;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+		FJsonSerializer::Serialize(RootObject, Writer);
+
+		const FString FilePath = GetDatabaseFilePath();
+		if (FFileHelper::SaveStringToFile(JsonString, *FilePath))
+		{
+			bIsDirty = false;
+		}
+		else
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("Failed to save the task timing database. (%s)"), *FilePath);
+		}
+	}
+
+	FString FTaskTimingDatabase::GetDatabaseFilePath()
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PluginBuilder") / TEXT("TaskTimings.json"));
+	}
+
+	void FTaskTimingDatabase::Load()
+	{
+		Entries.Reset();
+		bIsDirty = false;
+
+		const FString FilePath = GetDatabaseFilePath();
+		FString JsonString;
+		if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+		{
+			return;
+		}
+
+		TSharedPtr<FJsonObject> RootObject;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+		if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+		{
+			UE_LOG(LogPluginBuilder, Warning, TEXT("The task timing database is broken and will be recreated. (%s)"), *FilePath);
+			return;
+		}
+
+		int32 Version = 0;
+		const TSharedPtr<FJsonObject>* EntriesObject = nullptr;
+		if (!RootObject->TryGetNumberField(TEXT("version"), Version) || (Version != FileVersion) ||
+			!RootObject->TryGetObjectField(TEXT("entries"), EntriesObject) || (EntriesObject == nullptr))
+		{
+			return;
+		}
+
+		for (const auto& Pair : (*EntriesObject)->Values)
+		{
+			const TSharedPtr<FJsonObject>* EntryObject = nullptr;
+			const TSharedPtr<FJsonObject>* PhasesObject = nullptr;
+			if (!Pair.Value.IsValid() || !Pair.Value->TryGetObject(EntryObject) || (EntryObject == nullptr) ||
+				!(*EntryObject)->TryGetObjectField(TEXT("phases"), PhasesObject) || (PhasesObject == nullptr))
+			{
+				continue;
+			}
+
+			FEntry Entry;
+			for (const auto& PhasePair : (*PhasesObject)->Values)
+			{
+				ETaskPhase Phase;
+				double Seconds = 0.0;
+				if (LexTryParseString(Phase, *PhasePair.Key) && PhasePair.Value.IsValid() && PhasePair.Value->TryGetNumber(Seconds))
+				{
+					Entry.AverageTimes.Set(Phase, FMath::Max(Seconds, 0.0));
+				}
+			}
+
+			int32 NumSamples = 1;
+			(*EntryObject)->TryGetNumberField(TEXT("samples"), NumSamples);
+			Entry.NumSamples = FMath::Clamp(NumSamples, 1, MaxAveragedSamples);
+
+			FString LastRecorded;
+			if ((*EntryObject)->TryGetStringField(TEXT("lastRecorded"), LastRecorded))
+			{
+				FDateTime::ParseIso8601(*LastRecorded, Entry.LastRecorded);
+			}
+
+			Entries.Add(Pair.Key, Entry);
+		}
+	}
+}
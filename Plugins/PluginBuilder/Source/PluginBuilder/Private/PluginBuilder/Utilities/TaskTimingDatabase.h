@@ -0,0 +1,67 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/Types/TaskPhaseTimes.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * A local database of how long each task took in past packaging processes, used to predict how long the next one takes.
+	 * Entries are keyed by the task timing key, such as "Build|MyPlugin|5.4|Win64", and hold a moving average of each phase.
+	 * The database is stored as a json file in the Saved/PluginBuilder folder of the project.
+	 */
+	class FTaskTimingDatabase
+	{
+	public:
+		// Returns the database shared by all packaging processes, loading it on first use. Must be used from the game thread.
+		static FTaskTimingDatabase& Get();
+
+		// Returns the expected seconds of each phase for the key. Returns false if the key has never been recorded.
+		bool FindExpectedTimes(const FString& Key, FTaskPhaseTimes& OutTimes) const;
+
+		// Returns the expected total seconds for the key, or a negative value if the key has never been recorded.
+		double GetExpectedTotalTime(const FString& Key) const;
+
+		// Adds the times of a successfully completed task to the average for the key.
+		void Record(const FString& Key, const FTaskPhaseTimes& Times);
+
+		// Writes the database to the file if it has changed since it was loaded or last saved.
+		void SaveIfDirty();
+
+		// Returns the path of the database file.
+		static FString GetDatabaseFilePath();
+
+	private:
+		// Reads the database from the file.
+		void Load();
+
+	private:
+		// A record of the times for one key.
+		struct FEntry
+		{
+		public:
+			// The moving average of the seconds spent in each phase.
+			FTaskPhaseTimes AverageTimes;
+
+			// The number of times recorded so far.
+			int32 NumSamples = 0;
+
+			// When the entry was last recorded.
+			FDateTime LastRecorded;
+		};
+
+		// The entries keyed by the task timing key.
+		TMap<FString, FEntry> Entries;
+
+		// Whether the entries have changed since they were loaded or last saved.
+		bool bIsDirty = false;
+
+		// The number of recent samples the moving average effectively covers, so that the prediction follows changes in the plugin.
+		static constexpr int32 MaxAveragedSamples = 5;
+
+		// The version of the database file format.
+		static constexpr int32 FileVersion = 1;
+	};
+}
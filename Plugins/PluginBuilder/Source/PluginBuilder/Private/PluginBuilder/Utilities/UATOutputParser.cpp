@@ -0,0 +1,573 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Utilities/UATOutputParser.h"
+
+namespace PluginBuilder
+{
+	namespace UATOutputParser
+	{
+		static bool IsSpace(const ANSICHAR Char)
+		{
+			return (Char == ' ' || Char == '\t');
+		}
+
+		static bool IsDigit(const ANSICHAR Char)
+		{
+			return (Char >= '0' && Char <= '9');
+		}
+
+		static bool IsAlnum(const ANSICHAR Char)
+		{
+			return (IsDigit(Char) || (Char >= 'a' && Char <= 'z') || (Char >= 'A' && Char <= 'Z'));
+		}
+
+		static const ANSICHAR* SkipSpaces(const ANSICHAR* Begin, const ANSICHAR* End)
+		{
+			while (Begin < End && IsSpace(*Begin))
+			{
+				Begin++;
+			}
+			return Begin;
+		}
+
+		static const ANSICHAR* TrimSpacesEnd(const ANSICHAR* Begin, const ANSICHAR* End)
+		{
+			while (End > Begin && IsSpace(End[-1]))
+			{
+				End--;
+			}
+			return End;
+		}
+
+		static bool StartsWith(const ANSICHAR* Begin, const ANSICHAR* End, const ANSICHAR* Prefix)
+		{
+			const int32 PrefixLength = FCStringAnsi::Strlen(Prefix);
+			return ((End - Begin) >= PrefixLength) && (FCStringAnsi::Strncmp(Begin, Prefix, PrefixLength) == 0);
+		}
+
+		static bool StartsWithIgnoreCase(const ANSICHAR* Begin, const ANSICHAR* End, const ANSICHAR* Prefix)
+		{
+			const int32 PrefixLength = FCStringAnsi::Strlen(Prefix);
+			return ((End - Begin) >= PrefixLength) && (FCStringAnsi::Strnicmp(Begin, Prefix, PrefixLength) == 0);
+		}
+
+		static bool EqualsIgnoreCase(const ANSICHAR* Begin, const ANSICHAR* End, const ANSICHAR* Other)
+		{
+			return ((End - Begin) == FCStringAnsi::Strlen(Other)) && StartsWithIgnoreCase(Begin, End, Other);
+		}
+
+		// Parses a decimal number and advances the cursor past it. Returns false if there are no digits.
+		static bool ParseNumber(const ANSICHAR*& Cursor, const ANSICHAR* End, int32& OutNumber)
+		{
+			const ANSICHAR* Begin = Cursor;
+			int64 Number = 0;
+			while (Cursor < End && IsDigit(*Cursor))
+			{
+				Number = FMath::Min<int64>(Number * 10 + (*Cursor - '0'), MAX_int32);
+				Cursor++;
+			}
+			OutNumber = static_cast<int32>(Number);
+			return (Cursor > Begin);
+		}
+
+		// Creates a string from UTF-8 bytes with the surrounding spaces removed.
+		static FString MakeString(const ANSICHAR* Begin, const ANSICHAR* End)
+		{
+			Begin = SkipSpaces(Begin, End);
+			End = TrimSpacesEnd(Begin, End);
+			if (Begin >= End)
+			{
+				return FString();
+			}
+
+			const FUTF8ToTCHAR Converter(Begin, static_cast<int32>(End - Begin));
+			return FString(Converter.Length(), Converter.Get());
+		}
+
+		// Lines that start with one of these prefixes mark the start of a phase.
+		struct FPhaseMarker
+		{
+		public:
+			const ANSICHAR* Prefix;
+			const TCHAR* Phase;
+		};
+		static const FPhaseMarker PhaseMarkers[] = {
+			{ "Building plugin for host platforms", TEXT("Building for host platforms") },
+			{ "Building plugin for target platforms", TEXT("Building for target platforms") },
+			{ "Parsing headers for", TEXT("Generating code") },
+			{ "Target is up to date", TEXT("Up to date") },
+			{ "BUILD SUCCESSFUL", TEXT("Build successful") },
+			{ "BUILD FAILED", TEXT("Build failed") },
+			{ "AutomationTool exiting with ExitCode=", TEXT("Exiting") },
+		};
+
+		// Tool names that appear in place of a file path in linker diagnostics, such as "LINK : fatal error LNK1181".
+		static const ANSICHAR* LinkerNames[] = { "LINK", "ld", "ld.lld", "ld64.lld", "lld-link", "/usr/bin/ld" };
+
+		// Tool names that appear in place of a file path in compiler driver diagnostics, such as "clang: error: ...".
+		static const ANSICHAR* CompilerNames[] = { "cl", "clang", "clang++", "clang-cl" };
+
+		static bool IsOneOf(const ANSICHAR* Begin, const ANSICHAR* End, const ANSICHAR* const* Names, const int32 NumNames)
+		{
+			for (int32 Index = 0; Index < NumNames; Index++)
+			{
+				if (EqualsIgnoreCase(Begin, End, Names[Index]))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Parses the location in front of a diagnostic, such as "File.cpp(12,5)" or "File.cpp:12:5".
+		// Returns false if there is no line number, in which case the whole prefix is returned as the path.
+		static bool ParseLocation(
+			const ANSICHAR* Begin,
+			const ANSICHAR* End,
+			const ANSICHAR*& OutPathEnd,
+			int32& OutLine,
+			int32& OutColumn
+		)
+		{
+			End = TrimSpacesEnd(Begin, End);
+			OutPathEnd = End;
+			OutLine = 0;
+			OutColumn = 0;
+
+			// MSVC and UnrealHeaderTool: "File.cpp(12)" or "File.cpp(12,5)".
+			if (End > Begin && End[-1] == ')')
+			{
+				const ANSICHAR* Open = End - 1;
+				while (Open > Begin && *Open != '(')
+				{
+					Open--;
+				}
+
+				const ANSICHAR* Cursor = Open + 1;
+				if (*Open == '(' && ParseNumber(Cursor, End, OutLine))
+				{
+					if (Cursor < End && *Cursor == ',')
+					{
+						Cursor++;
+						ParseNumber(Cursor, End, OutColumn);
+					}
+					OutPathEnd = Open;
+					return true;
+				}
+			}
+
+			// clang: "File.cpp:12" or "File.cpp:12:5".
+			auto ParseTrailingNumber = [Begin](const ANSICHAR* NumberEnd, const ANSICHAR*& OutNumberBegin, int32& OutNumber) -> bool
+			{
+				OutNumberBegin = NumberEnd;
+				while (OutNumberBegin > Begin && IsDigit(OutNumberBegin[-1]))
+				{
+					OutNumberBegin--;
+				}
+				if (OutNumberBegin == NumberEnd || OutNumberBegin - 1 <= Begin || OutNumberBegin[-1] != ':')
+				{
+					return false;
+				}
+
+				const ANSICHAR* Cursor = OutNumberBegin;
+				return ParseNumber(Cursor, NumberEnd, OutNumber);
+			};
+
+			const ANSICHAR* LastNumberBegin = nullptr;
+			int32 LastNumber = 0;
+			if (ParseTrailingNumber(End, LastNumberBegin, LastNumber))
+			{
+				const ANSICHAR* FirstNumberBegin = nullptr;
+				int32 FirstNumber = 0;
+				if (ParseTrailingNumber(LastNumberBegin - 1, FirstNumberBegin, FirstNumber))
+				{
+					OutLine = FirstNumber;
+					OutColumn = LastNumber;
+					OutPathEnd = FirstNumberBegin - 1;
+				}
+				else
+				{
+					OutLine = LastNumber;
+					OutPathEnd = LastNumberBegin - 1;
+				}
+				return true;
+			}
+
+			return false;
+		}
+	}
+
+	FUATOutputParser::FUATOutputParser()
+		: CompletedActions(0)
+		, TotalActions(0)
+		, bIsLinking(false)
+	{
+	}
+
+	void FUATOutputParser::Feed(const uint8* Data, const int32 Size)
+	{
+		if (Size <= 0)
+		{
+			return;
+		}
+
+		const int32 ScanStart = PendingBytes.Num();
+		PendingBytes.Append(reinterpret_cast<const ANSICHAR*>(Data), Size);
+
+		int32 LineStart = 0;
+		for (int32 Index = ScanStart; Index < PendingBytes.Num(); Index++)
+		{
+			if (PendingBytes[Index] != '\n')
+			{
+				continue;
+			}
+
+			// Lines are terminated in place, so they can be parsed without being copied.
+			int32 LineEnd = Index;
+			if (LineEnd > LineStart && PendingBytes[LineEnd - 1] == '\r')
+			{
+				LineEnd--;
+			}
+			PendingBytes[LineEnd] = '\0';
+
+			ParseLine(PendingBytes.GetData() + LineStart, LineEnd - LineStart);
+			LineStart = Index + 1;
+		}
+
+		if (LineStart > 0)
+		{
+			// Keep only the incomplete last line. The buffers are swapped rather than shrunk so that their memory is reused.
+			SpareBytes.Reset();
+			SpareBytes.Append(PendingBytes.GetData() + LineStart, PendingBytes.Num() - LineStart);
+			Swap(PendingBytes, SpareBytes);
+		}
+	}
+
+	void FUATOutputParser::Flush()
+	{
+		if (PendingBytes.Num() == 0)
+		{
+			return;
+		}
+
+		int32 LineEnd = PendingBytes.Num();
+		if (PendingBytes[LineEnd - 1] == '\r')
+		{
+			LineEnd--;
+		}
+		PendingBytes.SetNum(LineEnd);
+		PendingBytes.Add('\0');
+
+		ParseLine(PendingBytes.GetData(), LineEnd);
+		PendingBytes.Reset();
+	}
+
+	int32 FUATOutputParser::GetCompletedActions() const
+	{
+		return CompletedActions;
+	}
+
+	int32 FUATOutputParser::GetTotalActions() const
+	{
+		return TotalActions;
+	}
+
+	bool FUATOutputParser::IsLinking() const
+	{
+		return bIsLinking;
+	}
+
+	const FString& FUATOutputParser::GetCurrentPhase() const
+	{
+		return CurrentPhase;
+	}
+
+	const TArray<FBuildDiagnostic>& FUATOutputParser::GetDiagnostics() const
+	{
+		return Diagnostics;
+	}
+
+	void FUATOutputParser::ParseLine(const ANSICHAR* Line, const int32 Length)
+	{
+		if (OnOutputLine.IsBound())
+		{
+			// The output is almost always ASCII, which is widened directly into the reused buffer.
+			LineBuffer.Reset();
+			bool bIsAscii = true;
+			for (int32 Index = 0; Index < Length; Index++)
+			{
+				if (static_cast<uint8>(Line[Index]) >= 0x80)
+				{
+					bIsAscii = false;
+					break;
+				}
+				LineBuffer.Add(static_cast<TCHAR>(Line[Index]));
+			}
+
+			if (!bIsAscii)
+			{
+				const FUTF8ToTCHAR Converter(Line, Length);
+				LineBuffer.Reset();
+				LineBuffer.Append(Converter.Get(), Converter.Length());
+			}
+			LineBuffer.Add(TEXT('\0'));
+
+			OnOutputLine.Execute(LineBuffer.GetData());
+		}
+
+		const ANSICHAR* LineEnd = Line + Length;
+		const ANSICHAR* TrimmedLine = UATOutputParser::SkipSpaces(Line, LineEnd);
+		if (TrimmedLine == LineEnd)
+		{
+			return;
+		}
+
+		if (ParseActionProgress(TrimmedLine, LineEnd) || ParsePhaseMarker(TrimmedLine, LineEnd))
+		{
+			return;
+		}
+
+		FBuildDiagnostic Diagnostic;
+		if (ParseDiagnostic(TrimmedLine, LineEnd, Diagnostic))
+		{
+			AddDiagnostic(Diagnostic);
+		}
+	}
+
+	bool FUATOutputParser::ParseActionProgress(const ANSICHAR* Line, const ANSICHAR* LineEnd)
+	{
+		// "[12/345] Compile Module.Foo.cpp"
+		if (*Line != '[')
+		{
+			return false;
+		}
+
+		const ANSICHAR* Cursor = UATOutputParser::SkipSpaces(Line + 1, LineEnd);
+
+		int32 ParsedCompleted = 0;
+		int32 ParsedTotal = 0;
+		if (!UATOutputParser::ParseNumber(Cursor, LineEnd, ParsedCompleted))
+		{
+			return false;
+		}
+		Cursor = UATOutputParser::SkipSpaces(Cursor, LineEnd);
+		if (Cursor >= LineEnd || *Cursor != '/')
+		{
+			return false;
+		}
+		Cursor = UATOutputParser::SkipSpaces(Cursor + 1, LineEnd);
+		if (!UATOutputParser::ParseNumber(Cursor, LineEnd, ParsedTotal))
+		{
+			return false;
+		}
+		Cursor = UATOutputParser::SkipSpaces(Cursor, LineEnd);
+		if (Cursor >= LineEnd || *Cursor != ']')
+		{
+			return false;
+		}
+
+		if ((ParsedCompleted > 0) && (ParsedTotal > 0))
+		{
+			CompletedActions = ParsedCompleted;
+			TotalActions = ParsedTotal;
+
+			// "[12/20] Link UnrealEditor-Foo.dll" or "[12/20] Link (lld) libUnrealEditor-Foo.so"
+			bIsLinking = UATOutputParser::StartsWith(UATOutputParser::SkipSpaces(Cursor + 1, LineEnd), LineEnd, "Link ");
+		}
+		return true;
+	}
+
+	bool FUATOutputParser::ParsePhaseMarker(const ANSICHAR* Line, const ANSICHAR* LineEnd)
+	{
+		// UAT command banners: "********** BUILD COMMAND STARTED **********"
+		if (UATOutputParser::StartsWith(Line, LineEnd, "**********"))
+		{
+			const ANSICHAR* Begin = Line;
+			const ANSICHAR* End = LineEnd;
+			while (Begin < End && (*Begin == '*' || UATOutputParser::IsSpace(*Begin)))
+			{
+				Begin++;
+			}
+			while (End > Begin && (End[-1] == '*' || UATOutputParser::IsSpace(End[-1])))
+			{
+				End--;
+			}
+			if (Begin < End)
+			{
+				CurrentPhase = UATOutputParser::MakeString(Begin, End);
+			}
+			return true;
+		}
+
+		// UBT: "Building 12 actions with 8 processes..." or "Building 12 action(s) started"
+		if (UATOutputParser::StartsWith(Line, LineEnd, "Building "))
+		{
+			const ANSICHAR* Cursor = Line + 9;
+			int32 NumActions = 0;
+			if (UATOutputParser::ParseNumber(Cursor, LineEnd, NumActions) && UATOutputParser::StartsWith(Cursor, LineEnd, " action"))
+			{
+				CurrentPhase = TEXT("Compiling");
+				return true;
+			}
+		}
+
+		for (const UATOutputParser::FPhaseMarker& PhaseMarker : UATOutputParser::PhaseMarkers)
+		{
+			if (UATOutputParser::StartsWith(Line, LineEnd, PhaseMarker.Prefix))
+			{
+				CurrentPhase = PhaseMarker.Phase;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool FUATOutputParser::ParseDiagnostic(const ANSICHAR* Line, const ANSICHAR* LineEnd, FBuildDiagnostic& OutDiagnostic)
+	{
+		// UAT and UBT: "ERROR: Unable to find plugin" or "WARNING: ...". They also repeat tool diagnostics this way.
+		const bool bIsToolError = UATOutputParser::StartsWith(Line, LineEnd, "ERROR:");
+		if (bIsToolError || UATOutputParser::StartsWith(Line, LineEnd, "WARNING:"))
+		{
+			const ANSICHAR* Rest = UATOutputParser::SkipSpaces(Line + (bIsToolError ? 6 : 8), LineEnd);
+			if (ParseDiagnostic(Rest, LineEnd, OutDiagnostic))
+			{
+				return true;
+			}
+
+			OutDiagnostic = FBuildDiagnostic();
+			OutDiagnostic.Severity = (bIsToolError ? EBuildDiagnosticSeverity::Error : EBuildDiagnosticSeverity::Warning);
+			OutDiagnostic.Source = EBuildDiagnosticSource::AutomationTool;
+			OutDiagnostic.Message = UATOutputParser::MakeString(Rest, LineEnd);
+			return !OutDiagnostic.Message.IsEmpty();
+		}
+
+		// Tool diagnostics: "<location>: [fatal] error|warning [code]: <message>", where the location may be a file
+		// position, an object file or a tool name.
+		for (const ANSICHAR* Colon = Line; Colon < LineEnd; Colon++)
+		{
+			if (*Colon != ':')
+			{
+				continue;
+			}
+
+			const ANSICHAR* Keyword = UATOutputParser::SkipSpaces(Colon + 1, LineEnd);
+			if (UATOutputParser::StartsWithIgnoreCase(Keyword, LineEnd, "fatal "))
+			{
+				Keyword = UATOutputParser::SkipSpaces(Keyword + 6, LineEnd);
+			}
+
+			EBuildDiagnosticSeverity Severity;
+			const ANSICHAR* KeywordEnd;
+			if (UATOutputParser::StartsWithIgnoreCase(Keyword, LineEnd, "error"))
+			{
+				Severity = EBuildDiagnosticSeverity::Error;
+				KeywordEnd = Keyword + 5;
+			}
+			else if (UATOutputParser::StartsWithIgnoreCase(Keyword, LineEnd, "warning"))
+			{
+				Severity = EBuildDiagnosticSeverity::Warning;
+				KeywordEnd = Keyword + 7;
+			}
+			else
+			{
+				continue;
+			}
+
+			// An optional code such as "C2065" or "LNK2019" separated by a space, then the colon before the message.
+			const ANSICHAR* CodeBegin = UATOutputParser::SkipSpaces(KeywordEnd, LineEnd);
+			const ANSICHAR* CodeEnd = CodeBegin;
+			while (CodeEnd < LineEnd && UATOutputParser::IsAlnum(*CodeEnd))
+			{
+				CodeEnd++;
+			}
+			if (CodeBegin == KeywordEnd && CodeEnd != CodeBegin)
+			{
+				// A longer word such as "errors".
+				continue;
+			}
+			const ANSICHAR* MessageColon = UATOutputParser::SkipSpaces(CodeEnd, LineEnd);
+			if (MessageColon >= LineEnd || *MessageColon != ':')
+			{
+				continue;
+			}
+
+			const ANSICHAR* PathEnd = nullptr;
+			int32 LineNumber = 0;
+			int32 ColumnNumber = 0;
+			const bool bHasLocation = UATOutputParser::ParseLocation(Line, Colon, PathEnd, LineNumber, ColumnNumber);
+
+			OutDiagnostic = FBuildDiagnostic();
+			OutDiagnostic.Severity = Severity;
+			OutDiagnostic.Line = LineNumber;
+			OutDiagnostic.Column = ColumnNumber;
+			OutDiagnostic.Code = UATOutputParser::MakeString(CodeBegin, CodeEnd);
+			OutDiagnostic.Message = UATOutputParser::MakeString(MessageColon + 1, LineEnd);
+
+			const ANSICHAR* PathBegin = Line;
+			PathEnd = UATOutputParser::TrimSpacesEnd(PathBegin, PathEnd);
+			const bool bIsLinkerName = UATOutputParser::IsOneOf(PathBegin, PathEnd, UATOutputParser::LinkerNames, UE_ARRAY_COUNT(UATOutputParser::LinkerNames));
+			const bool bIsCompilerName = UATOutputParser::IsOneOf(PathBegin, PathEnd, UATOutputParser::CompilerNames, UE_ARRAY_COUNT(UATOutputParser::CompilerNames));
+
+			if (bIsLinkerName || OutDiagnostic.Code.StartsWith(TEXT("LNK")) || OutDiagnostic.Message.Contains(TEXT("linker command failed")))
+			{
+				OutDiagnostic.Source = EBuildDiagnosticSource::Linker;
+			}
+			else if (bHasLocation && (*Keyword == 'E' || *Keyword == 'W') && OutDiagnostic.Code.IsEmpty())
+			{
+				// MSVC and clang write the severity in lower case, UnrealHeaderTool capitalizes it.
+				OutDiagnostic.Source = EBuildDiagnosticSource::UnrealHeaderTool;
+			}
+			else if (bHasLocation || bIsCompilerName || !OutDiagnostic.Code.IsEmpty())
+			{
+				OutDiagnostic.Source = EBuildDiagnosticSource::Compiler;
+			}
+			else
+			{
+				OutDiagnostic.Source = EBuildDiagnosticSource::AutomationTool;
+			}
+
+			if (!bIsLinkerName && !bIsCompilerName && OutDiagnostic.Source != EBuildDiagnosticSource::AutomationTool)
+			{
+				OutDiagnostic.FilePath = UATOutputParser::MakeString(PathBegin, PathEnd);
+			}
+			return true;
+		}
+
+		// ld: "Foo.o: in function `Bar': Foo.cpp:(.text+0x1a): undefined reference to `Baz'"
+		if (FCStringAnsi::Strstr(Line, "undefined reference to") != nullptr)
+		{
+			OutDiagnostic = FBuildDiagnostic();
+			OutDiagnostic.Severity = EBuildDiagnosticSeverity::Error;
+			OutDiagnostic.Source = EBuildDiagnosticSource::Linker;
+			OutDiagnostic.Message = UATOutputParser::MakeString(Line, LineEnd);
+			return true;
+		}
+
+		return false;
+	}
+
+	void FUATOutputParser::AddDiagnostic(FBuildDiagnostic& Diagnostic)
+	{
+		if (Diagnostics.Num() >= MaxDiagnostics)
+		{
+			return;
+		}
+
+		uint32 Hash = GetTypeHash(Diagnostic.Message);
+		Hash = HashCombine(Hash, GetTypeHash(Diagnostic.FilePath));
+		Hash = HashCombine(Hash, GetTypeHash(Diagnostic.Code));
+		Hash = HashCombine(Hash, GetTypeHash(Diagnostic.Line));
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Diagnostic.Severity)));
+
+		bool bIsAlreadyInSet = false;
+		DiagnosticHashes.Add(Hash, &bIsAlreadyInSet);
+		if (bIsAlreadyInSet)
+		{
+			return;
+		}
+
+		Diagnostics.Add(MoveTemp(Diagnostic));
+		OnDiagnostic.ExecuteIfBound(Diagnostics.Last());
+	}
+}
@@ -0,0 +1,89 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PluginBuilder/Types/BuildDiagnostics.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * A streaming parser for the standard output of UAT, UBT and the tools they run.
+	 * Raw output bytes are scanned in place, so no string is allocated for a line unless it contains a diagnostic or a phase marker.
+	 * Recognizes "[n/m]" action progress, MSVC, clang and UnrealHeaderTool errors and warnings, linker errors and UAT phase markers.
+	 */
+	class FUATOutputParser
+	{
+	public:
+		// Constructor.
+		FUATOutputParser();
+
+		// Parses a chunk of raw output. Lines may be split across chunks.
+		void Feed(const uint8* Data, int32 Size);
+
+		// Parses the last line if the output did not end with a line break.
+		void Flush();
+
+		// Returns the number of completed and total actions from the last "[n/m]" line, or 0 if none has been seen.
+		int32 GetCompletedActions() const;
+		int32 GetTotalActions() const;
+
+		// Returns whether the action in the last "[n/m]" line was a link action.
+		bool IsLinking() const;
+
+		// Returns the last UAT phase seen, such as "Compiling", or empty if none has been seen.
+		const FString& GetCurrentPhase() const;
+
+		// Returns the diagnostics found so far, in the order they were reported.
+		const TArray<FBuildDiagnostic>& GetDiagnostics() const;
+
+		// Called for each line of output. The string is only valid during the call.
+		DECLARE_DELEGATE_OneParam(FOnOutputLine, const TCHAR* /* Line */);
+		FOnOutputLine OnOutputLine;
+
+		// Called when a new diagnostic is found.
+		DECLARE_DELEGATE_OneParam(FOnDiagnostic, const FBuildDiagnostic& /* Diagnostic */);
+		FOnDiagnostic OnDiagnostic;
+
+	private:
+		// Parses a single null-terminated line without its line break.
+		void ParseLine(const ANSICHAR* Line, int32 Length);
+
+		// Parses a "[n/m] ..." action progress line.
+		bool ParseActionProgress(const ANSICHAR* Line, const ANSICHAR* LineEnd);
+
+		// Parses a line that marks the start of a UAT or UBT phase.
+		bool ParsePhaseMarker(const ANSICHAR* Line, const ANSICHAR* LineEnd);
+
+		// Parses an error or warning line.
+		static bool ParseDiagnostic(const ANSICHAR* Line, const ANSICHAR* LineEnd, FBuildDiagnostic& OutDiagnostic);
+
+		// Records a diagnostic unless the same one has already been recorded.
+		void AddDiagnostic(FBuildDiagnostic& Diagnostic);
+
+	private:
+		// The bytes received so far that do not form a complete line yet, and a spare buffer swapped with it.
+		TArray<ANSICHAR> PendingBytes;
+		TArray<ANSICHAR> SpareBytes;
+
+		// A buffer reused to pass each line to OnOutputLine.
+		TArray<TCHAR> LineBuffer;
+
+		// The action progress from the last "[n/m]" line.
+		int32 CompletedActions;
+		int32 TotalActions;
+
+		// Whether the action in the last "[n/m]" line was a link action.
+		bool bIsLinking;
+
+		// The last UAT phase seen.
+		FString CurrentPhase;
+
+		// The diagnostics found so far, and the hashes used to skip repeated ones.
+		TArray<FBuildDiagnostic> Diagnostics;
+		TSet<uint32> DiagnosticHashes;
+
+		// The largest number of diagnostics recorded, so that a flood of warnings does not use up memory.
+		static constexpr int32 MaxDiagnostics = 1000;
+	};
+}
@@ -0,0 +1,648 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#include "PluginBuilder/Widgets/SBuildMonitor.h"
+#include "PluginBuilder/Utilities/BuildMonitor.h"
+#include "PluginBuilder/Utilities/TaskOutputLog.h"
+#include "PluginBuilder/PluginBuilderGlobals.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Docking/TabManager.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/SOverlay.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Notifications/SProgressBar.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/STableRow.h"
+#include "SourceCodeNavigation.h"
+#if UE_5_00_OR_LATER
+#include "Styling/AppStyle.h"
+#else
+#include "EditorStyleSet.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "BuildMonitor"
+
+namespace PluginBuilder
+{
+	namespace BuildMonitor
+	{
+		// The columns of the task list.
+		static const FName NameColumnId = TEXT("Name");
+		static const FName StateColumnId = TEXT("State");
+		static const FName ProgressColumnId = TEXT("Progress");
+		static const FName ThroughputColumnId = TEXT("Throughput");
+		static const FName ElapsedColumnId = TEXT("Elapsed");
+		static const FName RemainingColumnId = TEXT("Remaining");
+
+		// Returns a short human readable form of a duration, such as "1m 05s", or "-" for a negative value.
+		static FString FormatDuration(const double Seconds)
+		{
+			if (Seconds < 0.0)
+			{
+				return TEXT("-");
+			}
+
+			const int64 TotalSeconds = static_cast<int64>(FMath::CeilToDouble(Seconds));
+			const int64 Hours = (TotalSeconds / 3600);
+			const int64 Minutes = ((TotalSeconds / 60) % 60);
+			const int64 RemainingSeconds = (TotalSeconds % 60);
+			if (Hours > 0)
+			{
+				return FString::Printf(TEXT("%lldh %02lldm"), Hours, Minutes);
+			}
+			if (Minutes > 0)
+			{
+				return FString::Printf(TEXT("%lldm %02llds"), Minutes, RemainingSeconds);
+			}
+			return FString::Printf(TEXT("%llds"), RemainingSeconds);
+		}
+
+		// Returns the color the state of a task is shown in.
+		static FSlateColor GetStateColor(const EBuildMonitorTaskState State)
+		{
+			switch (State)
+			{
+			case EBuildMonitorTaskState::Succeeded:
+				return FSlateColor(FLinearColor(0.3f, 0.8f, 0.3f));
+
+			case EBuildMonitorTaskState::Failed:
+				return FSlateColor(FLinearColor(0.9f, 0.25f, 0.25f));
+
+			case EBuildMonitorTaskState::Canceled:
+			case EBuildMonitorTaskState::Skipped:
+			case EBuildMonitorTaskState::Pending:
+				return FSlateColor::UseSubduedForeground();
+
+			default:
+				return FSlateColor::UseForeground();
+			}
+		}
+
+		// Returns the monospaced font used for the output and the diagnostics.
+		static FSlateFontInfo GetOutputFont()
+		{
+			return FCoreStyle::GetDefaultFontStyle(TEXT("Mono"), 9);
+		}
+
+		/**
+		 * A row of the task list.
+		 */
+		class STaskRow : public SMultiColumnTableRow<TSharedPtr<FBuildMonitorTask>>
+		{
+		public:
+			SLATE_BEGIN_ARGS(STaskRow)
+			{}
+				SLATE_ARGUMENT(TSharedPtr<FBuildMonitorTask>, Item)
+			SLATE_END_ARGS()
+
+			// Constructor.
+			void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable)
+			{
+				Item = InArgs._Item;
+				SMultiColumnTableRow<TSharedPtr<FBuildMonitorTask>>::Construct(FSuperRowType::FArguments(), OwnerTable);
+			}
+
+			// SMultiColumnTableRow interface.
+			virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+			{
+				const TSharedPtr<FBuildMonitorTask> Task = Item;
+				TSharedRef<SWidget> CellContent = SNullWidget::NullWidget;
+
+				if (ColumnName == NameColumnId)
+				{
+					CellContent = SNew(STextBlock)
+						.Text(FText::FromString(Task->Name));
+				}
+				else if (ColumnName == StateColumnId)
+				{
+					CellContent = SNew(STextBlock)
+						.Text_Lambda([Task]() -> FText { return FText::FromString(LexToString(Task->State)); })
+						.ColorAndOpacity_Lambda([Task]() -> FSlateColor { return GetStateColor(Task->State); });
+				}
+				else if (ColumnName == ProgressColumnId)
+				{
+					CellContent = SNew(SOverlay)
+						+ SOverlay::Slot()
+						[
+							SNew(SProgressBar)
+							.Percent_Lambda(
+								[Task]() -> TOptional<float>
+								{
+									// An unset value animates the bar, which is only done while the task is running.
+									const float Progress = Task->GetProgress();
+									if (Progress >= 0.f)
+									{
+										return Progress;
+									}
+									return ((Task->State == EBuildMonitorTaskState::Running) ? TOptional<float>() : TOptional<float>(0.f));
+								}
+							)
+						]
+						+ SOverlay::Slot()
+						.HAlign(HAlign_Center)
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+							.Text_Lambda([Task]() -> FText { return FText::FromString(Task->GetProgressText()); })
+						];
+				}
+				else if (ColumnName == ThroughputColumnId)
+				{
+					CellContent = SNew(STextBlock)
+						.Text_Lambda([Task]() -> FText { return FText::FromString(Task->GetThroughputText()); });
+				}
+				else if (ColumnName == ElapsedColumnId)
+				{
+					CellContent = SNew(STextBlock)
+						.Text_Lambda([Task]() -> FText { return FText::FromString(FormatDuration(Task->GetElapsedSeconds())); });
+				}
+				else if (ColumnName == RemainingColumnId)
+				{
+					CellContent = SNew(STextBlock)
+						.Text_Lambda([Task]() -> FText { return FText::FromString(FormatDuration(Task->GetRemainingSeconds())); });
+				}
+
+				return SNew(SBox)
+					.Padding(FMargin(4.f, 2.f))
+					.VAlign(VAlign_Center)
+					[
+						CellContent
+					];
+			}
+			// End of SMultiColumnTableRow interface.
+
+		private:
+			// The task shown in this row.
+			TSharedPtr<FBuildMonitorTask> Item;
+		};
+	}
+
+	void SBuildMonitor::Construct(const FArguments& InArgs)
+	{
+		ChildSlot
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(4.f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SBuildMonitor::GetSummaryText)
+			]
+			+ SVerticalBox::Slot()
+			.FillHeight(1.f)
+			[
+				SNew(SSplitter)
+				.Orientation(Orient_Vertical)
+				+ SSplitter::Slot()
+				.Value(0.3f)
+				[
+					SAssignNew(TaskListView, SListView<TSharedPtr<FBuildMonitorTask>>)
+					.ListItemsSource(&TaskItems)
+					.SelectionMode(ESelectionMode::Single)
+					.OnGenerateRow(this, &SBuildMonitor::HandleOnGenerateTaskRow)
+					.OnSelectionChanged(this, &SBuildMonitor::HandleOnTaskSelectionChanged)
+					.HeaderRow(
+						SNew(SHeaderRow)
+						+ SHeaderRow::Column(BuildMonitor::NameColumnId)
+						.DefaultLabel(LOCTEXT("NameColumnLabel", "Task"))
+						.FillWidth(0.3f)
+						+ SHeaderRow::Column(BuildMonitor::StateColumnId)
+						.DefaultLabel(LOCTEXT("StateColumnLabel", "State"))
+						.FillWidth(0.1f)
+						+ SHeaderRow::Column(BuildMonitor::ProgressColumnId)
+						.DefaultLabel(LOCTEXT("ProgressColumnLabel", "Progress"))
+						.FillWidth(0.25f)
+						+ SHeaderRow::Column(BuildMonitor::ThroughputColumnId)
+						.DefaultLabel(LOCTEXT("ThroughputColumnLabel", "Throughput"))
+						.FillWidth(0.15f)
+						+ SHeaderRow::Column(BuildMonitor::ElapsedColumnId)
+						.DefaultLabel(LOCTEXT("ElapsedColumnLabel", "Elapsed"))
+						.FillWidth(0.1f)
+						+ SHeaderRow::Column(BuildMonitor::RemainingColumnId)
+						.DefaultLabel(LOCTEXT("RemainingColumnLabel", "ETA"))
+						.FillWidth(0.1f)
+					)
+				]
+				+ SSplitter::Slot()
+				.Value(0.7f)
+				[
+					SNew(SSplitter)
+					.Orientation(Orient_Horizontal)
+					+ SSplitter::Slot()
+					.Value(0.6f)
+					[
+						SNew(SVerticalBox)
+						+ SVerticalBox::Slot()
+						.AutoHeight()
+						.Padding(4.f)
+						[
+							SNew(SCheckBox)
+							.IsChecked_Lambda([this]() -> ECheckBoxState { return (bFollowOutput ? ECheckBoxState::Checked : ECheckBoxState::Unchecked); })
+							.OnCheckStateChanged_Lambda(
+								[this](const ECheckBoxState NewState)
+								{
+									bFollowOutput = (NewState == ECheckBoxState::Checked);
+									if (bFollowOutput && OutputListView.IsValid())
+									{
+										OutputListView->ScrollToBottom();
+									}
+								}
+							)
+							[
+								SNew(STextBlock)
+								.Text(LOCTEXT("FollowOutputLabel", "Follow Output"))
+							]
+						]
+						+ SVerticalBox::Slot()
+						.FillHeight(1.f)
+						[
+							SAssignNew(OutputListView, SListView<const FString*>)
+							.ListItemsSource(&OutputItems)
+							.SelectionMode(ESelectionMode::Multi)
+							.OnGenerateRow(this, &SBuildMonitor::HandleOnGenerateOutputRow)
+						]
+					]
+					+ SSplitter::Slot()
+					.Value(0.4f)
+					[
+						SNew(SVerticalBox)
+						+ SVerticalBox::Slot()
+						.AutoHeight()
+						.Padding(4.f)
+						[
+							SNew(SHorizontalBox)
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							.Padding(0.f, 0.f, 8.f, 0.f)
+							[
+								SNew(SCheckBox)
+								.IsChecked_Lambda([this]() -> ECheckBoxState { return (bShowErrors ? ECheckBoxState::Checked : ECheckBoxState::Unchecked); })
+								.OnCheckStateChanged_Lambda(
+									[this](const ECheckBoxState NewState)
+									{
+										bShowErrors = (NewState == ECheckBoxState::Checked);
+										RebuildFilteredDiagnostics();
+									}
+								)
+								[
+									SNew(STextBlock)
+									.Text_Lambda([this]() -> FText { return FText::Format(LOCTEXT("ErrorsFilterLabel", "Errors ({0})"), FText::AsNumber(NumErrors)); })
+								]
+							]
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							.Padding(0.f, 0.f, 8.f, 0.f)
+							[
+								SNew(SCheckBox)
+								.IsChecked_Lambda([this]() -> ECheckBoxState { return (bShowWarnings ? ECheckBoxState::Checked : ECheckBoxState::Unchecked); })
+								.OnCheckStateChanged_Lambda(
+									[this](const ECheckBoxState NewState)
+									{
+										bShowWarnings = (NewState == ECheckBoxState::Checked);
+										RebuildFilteredDiagnostics();
+									}
+								)
+								[
+									SNew(STextBlock)
+									.Text_Lambda([this]() -> FText { return FText::Format(LOCTEXT("WarningsFilterLabel", "Warnings ({0})"), FText::AsNumber(NumWarnings)); })
+								]
+							]
+							+ SHorizontalBox::Slot()
+							.FillWidth(1.f)
+							[
+								SNew(SSearchBox)
+								.HintText(LOCTEXT("SearchDiagnosticsHint", "Search message, file or code"))
+								.OnTextChanged(this, &SBuildMonitor::HandleOnSearchTextChanged)
+							]
+						]
+						+ SVerticalBox::Slot()
+						.FillHeight(1.f)
+						[
+							SAssignNew(DiagnosticListView, SListView<TSharedPtr<FBuildDiagnostic>>)
+							.ListItemsSource(&FilteredDiagnosticItems)
+							.SelectionMode(ESelectionMode::Single)
+							.OnGenerateRow(this, &SBuildMonitor::HandleOnGenerateDiagnosticRow)
+							.OnMouseButtonDoubleClick(this, &SBuildMonitor::HandleOnDiagnosticDoubleClicked)
+						]
+					]
+				]
+			]
+		];
+
+		RefreshTasks();
+		RegisterActiveTimer(RefreshInterval, FWidgetActiveTimerDelegate::CreateSP(this, &SBuildMonitor::HandleOnRefresh));
+	}
+
+	void SBuildMonitor::RegisterTabSpawner()
+	{
+		FGlobalTabmanager::Get()->RegisterNomadTabSpawner(TabId, FOnSpawnTab::CreateStatic(&SBuildMonitor::HandleOnSpawnTab))
+			.SetDisplayName(LOCTEXT("TabTitle", "Build Monitor"))
+			.SetTooltipText(LOCTEXT("TabTooltip", "Shows the progress, output and diagnostics of each task of the plugin packaging process."))
+			.SetIcon(
+				FSlateIcon(
+#if UE_5_00_OR_LATER
+					FAppStyle::GetAppStyleSetName(),
+#else
+					FEditorStyle::GetStyleSetName(),
+#endif
+					TEXT("MainFrame.PackageProject")
+				)
+			)
+			.SetMenuType(ETabSpawnerMenuType::Hidden);
+	}
+
+	void SBuildMonitor::UnregisterTabSpawner()
+	{
+		if (FSlateApplication::IsInitialized())
+		{
+			FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(TabId);
+		}
+	}
+
+	void SBuildMonitor::OpenTab()
+	{
+		FGlobalTabmanager::Get()->TryInvokeTab(TabId);
+	}
+
+	EActiveTimerReturnType SBuildMonitor::HandleOnRefresh(double InCurrentTime, float InDeltaTime)
+	{
+		RefreshTasks();
+		RefreshOutput();
+		RefreshDiagnostics();
+		return EActiveTimerReturnType::Continue;
+	}
+
+	void SBuildMonitor::RefreshTasks()
+	{
+		// The cells read their values from the tasks when they are painted, so the list is only rebuilt when tasks are added or change state.
+		const uint32 Revision = FBuildMonitor::GetRevision();
+		if ((Revision == DisplayedRevision) && (TaskItems.Num() > 0))
+		{
+			return;
+		}
+		DisplayedRevision = Revision;
+
+		const TArray<TSharedRef<FBuildMonitorTask>>& Tasks = FBuildMonitor::GetTasks();
+		TaskItems.Reset(Tasks.Num());
+		for (const TSharedRef<FBuildMonitorTask>& Task : Tasks)
+		{
+			TaskItems.Add(Task);
+		}
+		TaskListView->RequestListRefresh();
+
+		// The tasks of a new packaging process replace the old ones, so the first running task is selected instead.
+		if (!TaskItems.Contains(SelectedTask))
+		{
+			TSharedPtr<FBuildMonitorTask> TaskToSelect = nullptr;
+			for (const TSharedPtr<FBuildMonitorTask>& TaskItem : TaskItems)
+			{
+				if (TaskItem->State == EBuildMonitorTaskState::Running)
+				{
+					TaskToSelect = TaskItem;
+					break;
+				}
+			}
+			if (!TaskToSelect.IsValid() && (TaskItems.Num() > 0))
+			{
+				TaskToSelect = TaskItems[0];
+			}
+
+			// Selecting directly does not notify the list's selection event, so the handler is called here.
+			if (TaskToSelect.IsValid())
+			{
+				TaskListView->SetSelection(TaskToSelect);
+			}
+			HandleOnTaskSelectionChanged(TaskToSelect, ESelectInfo::Direct);
+		}
+	}
+
+	void SBuildMonitor::RefreshOutput()
+	{
+		const TSharedPtr<const FTaskOutputLog> OutputLog = (SelectedTask.IsValid() ? SelectedTask->OutputLog : nullptr);
+		if (OutputLog != DisplayedOutputLog)
+		{
+			DisplayedOutputLog = OutputLog;
+			DisplayedNumAddedLines = 0;
+			OutputItems.Reset();
+			OutputListView->RequestListRefresh();
+		}
+		if (!OutputLog.IsValid() || (OutputLog->GetNumAddedLines() == DisplayedNumAddedLines))
+		{
+			return;
+		}
+
+		// Until the ring buffer wraps around, the new lines are appended after the ones already listed.
+		// Once it has wrapped, every slot holds a different line, so the list is rebuilt from the oldest line.
+		const int32 NumLines = OutputLog->GetNumLines();
+		const bool bHasWrapped = (OutputLog->GetNumAddedLines() > static_cast<uint64>(NumLines));
+		if (bHasWrapped)
+		{
+			OutputItems.Reset(NumLines);
+		}
+		for (int32 Index = OutputItems.Num(); Index < NumLines; Index++)
+		{
+			OutputItems.Add(&OutputLog->GetLine(Index));
+		}
+		DisplayedNumAddedLines = OutputLog->GetNumAddedLines();
+
+		if (bHasWrapped)
+		{
+			// The rows show the slots they were generated for, which now hold other lines.
+			OutputListView->RebuildList();
+		}
+		else
+		{
+			OutputListView->RequestListRefresh();
+		}
+		if (bFollowOutput)
+		{
+			OutputListView->ScrollToBottom();
+		}
+	}
+
+	void SBuildMonitor::RefreshDiagnostics()
+	{
+		if (!DisplayedOutputLog.IsValid())
+		{
+			return;
+		}
+
+		// Only the diagnostics found since the last refresh are filtered, instead of going through the output again.
+		const TArray<FBuildDiagnostic>& Diagnostics = DisplayedOutputLog->GetDiagnostics();
+		if (Diagnostics.Num() == DiagnosticItems.Num())
+		{
+			return;
+		}
+
+		for (int32 Index = DiagnosticItems.Num(); Index < Diagnostics.Num(); Index++)
+		{
+			const TSharedPtr<FBuildDiagnostic> DiagnosticItem = MakeShared<FBuildDiagnostic>(Diagnostics[Index]);
+			DiagnosticItems.Add(DiagnosticItem);
+			if (DiagnosticItem->IsError())
+			{
+				NumErrors++;
+			}
+			else
+			{
+				NumWarnings++;
+			}
+
+			if (PassesDiagnosticFilter(*DiagnosticItem))
+			{
+				FilteredDiagnosticItems.Add(DiagnosticItem);
+			}
+		}
+		DiagnosticListView->RequestListRefresh();
+	}
+
+	void SBuildMonitor::RebuildFilteredDiagnostics()
+	{
+		FilteredDiagnosticItems.Reset();
+		for (const TSharedPtr<FBuildDiagnostic>& DiagnosticItem : DiagnosticItems)
+		{
+			if (PassesDiagnosticFilter(*DiagnosticItem))
+			{
+				FilteredDiagnosticItems.Add(DiagnosticItem);
+			}
+		}
+		DiagnosticListView->RequestListRefresh();
+	}
+
+	bool SBuildMonitor::PassesDiagnosticFilter(const FBuildDiagnostic& Diagnostic) const
+	{
+		if (!(Diagnostic.IsError() ? bShowErrors : bShowWarnings))
+		{
+			return false;
+		}
+
+		if (SearchText.IsEmpty())
+		{
+			return true;
+		}
+
+		return (
+			Diagnostic.Message.Contains(SearchText) ||
+			Diagnostic.FilePath.Contains(SearchText) ||
+			Diagnostic.Code.Contains(SearchText)
+		);
+	}
+
+	FText SBuildMonitor::GetSummaryText() const
+	{
+		if (TaskItems.Num() == 0)
+		{
+			return LOCTEXT("NoPackagingProcessText", "No plugin has been packaged in this session.");
+		}
+
+		int32 NumFinishedTasks = 0;
+		int32 NumFailedTasks = 0;
+		for (const TSharedPtr<FBuildMonitorTask>& TaskItem : TaskItems)
+		{
+			if (TaskItem->IsFinished())
+			{
+				NumFinishedTasks++;
+			}
+			if (TaskItem->State == EBuildMonitorTaskState::Failed)
+			{
+				NumFailedTasks++;
+			}
+		}
+
+		return FText::Format(
+			LOCTEXT("SummaryTextFormat", "{0} - {1}: {2}/{3} task(s) finished, {4} failed"),
+			FText::FromString(FBuildMonitor::GetRunName()),
+			(FBuildMonitor::IsRunning() ? LOCTEXT("RunningText", "Packaging") : LOCTEXT("FinishedText", "Finished")),
+			FText::AsNumber(NumFinishedTasks),
+			FText::AsNumber(TaskItems.Num()),
+			FText::AsNumber(NumFailedTasks)
+		);
+	}
+
+	TSharedRef<ITableRow> SBuildMonitor::HandleOnGenerateTaskRow(TSharedPtr<FBuildMonitorTask> Item, const TSharedRef<STableViewBase>& OwnerTable)
+	{
+		return SNew(BuildMonitor::STaskRow, OwnerTable)
+			.Item(Item);
+	}
+
+	TSharedRef<ITableRow> SBuildMonitor::HandleOnGenerateOutputRow(const FString* Item, const TSharedRef<STableViewBase>& OwnerTable)
+	{
+		return SNew(STableRow<const FString*>, OwnerTable)
+			[
+				SNew(STextBlock)
+				.Font(BuildMonitor::GetOutputFont())
+				.Text(FText::FromString(*Item))
+			];
+	}
+
+	TSharedRef<ITableRow> SBuildMonitor::HandleOnGenerateDiagnosticRow(TSharedPtr<FBuildDiagnostic> Item, const TSharedRef<STableViewBase>& OwnerTable)
+	{
+		return SNew(STableRow<TSharedPtr<FBuildDiagnostic>>, OwnerTable)
+			.ToolTipText(FText::FromString(Item->ToString()))
+			[
+				SNew(STextBlock)
+				.Font(BuildMonitor::GetOutputFont())
+				.ColorAndOpacity(Item->IsError() ? FLinearColor(0.9f, 0.25f, 0.25f) : FLinearColor(0.9f, 0.75f, 0.2f))
+				.Text(FText::FromString(Item->ToString()))
+			];
+	}
+
+	void SBuildMonitor::HandleOnTaskSelectionChanged(TSharedPtr<FBuildMonitorTask> Item, ESelectInfo::Type SelectInfo)
+	{
+		// Keeps showing the last task while the list is cleared and rebuilt.
+		if (!Item.IsValid() && TaskItems.Contains(SelectedTask))
+		{
+			return;
+		}
+		if (Item == SelectedTask)
+		{
+			return;
+		}
+
+		SelectedTask = Item;
+		DiagnosticItems.Reset();
+		FilteredDiagnosticItems.Reset();
+		NumErrors = 0;
+		NumWarnings = 0;
+		DiagnosticListView->RequestListRefresh();
+
+		RefreshOutput();
+		RefreshDiagnostics();
+		if (OutputListView.IsValid())
+		{
+			OutputListView->ScrollToBottom();
+		}
+	}
+
+	void SBuildMonitor::HandleOnDiagnosticDoubleClicked(TSharedPtr<FBuildDiagnostic> Item)
+	{
+		if (Item.IsValid() && !Item->FilePath.IsEmpty())
+		{
+			FSourceCodeNavigation::OpenSourceFile(Item->FilePath, Item->Line, Item->Column);
+		}
+	}
+
+	void SBuildMonitor::HandleOnSearchTextChanged(const FText& InSearchText)
+	{
+		SearchText = InSearchText.ToString();
+		RebuildFilteredDiagnostics();
+	}
+
+	TSharedRef<SDockTab> SBuildMonitor::HandleOnSpawnTab(const FSpawnTabArgs& SpawnTabArgs)
+	{
+		return SNew(SDockTab)
+			.TabRole(ETabRole::NomadTab)
+			[
+				SNew(SBuildMonitor)
+			];
+	}
+
+	const FName SBuildMonitor::TabId = TEXT("PluginBuilderBuildMonitor");
+}
+
+#undef LOCTEXT_NAMESPACE
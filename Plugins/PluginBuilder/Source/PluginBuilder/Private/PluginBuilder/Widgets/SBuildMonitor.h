@@ -0,0 +1,125 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "PluginBuilder/Types/BuildDiagnostics.h"
+
+class SDockTab;
+class FSpawnTabArgs;
+
+namespace PluginBuilder
+{
+	struct FBuildMonitorTask;
+	class FTaskOutputLog;
+
+	/**
+	 * A widget that shows the tasks of the running or last packaging process, the output of the selected task and its diagnostics.
+	 * The output and the diagnostics are shown in virtualized lists, so only the visible rows are generated,
+	 * and the diagnostics are filtered by their fields as they arrive rather than by searching the output.
+	 */
+	class PLUGINBUILDER_API SBuildMonitor : public SCompoundWidget
+	{
+	public:
+		SLATE_BEGIN_ARGS(SBuildMonitor)
+		{}
+		SLATE_END_ARGS()
+
+		// Constructor.
+		void Construct(const FArguments& InArgs);
+
+		// Registers the tab spawner of the build monitor in the global tab manager.
+		static void RegisterTabSpawner();
+
+		// Unregisters the tab spawner of the build monitor.
+		static void UnregisterTabSpawner();
+
+		// Opens and focuses the build monitor tab.
+		static void OpenTab();
+
+	private:
+		// Called periodically to pick up new tasks, output lines and diagnostics.
+		EActiveTimerReturnType HandleOnRefresh(double InCurrentTime, float InDeltaTime);
+
+		// Rebuilds the task list if any task has been added or has changed state.
+		void RefreshTasks();
+
+		// Adds the lines output by the selected task since the last refresh.
+		void RefreshOutput();
+
+		// Adds the diagnostics found in the selected task since the last refresh.
+		void RefreshDiagnostics();
+
+		// Applies the filter to all diagnostics of the selected task.
+		void RebuildFilteredDiagnostics();
+
+		// Returns whether the diagnostic matches the severity toggles and the search text.
+		bool PassesDiagnosticFilter(const FBuildDiagnostic& Diagnostic) const;
+
+		// Returns the summary of the packaging process shown at the top of the tab.
+		FText GetSummaryText() const;
+
+		// Called to generate rows of the lists.
+		TSharedRef<ITableRow> HandleOnGenerateTaskRow(TSharedPtr<FBuildMonitorTask> Item, const TSharedRef<STableViewBase>& OwnerTable);
+		TSharedRef<ITableRow> HandleOnGenerateOutputRow(const FString* Item, const TSharedRef<STableViewBase>& OwnerTable);
+		TSharedRef<ITableRow> HandleOnGenerateDiagnosticRow(TSharedPtr<FBuildDiagnostic> Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+		// Called when the selected task changes.
+		void HandleOnTaskSelectionChanged(TSharedPtr<FBuildMonitorTask> Item, ESelectInfo::Type SelectInfo);
+
+		// Called when a diagnostic is double-clicked to open the file it refers to.
+		void HandleOnDiagnosticDoubleClicked(TSharedPtr<FBuildDiagnostic> Item);
+
+		// Called when the diagnostic search text changes.
+		void HandleOnSearchTextChanged(const FText& InSearchText);
+
+		// Called when the tab spawner spawns the tab.
+		static TSharedRef<SDockTab> HandleOnSpawnTab(const FSpawnTabArgs& SpawnTabArgs);
+
+	private:
+		// The tasks shown in the task list, and the list itself.
+		TArray<TSharedPtr<FBuildMonitorTask>> TaskItems;
+		TSharedPtr<SListView<TSharedPtr<FBuildMonitorTask>>> TaskListView;
+
+		// The revision of the build monitor the task list was built from.
+		uint32 DisplayedRevision = 0;
+
+		// The task whose output and diagnostics are shown.
+		TSharedPtr<FBuildMonitorTask> SelectedTask;
+
+		// The output of the selected task, held so that the lines referenced by the output list stay valid.
+		TSharedPtr<const FTaskOutputLog> DisplayedOutputLog;
+
+		// The lines shown in the output list, which point into the ring buffer of the output log.
+		TArray<const FString*> OutputItems;
+		TSharedPtr<SListView<const FString*>> OutputListView;
+
+		// The number of lines added to the output log when the output list was last refreshed.
+		uint64 DisplayedNumAddedLines = 0;
+
+		// Whether the output list scrolls to the latest line as lines are added.
+		bool bFollowOutput = true;
+
+		// All diagnostics of the selected task, those that pass the filter, and the list that shows them.
+		TArray<TSharedPtr<FBuildDiagnostic>> DiagnosticItems;
+		TArray<TSharedPtr<FBuildDiagnostic>> FilteredDiagnosticItems;
+		TSharedPtr<SListView<TSharedPtr<FBuildDiagnostic>>> DiagnosticListView;
+
+		// The number of errors and warnings of the selected task.
+		int32 NumErrors = 0;
+		int32 NumWarnings = 0;
+
+		// The diagnostic filter.
+		bool bShowErrors = true;
+		bool bShowWarnings = true;
+		FString SearchText;
+
+		// The name of the build monitor tab.
+		static const FName TabId;
+
+		// How often new output is picked up, in seconds.
+		static constexpr float RefreshInterval = 0.25f;
+	};
+}
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 #include "PluginBuilder/Types/PackagePluginParams.h"
+#include "PluginBuilder/Types/BuildDiagnostics.h"
+#include "PluginBuilder/Types/PackageRunReport.h"
 
 namespace PluginBuilder
 {
@@ -35,7 +37,18 @@ namespace PluginBuilder
 		// Returns whether the package plugin task has started.
 		virtual bool StartPackagePluginTask(const TOptional<FPackagePluginParams>& InParams = {}) = 0;
 
+		// Creates and starts a task that packages several plugins, each with its own parameters, in one shared task pool.
+		// Use FPackagePluginParams::MakeBatchFromPluginFriendlyNames to create the parameters from the values set in the editor preferences.
+		// Returns whether the package plugin task has started.
+		virtual bool StartBatchPackagePluginTask(const TArray<FPackagePluginParams>& InParamsList) = 0;
+
 		// Returns whether package processing is being done.
 		virtual bool IsPackagePluginTaskRunning() = 0;
+
+		// Returns the errors and warnings of each task in the last packaging process, or of the running one.
+		virtual TArray<FBuildDiagnostics> GetLastPackageDiagnostics() = 0;
+
+		// Returns the run report of the last packaging process, with the measurements of each task and any regressions against recent runs.
+		virtual FPackageRunReport GetLastPackageRunReport() = 0;
 	};
 }
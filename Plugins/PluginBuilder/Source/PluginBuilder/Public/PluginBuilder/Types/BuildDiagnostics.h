@@ -0,0 +1,89 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * The severity of a diagnostic reported by a build tool.
+	 */
+	enum class EBuildDiagnosticSeverity : uint8
+	{
+		Warning,
+		Error,
+	};
+
+	/**
+	 * The tool that reported a diagnostic.
+	 */
+	enum class EBuildDiagnosticSource : uint8
+	{
+		// The C++ compiler (MSVC or clang).
+		Compiler,
+
+		// The linker (link.exe, lld or ld).
+		Linker,
+
+		// UnrealHeaderTool.
+		UnrealHeaderTool,
+
+		// AutomationTool or UnrealBuildTool itself.
+		AutomationTool,
+	};
+
+	/**
+	 * A single error or warning found in the output of a UAT process.
+	 */
+	struct PLUGINBUILDER_API FBuildDiagnostic
+	{
+	public:
+		// The severity of the diagnostic.
+		EBuildDiagnosticSeverity Severity = EBuildDiagnosticSeverity::Error;
+
+		// The tool that reported the diagnostic.
+		EBuildDiagnosticSource Source = EBuildDiagnosticSource::Compiler;
+
+		// The file the diagnostic refers to, or empty if it does not refer to a file.
+		FString FilePath;
+
+		// The line and column in the file, or 0 if unknown.
+		int32 Line = 0;
+		int32 Column = 0;
+
+		// The diagnostic code, such as "C2065" or "LNK2019", or empty if the tool does not report one.
+		FString Code;
+
+		// The diagnostic message.
+		FString Message;
+
+	public:
+		// Returns whether this diagnostic fails the build.
+		bool IsError() const;
+
+		// Returns a single line description, such as "Foo.cpp(12,5): error C2065: 'Bar': undeclared identifier".
+		FString ToString() const;
+	};
+
+	/**
+	 * The diagnostics collected from the output of one task.
+	 */
+	struct PLUGINBUILDER_API FBuildDiagnostics
+	{
+	public:
+		// The label of the task, such as "UnrealEngine (5.4)".
+		FString TaskLabel;
+
+		// The errors and warnings in the order they were reported. Repeated diagnostics are only recorded once.
+		TArray<FBuildDiagnostic> Entries;
+
+	public:
+		// Returns the number of entries with the specified severity.
+		int32 GetNum(EBuildDiagnosticSeverity Severity) const;
+	};
+
+	// Converts the enums to strings for logs and reports, such as "error" and "Compiler".
+	PLUGINBUILDER_API const TCHAR* LexToString(EBuildDiagnosticSeverity Value);
+	PLUGINBUILDER_API const TCHAR* LexToString(EBuildDiagnosticSource Value);
+}
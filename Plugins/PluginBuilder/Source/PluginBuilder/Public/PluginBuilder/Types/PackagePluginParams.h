@@ -34,6 +34,9 @@ namespace PluginBuilder
 		// Whether to stop the packaging process as soon as the cancel button is pressed during packaging.
 		bool bStopPackagingProcessImmediately = false;
 
+		// Whether to prefix the task labels with the plugin name, so that the tasks of different plugins packaged together can be told apart.
+		bool bIncludePluginNameInTaskLabel = false;
+
 	public:
 		// Returns the name of the plugin formatted according to the value of bUseFriendlyName.
 		FString GetPluginNameInSpecifiedFormat() const;
@@ -67,6 +70,20 @@ namespace PluginBuilder
 		// Whether to embed the engine version to be built into the uplugin file.
 		bool bUnversioned = false;
 
+		// Whether to skip the remaining builds and zips as soon as a compile error is found in the build for one engine version.
+		bool bStopOnFirstBuildError = false;
+
+		// Whether to build with UnrealBuildTool directly instead of the BuildPlugin command of UAT.
+		// Skips the startup of UAT and builds the targets of each platform in parallel, reusing the previous build output.
+		bool bBuildWithUBTDirectly = false;
+
+		// The addresses of the build workers that the builds are sent to, such as "192.168.0.10:9100".
+		// The builds for the engine versions are spread over the workers in turn. If nothing is specified, the plugin is built on this machine.
+		TArray<FString> BuildWorkerAddresses;
+
+		// The access token that the build workers were started with. A worker refuses a build whose token does not match.
+		FString BuildWorkerAccessToken;
+
 	public:
 		// Returns whether the format is acceptable for submission to the marketplace.
 		bool IsFormatExpectedByMarketplace() const;
@@ -133,6 +150,15 @@ namespace PluginBuilder
 		// If not set, the upload step is skipped.
 		TOptional<FCloudStorageParams> CloudStorageParams;
 
+		// The maximum number of builds and zips for different engine versions that run at the same time.
+		int32 MaxConcurrentUATTasks = 1;
+
+		// Whether to write a trace of the packaging process to Saved/PluginBuilder/Traces.
+		bool bExportPackageTrace = false;
+
+		// How much a task can get worse than in the last runs before it is reported as a regression in the run report, in percent.
+		int32 RegressionThresholdPercent = 25;
+
 #if UE_5_00_OR_LATER
 		// Whether to change the output log filter to show only log categories for this plugin when starting the package process.
 		bool bShowOnlyLogsFromThisPluginWhenPackageProcessStarts = false;
@@ -143,6 +169,10 @@ namespace PluginBuilder
 		static bool MakeDefault(FPackagePluginParams& Default);
 		static bool MakeFromPluginFriendlyName(const FName& PluginFriendlyName, FPackagePluginParams& Params);
 
+		// Creates a parameter set for each plugin from the values set in the editor preferences, regardless of the selected build target.
+		// Returns false if any of the plugins is not found or no engine version is selected.
+		static bool MakeBatchFromPluginFriendlyNames(const TArray<FName>& PluginFriendlyNames, TArray<FPackagePluginParams>& ParamsList);
+
 		// Returns whether the parameters is valid to start package plugin task.
 		// Returns true if the specified plugin exists and all engine versions are installed.
 		bool IsValid() const;
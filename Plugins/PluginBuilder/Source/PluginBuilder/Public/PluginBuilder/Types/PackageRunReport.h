@@ -0,0 +1,84 @@
+// Copyright 2022-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PluginBuilder
+{
+	/**
+	 * The measurements of one task in a packaging process.
+	 */
+	struct PLUGINBUILDER_API FTaskRunReport
+	{
+	public:
+		// The name of the task, such as "Build UnrealEngine (5.4)".
+		FString TaskName;
+
+		// The key the task is compared by across runs, such as "Build|MyPlugin|5.4|Win64". Tasks without a key are not compared.
+		FString TimingKey;
+
+		// Whether the task completed without errors.
+		bool bSucceeded = false;
+
+		// The measurements keyed by name, such as "wallSeconds", "compileSeconds", "cpuSeconds", "peakMemoryMB",
+		// "stagedBytes", "zippedBytes", "compressionRatio", "uploadedBytes" and "skippedUploads".
+		// Which ones are present depends on the kind of the task and the platform.
+		TMap<FString, double> Metrics;
+	};
+
+	/**
+	 * A measurement of a task that got noticeably worse than in the previous runs of the same plugin.
+	 */
+	struct PLUGINBUILDER_API FRunRegression
+	{
+	public:
+		// The name of the task, such as "Build UnrealEngine (5.4)".
+		FString TaskName;
+
+		// The name of the measurement, such as "compileSeconds".
+		FString MetricName;
+
+		// The value in this run and the average of the previous runs.
+		double Value = 0.0;
+		double BaselineValue = 0.0;
+
+		// The number of previous runs the average was taken over.
+		int32 NumBaselineRuns = 0;
+
+		// A human readable description, such as "Build UnrealEngine (5.6) compile time +38% vs last 10 runs (12m 30s vs 9m 03s)".
+		FString Description;
+	};
+
+	/**
+	 * A machine-readable record of a packaging process, written to Saved/PluginBuilder/RunReports after each run.
+	 */
+	struct PLUGINBUILDER_API FPackageRunReport
+	{
+	public:
+		// The plugin that was packaged and its version name.
+		FString PluginName;
+		FString PluginVersionName;
+
+		// The time (UTC) at which the packaging process started, and how long it took in seconds.
+		FDateTime StartTime;
+		double WallSeconds = 0.0;
+
+		// Whether the packaging process completed without errors, and whether it was canceled.
+		bool bSucceeded = false;
+		bool bWasCanceled = false;
+
+		// The tasks in the order they finished.
+		TArray<FTaskRunReport> Tasks;
+
+		// The measurements that got worse than in the previous runs of the same plugin.
+		TArray<FRunRegression> Regressions;
+
+		// The path of the file the report was written to, or empty if it has not been written.
+		FString FilePath;
+
+	public:
+		// Returns the task with the specified timing key, or nullptr if there is none.
+		const FTaskRunReport* FindTask(const FString& TimingKey) const;
+	};
+}